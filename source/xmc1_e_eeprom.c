@@ -72,6 +72,9 @@
 #define E_EEPROM_XMC1_GC_MARK_END_ERASE1   (0x8U)
 #define E_EEPROM_XMC1_GC_FAIL              (0x9U)
 #define E_EEPROM_XMC1_GC_IDLE              (0xAU)
+#define E_EEPROM_XMC1_GC_WRITE_INDEX       (0xBU)
+#define E_EEPROM_XMC1_GC_RECLAIM_BANK      (0xCU)
+#define E_EEPROM_XMC1_GC_ERASE_RECLAIMED   (0xDU)
 
 /* Prepare DFLASH states states */
 #define E_EEPROM_XMC1_PREPFLASH_FF         (0x1U)
@@ -103,12 +106,23 @@
 #define E_EEPROM_XMC1_DUMMY_CRC            (0xA5A50000U)
 #define E_EEPROM_XMC1_MASK_CRC             (0xFFFF0000U)
 
+/* Bank geometry of the region of data_ptr, resolved by E_EEPROM_XMC1_Init() */
+#define E_EEPROM_XMC1_BANK_SIZE            (data_ptr->bank_size)
+#define E_EEPROM_XMC1_BANK0_BASE           (data_ptr->bank0_base)
+#define E_EEPROM_XMC1_BANK1_BASE           (E_EEPROM_XMC1_BANK0_BASE + E_EEPROM_XMC1_BANK_SIZE)
+#define E_EEPROM_XMC1_BANK_PAGE_COUNT      (E_EEPROM_XMC1_BANK_SIZE / E_EEPROM_XMC1_FLASH_PAGE_SIZE)
+#define E_EEPROM_XMC1_BANK_COUNT           (data_ptr->bank_count)
+#define E_EEPROM_XMC1_BANK_BASE(bank)      (E_EEPROM_XMC1_BANK0_BASE + ((uint32_t)(bank) * E_EEPROM_XMC1_BANK_SIZE))
+
 /* Bank BLOCK offsets */
 #define E_EEPROM_XMC1_NEXT_VALID_OFFSET    (0U)
 #define E_EEPROM_XMC1_BEGIN_OFFSET         (E_EEPROM_XMC1_FLASH_BLOCK_SIZE)
 #define E_EEPROM_XMC1_END_OF_COPY_OFFSET   (E_EEPROM_XMC1_FLASH_BLOCK_SIZE * 2U)
 #define E_EEPROM_XMC1_END_ERASE_OFFSET     (E_EEPROM_XMC1_FLASH_BLOCK_SIZE * 3U)
 #define E_EEPROM_XMC1_DATA_BLOCK_OFFSET    (E_EEPROM_XMC1_FLASH_BLOCK_SIZE * 16U)
+#define E_EEPROM_XMC1_BANK_DATA_BLOCKS     ((E_EEPROM_XMC1_BANK_SIZE - E_EEPROM_XMC1_DATA_BLOCK_OFFSET) / \
+                                            E_EEPROM_XMC1_FLASH_BLOCK_SIZE)
+#define E_EEPROM_XMC1_INDEX_OFFSET         (E_EEPROM_XMC1_FLASH_BLOCK_SIZE * 4U)
 #define E_EEPROM_XMC1_BLOCK1_DATA_OFFSET   (4U)
 #define E_EEPROM_XMC1_BLOCK2_DATA_OFFSET   (2U)
 
@@ -148,6 +162,8 @@
 
 #define E_EEPROM_XMC1_MARKER_MAX_SHIFT     ((uint32_t)(4U))
 #define E_EEPROM_XMC1_MAX_WORDS_IN_BLOCK   ((uint32_t)(4U))
+#define E_EEPROM_XMC1_BLOCKS_PER_PAGE      ((uint32_t)(16U))
+#define E_EEPROM_XMC1_FRONTIER_GUARD       (E_EEPROM_XMC1_FLASH_PAGE_SIZE)
 #define E_EEPROM_XMC1_PAGE1_EXTRA_WORDS    ((uint8_t)(48U))
 #define E_EEPROM_XMC1_MARKER_POSITION      ((uint32_t)0x80U)
 
@@ -173,82 +189,226 @@
 #define E_EEPROM_XMC1_EXECUTE_PREP_FLASH   (0x1U)
 #define E_EEPROM_XMC1_EXECUTE_GC_STATE     (0x2U)
 
+/** Checkpoint index written into the spare blocks of the marker page */
+#define E_EEPROM_XMC1_INDEX_MAGIC          ((uint32_t)0x58494458U)
+#define E_EEPROM_XMC1_INDEX_HEADER_WORDS   (4U)
+#define E_EEPROM_XMC1_INDEX_FRONTIER_WORD  (1U)
+#define E_EEPROM_XMC1_INDEX_COUNT_WORD     (2U)
+#define E_EEPROM_XMC1_INDEX_CHECKSUM_WORD  (3U)
+#define E_EEPROM_XMC1_INDEX_BLOCK_MASK     ((uint32_t)0x0000FFFFU)
+#define E_EEPROM_XMC1_INDEX_NUMBER_SHIFT   (16U)
+#define E_EEPROM_XMC1_INDEX_NUMBER_MASK    ((uint32_t)0x00FF0000U)
+#define E_EEPROM_XMC1_INDEX_VALID_FLAG     ((uint32_t)0x01000000U)
+#define E_EEPROM_XMC1_INDEX_CRC_FLAG       ((uint32_t)0x02000000U)
+
+/** Segment header of a rotating log written into block 0 of the marker page: magic, sequence, ~sequence, count */
+#define E_EEPROM_XMC1_SEGMENT_MAGIC        ((uint32_t)0x474F4C52U)
+#define E_EEPROM_XMC1_SEGMENT_SEQ_WORD     (1U)
+#define E_EEPROM_XMC1_SEGMENT_NSEQ_WORD    (2U)
+#define E_EEPROM_XMC1_SEGMENT_COUNT_WORD   (3U)
+#define E_EEPROM_XMC1_SEGMENT_MAX_AGE      ((uint32_t)0xFFFFU)
+
+/* Segment states of a rotating log evaluated by the initialization */
+#define E_EEPROM_XMC1_SEGMENT_ERASED       (0U) /* Marker page erased */
+#define E_EEPROM_XMC1_SEGMENT_LIVE         (1U) /* Valid header, part of the log */
+#define E_EEPROM_XMC1_SEGMENT_RECLAIMED    (2U) /* Valid header, live blocks copied, erase pending */
+#define E_EEPROM_XMC1_SEGMENT_DIRTY        (3U) /* Interrupted header write or erase */
+
+/* Watermarks of the idle time garbage collection are given in percent of the data blocks of a bank */
+#define E_EEPROM_XMC1_PERCENT              (100U)
+
+/* Seed of the checksum of the run time state kept over a warm reset */
+#define E_EEPROM_XMC1_WARM_MAGIC           ((uint32_t)0x4D524157U)
+
 /** Internal limits bounds */
 #define E_EEPROM_XMC1_MAX_BLOCK_COUNT      (10u)
 #define E_EEPROM_XMC1_MAX_BLOCK_SIZE       (0x8000u)
+#define E_EEPROM_XMC1_MAX_BANK_SIZE        (51200u)
 
 
 /*****************************************************************************
  * GLOBAL DATA
  ****************************************************************************/
-E_EEPROM_XMC1_t *e_eeprom_xmc1_handle;
+E_EEPROM_XMC1_t *e_eeprom_xmc1_handle; /* Instance of the last E_EEPROM_XMC1_Init(), used by the APIs without handle */
 
 /*****************************************************************************
  * LOCAL ROUTINES
  ****************************************************************************/
 static void E_EEPROM_XMC1_lWriteSingleBlock(uint32_t const address, const uint32_t *const data);
 static void E_EEPROM_XMC1_lReadSingleBlock(uint32_t const address, uint32_t *const data);
+static void E_EEPROM_XMC1_lWriteBlocks(uint32_t const address, const uint32_t *const data, uint32_t num_blocks);
+static void E_EEPROM_XMC1_lReadBlocks(uint32_t const address, uint32_t *const data, uint32_t num_blocks);
 static void E_EEPROM_XMC1_lWriteSinglePage(uint32_t const address, const uint32_t *const data);
 static void E_EEPROM_XMC1_lEraseSinglePage(uint32_t const address);
 static uint32_t E_EEPROM_XMC1_lReadSingleWord(uint32_t const address);
 static uint32_t E_EEPROM_XMC1_lGetFlashStatus(void);
 
-static void E_EEPROM_XMC1_lInitDirtyStateMachine(void);
-static void E_EEPROM_XMC1_lInitNormalStateMachine(void);
-static void E_EEPROM_XMC1_lInitllegalStateMachine(void);
-static uint32_t E_EEPROM_XMC1_lInitBank0NormalStateMachine(void);
-static uint32_t E_EEPROM_XMC1_lInitBank1NormalStateMachine(void);
-static uint32_t E_EEPROM_XMC1_lInitOtherNormalStateMachine(void);
-static void E_EEPROM_XMC1_lInitGc(const uint32_t  marker_dirty_state);
-static void E_EEPROM_XMC1_lInitGcNormalStates(uint32_t current_state, uint32_t next_process);
-static void E_EEPROM_XMC1_lInitGcDataCopyState(uint32_t current_state, uint32_t marker_offset);
-
-static void E_EEPROM_XMC1_lPrepareDFlash(void);
-static void E_EEPROM_XMC1_lGarbageCollection(void);
-static void E_EEPROM_XMC1_lSetMarkerBlockBuffer(void);
-static void E_EEPROM_XMC1_lSetMarkerPageBuffer(uint32_t state);
-static uint32_t E_EEPROM_XMC1_lReadVerifyMarker(uint32_t bank, uint32_t block);
-static void E_EEPROM_XMC1_lErasedDirtyStateRecovery( uint32_t marker_offset);
-static uint32_t E_EEPROM_XMC1_lReadMarkerBlocks(void);
-static void E_EEPROM_XMC1_lCopyProcessDirtyStateRecovery(uint32_t current_state ,
+static void E_EEPROM_XMC1_lInitDirtyStateMachine(E_EEPROM_XMC1_t *const handle_ptr,
+        E_EEPROM_XMC1_DATA_t *const data_ptr);
+static void E_EEPROM_XMC1_lInitNormalStateMachine(E_EEPROM_XMC1_t *const handle_ptr,
+        E_EEPROM_XMC1_DATA_t *const data_ptr);
+static void E_EEPROM_XMC1_lInitllegalStateMachine(E_EEPROM_XMC1_t *const handle_ptr,
+        E_EEPROM_XMC1_DATA_t *const data_ptr);
+static uint32_t E_EEPROM_XMC1_lInitBank0NormalStateMachine(E_EEPROM_XMC1_t *const handle_ptr,
+        E_EEPROM_XMC1_DATA_t *const data_ptr);
+static uint32_t E_EEPROM_XMC1_lInitBank1NormalStateMachine(E_EEPROM_XMC1_t *const handle_ptr,
+        E_EEPROM_XMC1_DATA_t *const data_ptr);
+static uint32_t E_EEPROM_XMC1_lInitOtherNormalStateMachine(E_EEPROM_XMC1_t *const handle_ptr,
+        E_EEPROM_XMC1_DATA_t *const data_ptr);
+static void E_EEPROM_XMC1_lInitGc(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr,
+        const uint32_t  marker_dirty_state);
+static void E_EEPROM_XMC1_lInitGcNormalStates(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr,
+        uint32_t current_state, uint32_t next_process);
+static void E_EEPROM_XMC1_lInitGcDataCopyState(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr,
+        uint32_t current_state, uint32_t marker_offset);
+
+static void E_EEPROM_XMC1_lPrepareDFlash(E_EEPROM_XMC1_DATA_t *const data_ptr);
+static void E_EEPROM_XMC1_lGarbageCollection(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr);
+static uint32_t E_EEPROM_XMC1_lGarbageCollectionStep(E_EEPROM_XMC1_t *const handle_ptr,
+        E_EEPROM_XMC1_DATA_t *const data_ptr);
+static void E_EEPROM_XMC1_lGetGcProgress(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr,
+        E_EEPROM_XMC1_GC_PROGRESS_t *const progress_ptr);
+static void E_EEPROM_XMC1_lSetMarkerBlockBuffer(E_EEPROM_XMC1_DATA_t *const data_ptr);
+static void E_EEPROM_XMC1_lSetMarkerPageBuffer(E_EEPROM_XMC1_DATA_t *const data_ptr, uint32_t state);
+static uint32_t E_EEPROM_XMC1_lReadVerifyMarker(E_EEPROM_XMC1_DATA_t *const data_ptr, uint32_t bank, uint32_t block);
+static void E_EEPROM_XMC1_lErasedDirtyStateRecovery(E_EEPROM_XMC1_t *const handle_ptr,
+        E_EEPROM_XMC1_DATA_t *const data_ptr, uint32_t marker_offset);
+static uint32_t E_EEPROM_XMC1_lReadMarkerBlocks(E_EEPROM_XMC1_DATA_t *const data_ptr);
+static void E_EEPROM_XMC1_lCopyProcessDirtyStateRecovery(E_EEPROM_XMC1_t *const handle_ptr,
+        E_EEPROM_XMC1_DATA_t *const data_ptr, uint32_t current_state ,
         uint32_t NextState,
         uint32_t page_addr_select);
 
-static void E_EEPROM_XMC1_lUpdateCache(void);
-static void E_EEPROM_XMC1_lEvalBlockStatus(void);
-static void E_EEPROM_XMC1_lUpdateCurrBankInfo(void);
-static uint32_t E_EEPROM_XMC1_lUpdateCacheBlockRead(void);
-static uint32_t E_EEPROM_XMC1_lCacheEmptyBlkEval(uint32_t end_addr);
+static void E_EEPROM_XMC1_lUpdateCache(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr);
+static uint32_t E_EEPROM_XMC1_lSearchNextFreeBlock(E_EEPROM_XMC1_DATA_t *const data_ptr, uint32_t bank_base_addr,
+        uint32_t end_addr);
+static void E_EEPROM_XMC1_lMountBank(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr);
+static void E_EEPROM_XMC1_lResolveCacheEntry(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr,
+        uint32_t block_index);
+static void E_EEPROM_XMC1_lResolveCache(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr);
+static void E_EEPROM_XMC1_lEvalBlockStatus(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr);
+static uint32_t E_EEPROM_XMC1_lSetBankGeometry(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr);
+static uint32_t E_EEPROM_XMC1_lSetColdBankGeometry(E_EEPROM_XMC1_t *const handle_ptr,
+        E_EEPROM_XMC1_DATA_t *const data_ptr);
+static uint32_t E_EEPROM_XMC1_lIsRegionCapacityValid(E_EEPROM_XMC1_t *const handle_ptr,
+        E_EEPROM_XMC1_DATA_t *const data_ptr);
+static void E_EEPROM_XMC1_lInitRegion(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr);
+static E_EEPROM_XMC1_DATA_t *E_EEPROM_XMC1_lGetBlockRegion(E_EEPROM_XMC1_t *const handle_ptr, uint32_t block_index);
+static E_EEPROM_XMC1_DATA_t *E_EEPROM_XMC1_lSelectRegion(E_EEPROM_XMC1_t *const handle_ptr, uint8_t block_number);
+static E_EEPROM_XMC1_DATA_t *E_EEPROM_XMC1_lSelectGcRegion(E_EEPROM_XMC1_t *const handle_ptr);
+static void E_EEPROM_XMC1_lUpdateCurrBankInfo(E_EEPROM_XMC1_DATA_t *const data_ptr);
+static void E_EEPROM_XMC1_lInitSegments(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr);
+static uint32_t E_EEPROM_XMC1_lReadSegmentState(E_EEPROM_XMC1_DATA_t *const data_ptr, uint32_t bank);
+static uint32_t E_EEPROM_XMC1_lWriteSegmentHeader(E_EEPROM_XMC1_DATA_t *const data_ptr, uint32_t bank,
+        uint32_t sequence);
+static uint32_t E_EEPROM_XMC1_lGetOlderSegment(E_EEPROM_XMC1_DATA_t *const data_ptr, uint32_t bank);
+static uint32_t E_EEPROM_XMC1_lSelectVictimSegment(E_EEPROM_XMC1_t *const handle_ptr,
+        E_EEPROM_XMC1_DATA_t *const data_ptr, uint32_t head_bank, uint32_t head_seq, uint32_t *const live_ptr);
+static uint32_t E_EEPROM_XMC1_lUpdateCacheBlockRead(E_EEPROM_XMC1_DATA_t *const data_ptr);
+static uint32_t E_EEPROM_XMC1_lCacheEmptyBlkEval(E_EEPROM_XMC1_DATA_t *const data_ptr, uint32_t end_addr);
+static uint32_t E_EEPROM_XMC1_lSearchFreeBlockFrontier(uint32_t end_addr, uint32_t last_block_addr);
+static uint32_t E_EEPROM_XMC1_lIsBlockWritten(uint32_t block_address);
+static uint32_t E_EEPROM_XMC1_lReadCheckpointIndex(E_EEPROM_XMC1_t *const handle_ptr,
+        E_EEPROM_XMC1_DATA_t *const data_ptr, uint32_t bank_base_addr);
+static void E_EEPROM_XMC1_lApplyCheckpointIndex(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr,
+        uint32_t bank_base_addr);
+static void E_EEPROM_XMC1_lSetCacheFromIndexEntry(E_EEPROM_XMC1_CACHE_t *const cache_ptr, uint32_t entry,
+        uint32_t bank_base_addr);
+static uint32_t E_EEPROM_XMC1_lGetIndexChecksum(const uint32_t *const index_ptr, uint32_t index_words);
+static void E_EEPROM_XMC1_lSealWarmState(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr);
+static void E_EEPROM_XMC1_lUnsealWarmState(E_EEPROM_XMC1_DATA_t *const data_ptr);
+#ifdef E_EEPROM_XMC1_WARM_RESET_ENABLED
+static uint32_t E_EEPROM_XMC1_lIsWarmStateValid(E_EEPROM_XMC1_t *const handle_ptr);
+static uint32_t E_EEPROM_XMC1_lGetWarmChecksum(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr);
+#endif
 
-static uint32_t E_EEPROM_XMC1_lGetFreeDFLASHBlocks(void);
-static uint32_t E_EEPROM_XMC1_lGetUsrBlockIndex(uint8_t block_number);
+static uint32_t E_EEPROM_XMC1_lGetFreeDFLASHBlocks(E_EEPROM_XMC1_DATA_t *const data_ptr);
+static uint32_t E_EEPROM_XMC1_lGetUsrBlockIndex(E_EEPROM_XMC1_t *const handle_ptr, uint8_t block_number);
 static uint32_t E_EEPROM_XMC1_lGetDFLASHPhysicalBlocks(uint32_t size);
-static uint32_t E_EEPROM_XMC1_lGCWrite(uint32_t block_address);
-static uint32_t E_EEPROM_XMC1_lEraseBank(uint32_t page_address);
-
-static void E_EEPROM_XMC1_lHandleGcStartCopy(void);
-static void E_EEPROM_XMC1_lHandleGcRequested(void);
-static void E_EEPROM_XMC1_lHandleGcEndOfCopy(void);
-static void E_EEPROM_XMC1_lHandleGcCopyWrite(void);
-static void E_EEPROM_XMC1_lHandleGcOtherStates( uint32_t current_state, uint32_t next_state);
-static uint32_t E_EEPROM_XMC1_lWriteDataBlock(void);
-static uint32_t E_EEPROM_XMC1_lHandleInvalidReq(uint8_t block_number, uint32_t user_block_index);
-static uint32_t E_EEPROM_XMC1_lHandleWriteReq(uint8_t block_number, uint8_t* data_buffer_ptr);
-static uint32_t E_EEPROM_XMC1_lLocalWrite(uint8_t block_number,
+static uint32_t E_EEPROM_XMC1_lGCWrite(E_EEPROM_XMC1_DATA_t *const data_ptr, uint32_t block_address);
+static uint32_t E_EEPROM_XMC1_lGCWriteBlocks(E_EEPROM_XMC1_DATA_t *const data_ptr, uint32_t block_address,
+        uint32_t num_blocks);
+static uint32_t E_EEPROM_XMC1_lEraseBank(E_EEPROM_XMC1_DATA_t *const data_ptr, uint32_t page_address);
+
+static void E_EEPROM_XMC1_lHandleGcStartCopy(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr);
+static void E_EEPROM_XMC1_lHandleGcRequested(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr);
+static void E_EEPROM_XMC1_lHandleGcEndOfCopy(E_EEPROM_XMC1_DATA_t *const data_ptr);
+static void E_EEPROM_XMC1_lHandleGcCopyWrite(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr);
+static void E_EEPROM_XMC1_lHandleGcCopyRead(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr);
+static void E_EEPROM_XMC1_lHandleGcWriteIndex(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr);
+static void E_EEPROM_XMC1_lHandleGcOpenSegment(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr);
+static void E_EEPROM_XMC1_lHandleGcReclaimSegment(E_EEPROM_XMC1_t *const handle_ptr,
+        E_EEPROM_XMC1_DATA_t *const data_ptr);
+static void E_EEPROM_XMC1_lHandleGcEraseReclaimed(E_EEPROM_XMC1_DATA_t *const data_ptr);
+static void E_EEPROM_XMC1_lHandleGcOtherStates(E_EEPROM_XMC1_DATA_t *const data_ptr, uint32_t current_state,
+        uint32_t next_state);
+static void E_EEPROM_XMC1_lHandleGcErasePrevBank(E_EEPROM_XMC1_DATA_t *const data_ptr);
+static void E_EEPROM_XMC1_lHandleEraseAhead(E_EEPROM_XMC1_DATA_t *const data_ptr);
+static uint32_t E_EEPROM_XMC1_lIsFlashErased(E_EEPROM_XMC1_DATA_t *const data_ptr, uint32_t address,
+        uint32_t num_blocks);
+static uint32_t E_EEPROM_XMC1_lWriteDataBlock(E_EEPROM_XMC1_DATA_t *const data_ptr);
+static uint32_t E_EEPROM_XMC1_lHandleInvalidReq(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr,
+        uint8_t block_number, uint32_t user_block_index);
+static uint32_t E_EEPROM_XMC1_lHandleWriteReq(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr,
+        uint8_t block_number, uint8_t* data_buffer_ptr);
+static uint32_t E_EEPROM_XMC1_lReserveFlashBlocks(E_EEPROM_XMC1_t *const handle_ptr,
+        E_EEPROM_XMC1_DATA_t *const data_ptr, uint32_t flash_blocks, uint32_t gc_limit);
+static uint32_t E_EEPROM_XMC1_lGetEmergencyReserveBlocks(E_EEPROM_XMC1_t *const handle_ptr);
+static uint32_t E_EEPROM_XMC1_lIsGcCopyPending(E_EEPROM_XMC1_DATA_t *const data_ptr);
+static uint32_t E_EEPROM_XMC1_lLocalEmergencyWrite(E_EEPROM_XMC1_t *const handle_ptr,
+        E_EEPROM_XMC1_DATA_t *const data_ptr, uint8_t block_number, uint8_t *data_buffer_ptr);
+static uint32_t E_EEPROM_XMC1_lIsBlockUnchanged(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr,
+        uint8_t block_number, uint8_t *const data_buffer_ptr);
+static uint32_t E_EEPROM_XMC1_lCompareBlockContents(E_EEPROM_XMC1_DATA_t *const data_ptr, uint32_t block_address,
+        const uint8_t *const data_buffer_ptr,
+        uint32_t block_size);
+static uint32_t E_EEPROM_XMC1_lLocalWriteMulti(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr,
+        const E_EEPROM_XMC1_WRITE_REQ_t *const req_ptr, uint32_t req_count);
+static uint32_t E_EEPROM_XMC1_lGetReqPhysicalBlocks(E_EEPROM_XMC1_t *const handle_ptr,
+        const E_EEPROM_XMC1_WRITE_REQ_t *const req_ptr);
+static uint32_t E_EEPROM_XMC1_lGetLiveFlashBlocks(E_EEPROM_XMC1_t *const handle_ptr,
+        E_EEPROM_XMC1_DATA_t *const data_ptr);
+static uint32_t E_EEPROM_XMC1_lGetEntryLiveBlocks(E_EEPROM_XMC1_t *const handle_ptr,
+        E_EEPROM_XMC1_DATA_t *const data_ptr, uint32_t block_index);
+static uint32_t E_EEPROM_XMC1_lCountLiveFlashBlocks(E_EEPROM_XMC1_t *const handle_ptr,
+        E_EEPROM_XMC1_DATA_t *const data_ptr);
+static uint32_t E_EEPROM_XMC1_lGetGcFreeBlocks(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr);
+static uint32_t E_EEPROM_XMC1_lIsBelowLevel(E_EEPROM_XMC1_DATA_t *const data_ptr, uint32_t free_blocks, uint32_t level);
+static uint32_t E_EEPROM_XMC1_lIsEmergencyGcDue(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr,
+        uint32_t free_blocks);
+static uint32_t E_EEPROM_XMC1_lIsIdleGcDue(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr);
+static uint32_t E_EEPROM_XMC1_lIdleRegion(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr,
+        uint32_t max_operations);
+static void E_EEPROM_XMC1_lCompleteIdleGc(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr);
+static uint32_t E_EEPROM_XMC1_lHandleWriteMultiReq(E_EEPROM_XMC1_t *const handle_ptr,
+        E_EEPROM_XMC1_DATA_t *const data_ptr, const E_EEPROM_XMC1_WRITE_REQ_t *const req_ptr,
+        uint32_t req_count);
+static uint32_t E_EEPROM_XMC1_lBufferMultiBlock(E_EEPROM_XMC1_DATA_t *const data_ptr, uint32_t *const page_blocks_ptr);
+static uint32_t E_EEPROM_XMC1_lFlushMultiBlocks(E_EEPROM_XMC1_DATA_t *const data_ptr, uint32_t *const page_blocks_ptr);
+static void E_EEPROM_XMC1_lUpdateCacheMulti(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr,
+        const E_EEPROM_XMC1_WRITE_REQ_t *const req_ptr, uint32_t req_count,
+        uint32_t written_end_addr, uint32_t failed_end_addr);
+static void E_EEPROM_XMC1_lPopulateInvalidBlock(E_EEPROM_XMC1_DATA_t *const data_ptr, uint8_t block_number);
+static uint32_t E_EEPROM_XMC1_lLocalWrite(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr,
+        uint8_t block_number,
         uint8_t* data_buffer_ptr,
         uint32_t invalidate);
-static void E_EEPROM_XMC1_lPopulateNextBlock(uint8_t block_number,
+static void E_EEPROM_XMC1_lPopulateNextBlock(E_EEPROM_XMC1_DATA_t *const data_ptr, uint8_t block_number,
         uint8_t* const user_data_buffer_ptr ,
         uint32_t block_size);
-static void E_EEPROM_XMC1_lPopulateFirstBlock(uint8_t block_number, uint8_t* user_data_buffer_ptr, uint32_t block_size);
+static void E_EEPROM_XMC1_lPopulateFirstBlock(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr,
+        uint8_t block_number, uint8_t* user_data_buffer_ptr, uint32_t block_size);
 #ifdef E_EEPROM_XMC1_CRC_SW_ENABLED
-static E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_lReadBlockCrcStatus(uint8_t block_number,
+static E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_lReadBlockCrcStatus(E_EEPROM_XMC1_t *const handle_ptr,
+        E_EEPROM_XMC1_DATA_t *const data_ptr, uint8_t block_number,
         uint8_t* data_buffer_ptr,
         uint32_t block_size);
 #endif
-static uint32_t E_EEPROM_XMC1_lReadBlockContents(uint8_t *data_buffer_ptr, uint32_t length, uint32_t offset);
-static uint32_t E_EEPROM_XMC1_lGetPrevData(uint8_t block_number);
-static uint32_t E_EEPROM_XMC1_lSearchBlockCopy(uint8_t required_block_number,
+static uint32_t E_EEPROM_XMC1_lReadBlockContents(E_EEPROM_XMC1_DATA_t *const data_ptr, uint8_t *data_buffer_ptr,
+        uint32_t length, uint32_t offset);
+static uint32_t E_EEPROM_XMC1_lGetPrevData(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr,
+        uint8_t block_number);
+static uint32_t E_EEPROM_XMC1_lSearchBlockCopy(E_EEPROM_XMC1_DATA_t *const data_ptr, uint8_t required_block_number,
         uint32_t read_addr ,
         uint32_t data_sec_start_addr);
 /*
@@ -295,12 +455,14 @@ __WEAK uint32_t E_EEPROM_XMC1_TEST_HOOK_GetFlashStatus(void)
 E_EEPROM_XMC1_STATUS_t E_EEPROM_XMC1_Init(E_EEPROM_XMC1_t *const handle_ptr)
 {
     uint32_t indx;
-    uint32_t marker_state;
+    E_EEPROM_XMC1_DATA_t *data_ptr;
 
     e_eeprom_xmc1_handle = handle_ptr;
 
     XMC_ASSERT("E_EEPROM_XMC1_Write:Invalid Buffer Pointer", (handle_ptr != NULL));
 
+    data_ptr = handle_ptr->data_ptr;
+
     /* Check if the E_EEPROM_XMC1_Init API is called once*/
     if (handle_ptr->state != E_EEPROM_XMC1_STATUS_SUCCESS)
     {
@@ -319,60 +481,58 @@ E_EEPROM_XMC1_STATUS_t E_EEPROM_XMC1_Init(E_EEPROM_XMC1_t *const handle_ptr)
                handle_ptr->state = E_EEPROM_XMC1_STATUS_FAILURE;
                return (handle_ptr->state);
             }
-            /* Initialize the cache variables for the User defined Block configuration list */
+            /* Resolve the bank geometry of the instance, all banks must be inside the flash and hold each block */
+            if ((E_EEPROM_XMC1_lSetBankGeometry(handle_ptr, data_ptr) == 0U) ||
+                    (E_EEPROM_XMC1_lIsRegionCapacityValid(handle_ptr, data_ptr) == 0U))
+            {
+               handle_ptr->state = E_EEPROM_XMC1_STATUS_FAILURE;
+               return (handle_ptr->state);
+            }
+            /* The banks of the cold region are placed below the banks of the hot region */
+            if (handle_ptr->cold_data_ptr != NULL)
+            {
+                data_ptr = handle_ptr->cold_data_ptr;
+                if ((E_EEPROM_XMC1_lSetColdBankGeometry(handle_ptr, data_ptr) == 0U) ||
+                        (E_EEPROM_XMC1_lIsRegionCapacityValid(handle_ptr, data_ptr) == 0U))
+                {
+                   handle_ptr->state = E_EEPROM_XMC1_STATUS_FAILURE;
+                   return (handle_ptr->state);
+                }
+                data_ptr = handle_ptr->data_ptr;
+            }
+#ifdef E_EEPROM_XMC1_WARM_RESET_ENABLED
+            /* After a warm reset the run time state sealed before the reset is used, the flash is not read */
+            if (E_EEPROM_XMC1_lIsWarmStateValid(handle_ptr) == 1U)
+            {
+                XMC_FLASH_SetHardReadLevel(XMC_FLASH_HARDREAD_LEVEL_WRITTEN);
+                handle_ptr->state = E_EEPROM_XMC1_STATUS_SUCCESS;
+                return (handle_ptr->state);
+            }
+#endif
+            /* Check the User defined Block configuration list */
             indx = 0U;
             do
             {
-                E_EEPROM_XMC1_CACHE_t * block_ptr;
-
                 if (E_EEPROM_XMC1_MAX_BLOCK_SIZE < handle_ptr->block_config_ptr[indx].size)
                 {
                    handle_ptr->state = E_EEPROM_XMC1_STATUS_FAILURE;
                    return (handle_ptr->state);
                 }
-
-                block_ptr = &(handle_ptr->data_ptr->block_info[indx]);
-
-                block_ptr->address = 0U;
-                block_ptr->status.consistent = 0U;
-                block_ptr->status.valid = 1U;
-                block_ptr->status.copied = 0U;
-                block_ptr->status.crc = 0U;
                 indx++;
             } while (indx < handle_ptr->block_count);
 
-            /********* Initialize all global variables *****************/
-            handle_ptr->data_ptr->updated_cache_index = 0U;
-            handle_ptr->data_ptr->cache_state = E_EEPROM_XMC1_CACHE_IDLE;
-            handle_ptr->data_ptr->gc_state = E_EEPROM_XMC1_GC_UNINT;
-            handle_ptr->data_ptr->init_gc_state = 0U;
-            handle_ptr->data_ptr->gc_log_block_count = 0U;
-            handle_ptr->data_ptr->crc_buffer = 0U;
-
-            handle_ptr->data_ptr->written_block_counter = (uint32_t)0;
-            handle_ptr->data_ptr->curr_bank_src_addr = 0U;
-            handle_ptr->data_ptr->gc_src_addr = 0U;
-            handle_ptr->data_ptr->gc_dest_addr = 0U;
-            handle_ptr->data_ptr->next_free_block_addr = 0U;
-            handle_ptr->data_ptr->gc_block_counter = (uint32_t)0;
-            handle_ptr->data_ptr->user_write_bytes_count = 0U;
-
-            handle_ptr->data_ptr->current_bank = 0U;
-
             XMC_FLASH_SetHardReadLevel(XMC_FLASH_HARDREAD_LEVEL_WRITTEN);
 
-            /* Read the marker blocks from flash and decide the MARKER STATES */
-            marker_state = E_EEPROM_XMC1_lReadMarkerBlocks();
-
-
-            /*
-             * Call INIT-GC state machine function to take decision on current MARKER STATE available.
-             * Progress to GC state machine or PrepareDFLASH State machine after completing  the Cache update
-             */
-            E_EEPROM_XMC1_lInitGc(marker_state);
+            /* Evaluate the region of the hot blocks, then the region of the cold blocks */
+            E_EEPROM_XMC1_lInitRegion(handle_ptr, data_ptr);
+            if ((data_ptr->gc_state == E_EEPROM_XMC1_GC_IDLE) && (handle_ptr->cold_data_ptr != NULL))
+            {
+                data_ptr = handle_ptr->cold_data_ptr;
+                E_EEPROM_XMC1_lInitRegion(handle_ptr, data_ptr);
+            }
 
             /* If Initialization is done without any errors, set the INIT API called state into Initialized once */
-            if (handle_ptr->data_ptr->gc_state == E_EEPROM_XMC1_GC_IDLE)
+            if (data_ptr->gc_state == E_EEPROM_XMC1_GC_IDLE)
             {
                 handle_ptr->state = E_EEPROM_XMC1_STATUS_SUCCESS;
             }
@@ -386,12 +546,14 @@ E_EEPROM_XMC1_STATUS_t E_EEPROM_XMC1_Init(E_EEPROM_XMC1_t *const handle_ptr)
 }
 
 /*******************************************************************************
- * Function Name: E_EEPROM_XMC1_Write
+ * Function Name: E_EEPROM_XMC1_WriteEx
  ********************************************************************************
  * Summary:
- * This function shall write user data block into flash
+ * This function shall write user data block into flash. With skip_unchanged
+ * enabled, the write is skipped if the data equals the latest copy.
  *
  * Parameters:
+ * handle_ptr - Pointer to the handle of the instance
  * block_number  - Number of logical block (Block-ID)
  * data_buffer_ptr - Pointer to user data buffer
  *
@@ -399,71 +561,216 @@ E_EEPROM_XMC1_STATUS_t E_EEPROM_XMC1_Init(E_EEPROM_XMC1_t *const handle_ptr)
  * E_EEPROM_XMC1_OPERATION_STATUS_t
  *
  *******************************************************************************/
-E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_Write(uint8_t block_number, uint8_t *data_buffer_ptr)
+E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_WriteEx(E_EEPROM_XMC1_t *const handle_ptr,
+                                                       uint8_t block_number,
+                                                       uint8_t *data_buffer_ptr)
 {
     E_EEPROM_XMC1_OPERATION_STATUS_t status;
     E_EEPROM_XMC1_DATA_t *data_ptr;
 
-    data_ptr = (E_EEPROM_XMC1_DATA_t*)(void*)(e_eeprom_xmc1_handle->data_ptr);
+    XMC_ASSERT("E_EEPROM_XMC1_WriteEx:Invalid Handle Pointer", (handle_ptr != NULL));
 
-    XMC_ASSERT("E_EEPROM_XMC1_Write:Wrong Block Number", (E_EEPROM_XMC1_lGetUsrBlockIndex(block_number) !=
-            E_EEPROM_XMC1_LOG_BLOCK_NOT_FOUND));
+    data_ptr = E_EEPROM_XMC1_lSelectRegion(handle_ptr, block_number);
+
+    XMC_ASSERT("E_EEPROM_XMC1_Write:Wrong Block Number",
+            (E_EEPROM_XMC1_lGetUsrBlockIndex(handle_ptr, block_number) != E_EEPROM_XMC1_LOG_BLOCK_NOT_FOUND));
     XMC_ASSERT("E_EEPROM_XMC1_Write:Invalid Buffer Pointer", (data_buffer_ptr != NULL));
 
     status = E_EEPROM_XMC1_OPERATION_STATUS_NOT_ALLOWED;
 
+    /* A garbage collection paused by E_EEPROM_XMC1_Idle() does not reject the request */
+    E_EEPROM_XMC1_lCompleteIdleGc(handle_ptr, data_ptr);
+
     /* Execute only if there is no previous pending request and the GC process is in IDLE state */
     if (data_ptr->gc_state == E_EEPROM_XMC1_GC_IDLE)
     {
-        /* Call local function to write the specified block of data into flash */
-        status = (E_EEPROM_XMC1_OPERATION_STATUS_t)E_EEPROM_XMC1_lLocalWrite(block_number, data_buffer_ptr, 0U);
+        /* A write of the data of the latest copy is skipped if enabled in the configuration */
+        if ((handle_ptr->skip_unchanged == 1U) &&
+                (E_EEPROM_XMC1_lIsBlockUnchanged(handle_ptr, data_ptr, block_number, data_buffer_ptr) == 1U))
+        {
+            data_ptr->elided_write_count++;
+            data_ptr->elided_flash_blocks += E_EEPROM_XMC1_lGetDFLASHPhysicalBlocks(
+                    handle_ptr->block_config_ptr[E_EEPROM_XMC1_lGetUsrBlockIndex(handle_ptr, block_number)].size);
+            status = E_EEPROM_XMC1_OPERATION_STATUS_UNCHANGED;
+        }
+        else
+        {
+            /* Call local function to write the specified block of data into flash */
+            status = (E_EEPROM_XMC1_OPERATION_STATUS_t)E_EEPROM_XMC1_lLocalWrite(handle_ptr, data_ptr, block_number,
+                    data_buffer_ptr, 0U);
+        }
     }
 
     return((E_EEPROM_XMC1_OPERATION_STATUS_t)status);
 }
 
 /*******************************************************************************
- * Function Name: E_EEPROM_XMC1_InvalidateBlock
+ * Function Name: E_EEPROM_XMC1_InvalidateBlockEx
  ********************************************************************************
  * Summary:
  * This function shall invalidate user data block.
  *
  * Parameters:
+ * handle_ptr - Pointer to the handle of the instance
  * block_number  - Number of logical block (Block-ID)
  *
  * Return:
  * E_EEPROM_XMC1_OPERATION_STATUS_t
  *
  *******************************************************************************/
-E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_InvalidateBlock(uint8_t block_number)
+E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_InvalidateBlockEx(E_EEPROM_XMC1_t *const handle_ptr,
+                                                                 uint8_t block_number)
 {
     uint8_t* data_buffer_ptr;
     E_EEPROM_XMC1_DATA_t *data_ptr;
     E_EEPROM_XMC1_OPERATION_STATUS_t status;
 
-    data_ptr = (E_EEPROM_XMC1_DATA_t*)(void*)(e_eeprom_xmc1_handle->data_ptr);
-    XMC_ASSERT("E_EEPROM_XMC1_InvalidateBlock:Wrong Block Number", (E_EEPROM_XMC1_lGetUsrBlockIndex(block_number) !=
-            E_EEPROM_XMC1_LOG_BLOCK_NOT_FOUND));
+    XMC_ASSERT("E_EEPROM_XMC1_InvalidateBlockEx:Invalid Handle Pointer", (handle_ptr != NULL));
+
+    data_ptr = E_EEPROM_XMC1_lSelectRegion(handle_ptr, block_number);
+    XMC_ASSERT("E_EEPROM_XMC1_InvalidateBlock:Wrong Block Number",
+            (E_EEPROM_XMC1_lGetUsrBlockIndex(handle_ptr, block_number) != E_EEPROM_XMC1_LOG_BLOCK_NOT_FOUND));
     data_buffer_ptr =  data_ptr->read_write_buffer;
     status = E_EEPROM_XMC1_OPERATION_STATUS_NOT_ALLOWED;
 
+    /* A garbage collection paused by E_EEPROM_XMC1_Idle() does not reject the request */
+    E_EEPROM_XMC1_lCompleteIdleGc(handle_ptr, data_ptr);
+
     /* Execute only if there is no previous pending request and the GC process is in IDLE state */
     if (data_ptr->gc_state == E_EEPROM_XMC1_GC_IDLE)
     {
         /* Call local function to write the specified block of data into flash */
-        status = (E_EEPROM_XMC1_OPERATION_STATUS_t)E_EEPROM_XMC1_lLocalWrite( block_number, data_buffer_ptr ,1U);
+        status = (E_EEPROM_XMC1_OPERATION_STATUS_t)E_EEPROM_XMC1_lLocalWrite(handle_ptr, data_ptr, block_number,
+                data_buffer_ptr ,1U);
     }
 
     return((E_EEPROM_XMC1_OPERATION_STATUS_t)status);
 }
 
 /*******************************************************************************
- * Function Name: E_EEPROM_XMC1_Read
+ * Function Name: E_EEPROM_XMC1_WriteMultiEx
+ ********************************************************************************
+ * Summary:
+ * This function shall write or invalidate several user data blocks with one
+ * request. The flash space for all blocks is reserved at once and the blocks
+ * are programmed page wise. All blocks must belong to the same region.
+ *
+ * Parameters:
+ * handle_ptr - Pointer to the handle of the instance
+ * req_ptr   - Pointer to the array of write/invalidate requests
+ * req_count - Number of requests in the array
+ *
+ * Return:
+ * E_EEPROM_XMC1_OPERATION_STATUS_t
+ *
+ *******************************************************************************/
+E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_WriteMultiEx(E_EEPROM_XMC1_t *const handle_ptr,
+                                                            const E_EEPROM_XMC1_WRITE_REQ_t *const req_ptr,
+                                                            uint32_t req_count)
+{
+    uint32_t indx;
+    uint32_t same_region;
+    E_EEPROM_XMC1_OPERATION_STATUS_t status;
+    E_EEPROM_XMC1_DATA_t *data_ptr;
+
+    XMC_ASSERT("E_EEPROM_XMC1_WriteMultiEx:Invalid Handle Pointer", (handle_ptr != NULL));
+    XMC_ASSERT("E_EEPROM_XMC1_WriteMulti:Invalid Request Pointer", (req_ptr != NULL));
+
+    data_ptr = handle_ptr->data_ptr;
+    same_region = 1U;
+    if (req_count != 0U)
+    {
+        data_ptr = E_EEPROM_XMC1_lSelectRegion(handle_ptr, req_ptr[0].block_number);
+
+        /* The requests are written into the free space of one region */
+        for (indx = 1U; indx < req_count; indx++)
+        {
+            if (E_EEPROM_XMC1_lGetBlockRegion(handle_ptr,
+                    E_EEPROM_XMC1_lGetUsrBlockIndex(handle_ptr, req_ptr[indx].block_number)) != data_ptr)
+            {
+                same_region = 0U;
+            }
+        }
+    }
+
+    status = E_EEPROM_XMC1_OPERATION_STATUS_NOT_ALLOWED;
+
+    /* A garbage collection paused by E_EEPROM_XMC1_Idle() does not reject the request */
+    if (same_region == 1U)
+    {
+        E_EEPROM_XMC1_lCompleteIdleGc(handle_ptr, data_ptr);
+    }
+
+    /* Execute only if there is no previous pending request and the GC process is in IDLE state */
+    if ((data_ptr->gc_state == E_EEPROM_XMC1_GC_IDLE) && (same_region == 1U))
+    {
+        /* Call local function to write all requested blocks into flash */
+        status = (E_EEPROM_XMC1_OPERATION_STATUS_t)E_EEPROM_XMC1_lLocalWriteMulti(handle_ptr, data_ptr, req_ptr,
+                req_count);
+    }
+
+    return(status);
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_EmergencyWriteEx
+ ********************************************************************************
+ * Summary:
+ * This function shall write a user data block into the free space of the
+ * current bank including the emergency reserve. A garbage collection or erase
+ * is never executed, the flash operations are the programming of the physical
+ * blocks of the block. A garbage collection paused in its block copy rejects
+ * the request, paused before or after it does not.
+ *
+ * Parameters:
+ * handle_ptr - Pointer to the handle of the instance
+ * block_number  - Number of logical block (Block-ID)
+ * data_buffer_ptr - Pointer to user data buffer
+ *
+ * Return:
+ * E_EEPROM_XMC1_OPERATION_STATUS_t
+ *
+ *******************************************************************************/
+E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_EmergencyWriteEx(E_EEPROM_XMC1_t *const handle_ptr,
+                                                                uint8_t block_number,
+                                                                uint8_t *data_buffer_ptr)
+{
+    E_EEPROM_XMC1_OPERATION_STATUS_t status;
+    E_EEPROM_XMC1_DATA_t *data_ptr;
+
+    XMC_ASSERT("E_EEPROM_XMC1_EmergencyWriteEx:Invalid Handle Pointer", (handle_ptr != NULL));
+
+    data_ptr = E_EEPROM_XMC1_lSelectRegion(handle_ptr, block_number);
+
+    XMC_ASSERT("E_EEPROM_XMC1_EmergencyWrite:Wrong Block Number",
+            (E_EEPROM_XMC1_lGetUsrBlockIndex(handle_ptr, block_number) != E_EEPROM_XMC1_LOG_BLOCK_NOT_FOUND));
+    XMC_ASSERT("E_EEPROM_XMC1_EmergencyWrite:Invalid Buffer Pointer", (data_buffer_ptr != NULL));
+
+    status = E_EEPROM_XMC1_OPERATION_STATUS_NOT_ALLOWED;
+
+    /*
+     * A pending garbage collection is not completed, its duration is not bounded. A garbage collection paused
+     * before or after its block copy leaves the current bank consistent, the block is written into its reserve.
+     * Paused in the block copy, the latest copy of the block may already be copied to the new bank.
+     */
+    if ((handle_ptr->state == E_EEPROM_XMC1_STATUS_SUCCESS) &&
+            (data_ptr->gc_state != E_EEPROM_XMC1_GC_FAIL) && (E_EEPROM_XMC1_lIsGcCopyPending(data_ptr) == 0U))
+    {
+        status = (E_EEPROM_XMC1_OPERATION_STATUS_t)E_EEPROM_XMC1_lLocalEmergencyWrite(handle_ptr, data_ptr,
+                block_number, data_buffer_ptr);
+    }
+
+    return(status);
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_ReadEx
  ********************************************************************************
  * Summary:
  * This function shall read user data blocks from flash.
  *
  * Parameters:
+ * handle_ptr - Pointer to the handle of the instance
  * block_number  - Number of logical block
  * offset      - Start Location for Read start
  * data_buffer_ptr - Pointer to user data buffer
@@ -473,28 +780,41 @@ E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_InvalidateBlock(uint8_t block_num
  * E_EEPROM_XMC1_OPERATION_STATUS_t
  *
  *******************************************************************************/
-E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_Read(uint8_t block_number,
-        uint32_t offset,
-        uint8_t *data_buffer_ptr,
-        uint32_t length)
+E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_ReadEx(E_EEPROM_XMC1_t *const handle_ptr,
+                                                      uint8_t block_number,
+                                                      uint32_t offset,
+                                                      uint8_t *data_buffer_ptr,
+                                                      uint32_t length)
 {
     uint32_t block_size;
     uint32_t user_block_index;
     E_EEPROM_XMC1_DATA_t *data_ptr;
     E_EEPROM_XMC1_OPERATION_STATUS_t status;
 
-    data_ptr = (E_EEPROM_XMC1_DATA_t*)(void*)(e_eeprom_xmc1_handle->data_ptr);
-    user_block_index = E_EEPROM_XMC1_lGetUsrBlockIndex(block_number);
-    block_size = e_eeprom_xmc1_handle->block_config_ptr[user_block_index].size;
+    XMC_ASSERT("E_EEPROM_XMC1_ReadEx:Invalid Handle Pointer", (handle_ptr != NULL));
+
+    data_ptr = E_EEPROM_XMC1_lSelectRegion(handle_ptr, block_number);
+    user_block_index = E_EEPROM_XMC1_lGetUsrBlockIndex(handle_ptr, block_number);
+    block_size = handle_ptr->block_config_ptr[user_block_index].size;
 
     XMC_ASSERT("E_EEPROM_XMC1_Read:Wrong Block Number", (user_block_index  != E_EEPROM_XMC1_LOG_BLOCK_NOT_FOUND));
     XMC_ASSERT("E_EEPROM_XMC1_Read:Invalid Buffer Pointer", (data_buffer_ptr != NULL));
 
     status = E_EEPROM_XMC1_OPERATION_STATUS_NOT_ALLOWED;
 
-    /*Execute only if GC process is in IDLE state */
-    if ((data_ptr->gc_state == E_EEPROM_XMC1_GC_IDLE) && (((uint32_t)offset + length) <= block_size))
+    /*
+     * Execute only if GC process is in IDLE state or paused by E_EEPROM_XMC1_GcStep(). A paused GC has no block
+     * copy in progress, hence the cache table points to consistent data in one of the banks.
+     */
+    if (((data_ptr->gc_state == E_EEPROM_XMC1_GC_IDLE) ||
+            ((handle_ptr->state == E_EEPROM_XMC1_STATUS_SUCCESS) &&
+             (data_ptr->gc_state != E_EEPROM_XMC1_GC_FAIL) &&
+             (data_ptr->gc_state != E_EEPROM_XMC1_GC_COPY_WRITE))) &&
+            (((uint32_t)offset + length) <= block_size))
     {
+        /* Search the block in flash on the first access after a lazy mount */
+        E_EEPROM_XMC1_lResolveCacheEntry(handle_ptr, data_ptr, user_block_index);
+
         if (data_ptr->block_info[user_block_index].status.valid == 0U) /* If cache says Inconsistent */
         {
             status = E_EEPROM_XMC1_OPERATION_STATUS_INVALID_BLOCK;
@@ -506,7 +826,8 @@ E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_Read(uint8_t block_number,
         else
         {
             data_ptr->read_start_address = data_ptr->block_info[user_block_index].address;
-            status = (E_EEPROM_XMC1_OPERATION_STATUS_t)E_EEPROM_XMC1_lReadBlockContents(data_buffer_ptr , length , offset);
+            status = (E_EEPROM_XMC1_OPERATION_STATUS_t)E_EEPROM_XMC1_lReadBlockContents(data_ptr, data_buffer_ptr ,
+                    length , offset);
 
             if ((uint32_t)status != 0U)
             {
@@ -518,34 +839,42 @@ E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_Read(uint8_t block_number,
 }
 
 /*******************************************************************************
- * Function Name: E_EEPROM_XMC1_StartGarbageCollection
+ * Function Name: E_EEPROM_XMC1_StartGarbageCollectionEx
  ********************************************************************************
  * Summary:
- * This function shall start Garbage collection.
+ * This function shall start Garbage collection of the region of the hot
+ * blocks, or of the cold blocks while their deferred erase is pending.
  *
  * Parameters:
- * void
+ * handle_ptr - Pointer to the handle of the instance
  *
  * Return:
  * E_EEPROM_XMC1_OPERATION_STATUS_t
  *
  *******************************************************************************/
-E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_StartGarbageCollection(void)
+E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_StartGarbageCollectionEx(E_EEPROM_XMC1_t *const handle_ptr)
 {
     E_EEPROM_XMC1_DATA_t *data_ptr;
     E_EEPROM_XMC1_OPERATION_STATUS_t status;
 
-    data_ptr = (E_EEPROM_XMC1_DATA_t*)(void*)(e_eeprom_xmc1_handle->data_ptr);
+    XMC_ASSERT("E_EEPROM_XMC1_StartGarbageCollectionEx:Invalid Handle Pointer", (handle_ptr != NULL));
+
+    data_ptr = E_EEPROM_XMC1_lSelectGcRegion(handle_ptr);
 
     status = E_EEPROM_XMC1_OPERATION_STATUS_NOT_ALLOWED;
 
+    /* A garbage collection paused by E_EEPROM_XMC1_Idle() does not reject the request */
+    E_EEPROM_XMC1_lCompleteIdleGc(handle_ptr, data_ptr);
+
     /* Check if the E_EEPROM_XMC1_Init API is called */
     if (data_ptr->gc_state == E_EEPROM_XMC1_GC_IDLE)
     {
+        E_EEPROM_XMC1_lUnsealWarmState(data_ptr);
+
         data_ptr->gc_state = E_EEPROM_XMC1_GC_REQUESTED;
 
         /* Call local function to start garbage collection process from scratch */
-        E_EEPROM_XMC1_lGarbageCollection();
+        E_EEPROM_XMC1_lGarbageCollection(handle_ptr, data_ptr);
 
         if (data_ptr->gc_state == E_EEPROM_XMC1_GC_FAIL)
         {
@@ -554,6 +883,7 @@ E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_StartGarbageCollection(void)
         else
         {
             status = E_EEPROM_XMC1_OPERATION_STATUS_SUCCESS;
+            E_EEPROM_XMC1_lSealWarmState(handle_ptr, data_ptr);
         }
     }
 
@@ -561,30 +891,209 @@ E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_StartGarbageCollection(void)
 }
 
 /*******************************************************************************
- * Function Name: E_EEPROM_XMC1_GetStatus
+ * Function Name: E_EEPROM_XMC1_GcStepEx
  ********************************************************************************
  * Summary:
- * This function shall return the status of the APP
+ * This function shall execute the garbage collection in steps. A new garbage
+ * collection is started if none is pending. The state machine is advanced until
+ * the given number of flash program/erase operations is spent or the garbage
+ * collection is completed. A step never ends while a block copy is half done.
+ * A pending deferred erase of the region of the cold blocks is completed before
+ * the region of the hot blocks is collected.
  *
  * Parameters:
- * void
+ * handle_ptr - Pointer to the handle of the instance
+ * max_operations - Maximum number of flash program/erase operations
+ * progress_ptr - Pointer to the progress information (can be NULL)
+ *
+ * Return:
+ * E_EEPROM_XMC1_OPERATION_STATUS_t
+ *
+ *******************************************************************************/
+E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_GcStepEx(E_EEPROM_XMC1_t *const handle_ptr,
+                                                        uint32_t max_operations,
+                                                        E_EEPROM_XMC1_GC_PROGRESS_t *const progress_ptr)
+{
+    uint32_t flash_operations;
+    E_EEPROM_XMC1_DATA_t *data_ptr;
+    E_EEPROM_XMC1_OPERATION_STATUS_t status;
+
+    XMC_ASSERT("E_EEPROM_XMC1_GcStepEx:Invalid Handle Pointer", (handle_ptr != NULL));
+    XMC_ASSERT("E_EEPROM_XMC1_GcStep:Invalid operations budget", (max_operations != 0U));
+
+    data_ptr = E_EEPROM_XMC1_lSelectGcRegion(handle_ptr);
+
+    status = E_EEPROM_XMC1_OPERATION_STATUS_NOT_ALLOWED;
+
+    /* Check if the E_EEPROM_XMC1_Init API is called */
+    if ((handle_ptr->state == E_EEPROM_XMC1_STATUS_SUCCESS) &&
+            (data_ptr->gc_state != E_EEPROM_XMC1_GC_FAIL))
+    {
+        E_EEPROM_XMC1_lUnsealWarmState(data_ptr);
+
+        /* The garbage collection is taken over from E_EEPROM_XMC1_Idle(), write requests wait for its completion */
+        data_ptr->idle_gc_active = 0U;
+        flash_operations = 0U;
+
+        if ((data_ptr->gc_state == E_EEPROM_XMC1_GC_IDLE) && (data_ptr->pending_erase_pages != 0U))
+        {
+            /* Continue the deferred erase of the previous bank, a new garbage collection is not started */
+            do
+            {
+                E_EEPROM_XMC1_lHandleEraseAhead(data_ptr);
+                flash_operations++;
+
+            } while ((flash_operations < max_operations) &&
+                    (data_ptr->pending_erase_pages != 0U) &&
+                    (data_ptr->gc_state != E_EEPROM_XMC1_GC_FAIL));
+        }
+        else
+        {
+            /* Start the garbage collection process from scratch if none is pending */
+            if (data_ptr->gc_state == E_EEPROM_XMC1_GC_IDLE)
+            {
+                data_ptr->gc_state = E_EEPROM_XMC1_GC_REQUESTED;
+            }
+
+            do
+            {
+                flash_operations += E_EEPROM_XMC1_lGarbageCollectionStep(handle_ptr, data_ptr);
+
+            } while ((flash_operations < max_operations) &&
+                    (data_ptr->gc_state != E_EEPROM_XMC1_GC_IDLE) &&
+                    (data_ptr->gc_state != E_EEPROM_XMC1_GC_FAIL));
+        }
+
+        if (data_ptr->gc_state == E_EEPROM_XMC1_GC_FAIL)
+        {
+            status = E_EEPROM_XMC1_OPERATION_STATUS_FAILURE;
+        }
+        else
+        {
+            status = E_EEPROM_XMC1_OPERATION_STATUS_SUCCESS;
+
+            /* A paused garbage collection is not continued after a warm reset, the state is not sealed */
+            if (data_ptr->gc_state == E_EEPROM_XMC1_GC_IDLE)
+            {
+                E_EEPROM_XMC1_lSealWarmState(handle_ptr, data_ptr);
+            }
+        }
+    }
+
+    if (progress_ptr != NULL)
+    {
+        E_EEPROM_XMC1_lGetGcProgress(handle_ptr, data_ptr, progress_ptr);
+    }
+
+    return((E_EEPROM_XMC1_OPERATION_STATUS_t)status);
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_MountStepEx
+ ********************************************************************************
+ * Summary:
+ * This function shall update the cache entries not yet evaluated after a lazy
+ * mount. At most the given number of blocks is searched in flash per call.
+ *
+ * Parameters:
+ * handle_ptr - Pointer to the handle of the instance
+ * max_blocks - Maximum number of blocks to be searched
+ * pending_ptr - Pointer to the number of blocks still to be searched (can be NULL)
+ *
+ * Return:
+ * E_EEPROM_XMC1_OPERATION_STATUS_t
+ *
+ *******************************************************************************/
+E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_MountStepEx(E_EEPROM_XMC1_t *const handle_ptr,
+                                                           uint32_t max_blocks,
+                                                           uint32_t *const pending_ptr)
+{
+    uint32_t indx;
+    uint32_t pending_blocks;
+    uint32_t resolved_blocks;
+    E_EEPROM_XMC1_DATA_t *data_ptr;
+    E_EEPROM_XMC1_OPERATION_STATUS_t status;
+
+    XMC_ASSERT("E_EEPROM_XMC1_MountStepEx:Invalid Handle Pointer", (handle_ptr != NULL));
+
+    status = E_EEPROM_XMC1_OPERATION_STATUS_NOT_ALLOWED;
+    resolved_blocks = 0U;
+    pending_blocks = 0U;
+
+    /* Check if the E_EEPROM_XMC1_Init API is called, the garbage collection of all regions must be in IDLE state */
+    if ((handle_ptr->state == E_EEPROM_XMC1_STATUS_SUCCESS) &&
+            (E_EEPROM_XMC1_GetStatusEx(handle_ptr) == E_EEPROM_XMC1_STATUS_IDLE))
+    {
+        status = E_EEPROM_XMC1_OPERATION_STATUS_SUCCESS;
+    }
+
+    for (indx = 0U; indx < handle_ptr->block_count; indx++)
+    {
+        /* The entry of a block is searched in the region of the block */
+        data_ptr = E_EEPROM_XMC1_lGetBlockRegion(handle_ptr, indx);
+
+        if (data_ptr->block_info[indx].status.resolved == 0U)
+        {
+            if ((status == E_EEPROM_XMC1_OPERATION_STATUS_SUCCESS) && (resolved_blocks < max_blocks))
+            {
+                E_EEPROM_XMC1_lResolveCacheEntry(handle_ptr, data_ptr, indx);
+                resolved_blocks++;
+            }
+            else
+            {
+                pending_blocks++;
+            }
+        }
+    }
+
+    if (pending_ptr != NULL)
+    {
+        *pending_ptr = pending_blocks;
+    }
+
+    return((E_EEPROM_XMC1_OPERATION_STATUS_t)status);
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_GetStatusEx
+ ********************************************************************************
+ * Summary:
+ * This function shall return the status of the APP. With a region of cold
+ * blocks, a failed region gives FAILURE, else a busy region gives BUSY.
+ *
+ * Parameters:
+ * handle_ptr - Pointer to the handle of the instance
  *
  * Return:
  * E_EEPROM_XMC1_STATUS_t
  *
  *******************************************************************************/
-E_EEPROM_XMC1_STATUS_t E_EEPROM_XMC1_GetStatus(void)
+E_EEPROM_XMC1_STATUS_t E_EEPROM_XMC1_GetStatusEx(E_EEPROM_XMC1_t *const handle_ptr)
 {
+    uint32_t gc_state;
+    uint32_t cold_gc_state;
     E_EEPROM_XMC1_STATUS_t status;
-    E_EEPROM_XMC1_DATA_t *data_ptr;
-    data_ptr = (E_EEPROM_XMC1_DATA_t*)(void*)(e_eeprom_xmc1_handle->data_ptr);
+
+    XMC_ASSERT("E_EEPROM_XMC1_GetStatusEx:Invalid Handle Pointer", (handle_ptr != NULL));
+
+    gc_state = handle_ptr->data_ptr->gc_state;
+
+    /* A failed or busy region of the cold blocks decides the status if the region of the hot blocks is IDLE */
+    if ((handle_ptr->cold_data_ptr != NULL) && (gc_state != E_EEPROM_XMC1_GC_FAIL))
+    {
+        cold_gc_state = handle_ptr->cold_data_ptr->gc_state;
+        if ((gc_state == E_EEPROM_XMC1_GC_IDLE) || (cold_gc_state == E_EEPROM_XMC1_GC_FAIL))
+        {
+            gc_state = cold_gc_state;
+        }
+    }
 
     /* If the GC/InitGC has failed */
-    if (data_ptr->gc_state == E_EEPROM_XMC1_GC_IDLE)
+    if (gc_state == E_EEPROM_XMC1_GC_IDLE)
     {
         status = E_EEPROM_XMC1_STATUS_IDLE;
     }
-    else if (data_ptr->gc_state == E_EEPROM_XMC1_GC_FAIL)
+    else if (gc_state == E_EEPROM_XMC1_GC_FAIL)
     {
         status = E_EEPROM_XMC1_STATUS_FAILURE;
     }
@@ -597,36 +1106,45 @@ E_EEPROM_XMC1_STATUS_t E_EEPROM_XMC1_GetStatus(void)
 }
 
 /*******************************************************************************
- * Function Name: E_EEPROM_XMC1_IsGarbageCollectionNeeded
+ * Function Name: E_EEPROM_XMC1_IsGarbageCollectionNeededEx
  ********************************************************************************
  * Summary:
  * This function returns the whether the block can be fit inside the bank or it
  * needs a garbage collection to fit in
  *
  * Parameters:
+ * handle_ptr - Pointer to the handle of the instance
  * block_number
  *
  * Return:
  * bool
  *
  *******************************************************************************/
-bool E_EEPROM_XMC1_IsGarbageCollectionNeeded(uint8_t block_number)
+bool E_EEPROM_XMC1_IsGarbageCollectionNeededEx(E_EEPROM_XMC1_t *const handle_ptr, uint8_t block_number)
 {
     bool status;
     uint32_t flash_blocks;
     uint32_t user_block_index;
     uint32_t remaining_blocks;
     E_EEPROM_XMC1_BLOCK_t *block_ptr;
+    E_EEPROM_XMC1_DATA_t *data_ptr;
+
+    XMC_ASSERT("E_EEPROM_XMC1_IsGarbageCollectionNeededEx:Invalid Handle Pointer", (handle_ptr != NULL));
 
     status = false;
-    user_block_index = E_EEPROM_XMC1_lGetUsrBlockIndex(block_number);
-    block_ptr = e_eeprom_xmc1_handle->block_config_ptr + user_block_index;
+    user_block_index = E_EEPROM_XMC1_lGetUsrBlockIndex(handle_ptr, block_number);
+    block_ptr = handle_ptr->block_config_ptr + user_block_index;
 
     XMC_ASSERT("E_EEPROM_XMC1_IsGarbageCollectionNeeded:Wrong Block Number", (user_block_index  !=
             E_EEPROM_XMC1_LOG_BLOCK_NOT_FOUND));
 
-    flash_blocks = E_EEPROM_XMC1_lGetDFLASHPhysicalBlocks(block_ptr->size);
-    remaining_blocks = E_EEPROM_XMC1_lGetFreeDFLASHBlocks();
+    /* The free space of the region of the block is checked */
+    data_ptr = E_EEPROM_XMC1_lGetBlockRegion(handle_ptr, user_block_index);
+
+    /* A write request does not take the emergency reserve */
+    flash_blocks = E_EEPROM_XMC1_lGetDFLASHPhysicalBlocks(block_ptr->size) +
+            E_EEPROM_XMC1_lGetEmergencyReserveBlocks(handle_ptr);
+    remaining_blocks = E_EEPROM_XMC1_lGetFreeDFLASHBlocks(data_ptr);
 
     if (remaining_blocks < flash_blocks)
     {
@@ -636,43 +1154,169 @@ bool E_EEPROM_XMC1_IsGarbageCollectionNeeded(uint8_t block_number)
     return (status);
 }
 
-#ifdef E_EEPROM_XMC1_CRC_SW_ENABLED
 /*******************************************************************************
- * Function Name: E_EEPROM_XMC1_VerifyBlockCrcStatus
+ * Function Name: E_EEPROM_XMC1_GetSpaceInfoEx
  ********************************************************************************
  * Summary:
- * It reads the complete data block from the flash and compare the CRC from header
- * block with the computed CRC using CRC_SW APP. Read from arbitrary location and
- * limited length is not possible under this API.
+ * Reports the free, live and dead flash blocks of the region of a block and the
+ * free blocks expected after a garbage collection. The live blocks are taken
+ * from the running count, the written blocks from the next free block address.
  *
  * Parameters:
- * block_number  - Number of logical block
- * data_buffer_ptr - Pointer to user data buffer
+ * handle_ptr - Pointer to the handle of the instance
+ * block_number - Number of logical block (Block-ID), selects the region
+ * info_ptr - Pointer to the space information to be filled
  *
  * Return:
  * E_EEPROM_XMC1_OPERATION_STATUS_t
  *
  *******************************************************************************/
-E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_VerifyBlockCrcStatus(uint8_t block_number, uint8_t *data_buffer_ptr)
+E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_GetSpaceInfoEx(E_EEPROM_XMC1_t *const handle_ptr,
+                                                               uint8_t block_number,
+                                                               E_EEPROM_XMC1_SPACE_INFO_t *const info_ptr)
 {
-    uint32_t block_size;
-    uint32_t user_block_index;
+    uint32_t bank;
+    uint32_t written_blocks;
     E_EEPROM_XMC1_DATA_t *data_ptr;
     E_EEPROM_XMC1_OPERATION_STATUS_t status;
 
-    data_ptr = (E_EEPROM_XMC1_DATA_t*)(void*)(e_eeprom_xmc1_handle->data_ptr);
-    user_block_index = (uint32_t)E_EEPROM_XMC1_lGetUsrBlockIndex( block_number);
-    block_size = e_eeprom_xmc1_handle->block_config_ptr[user_block_index].size;
-
-    XMC_ASSERT("E_EEPROM_XMC1_ReadBlockWithCRC:Wrong Block Number", (user_block_index  !=
-            E_EEPROM_XMC1_LOG_BLOCK_NOT_FOUND));
-    XMC_ASSERT("E_EEPROM_XMC1_ReadBlockWithCRC:Invalid Buffer Pointer", (data_buffer_ptr != NULL));
+    XMC_ASSERT("E_EEPROM_XMC1_GetSpaceInfoEx:Invalid Handle Pointer", (handle_ptr != NULL));
+    XMC_ASSERT("E_EEPROM_XMC1_GetSpaceInfo:Wrong Block Number",
+            (E_EEPROM_XMC1_lGetUsrBlockIndex(handle_ptr, block_number) != E_EEPROM_XMC1_LOG_BLOCK_NOT_FOUND));
+    XMC_ASSERT("E_EEPROM_XMC1_GetSpaceInfo:Invalid Info Pointer", (info_ptr != NULL));
+
+    status = E_EEPROM_XMC1_OPERATION_STATUS_NOT_ALLOWED;
+
+    /* The space of the region of the block is reported */
+    data_ptr = E_EEPROM_XMC1_lSelectRegion(handle_ptr, block_number);
+
+    if ((handle_ptr->state == E_EEPROM_XMC1_STATUS_SUCCESS) &&
+            (data_ptr->gc_state == E_EEPROM_XMC1_GC_IDLE))
+    {
+        info_ptr->live_blocks = E_EEPROM_XMC1_lGetLiveFlashBlocks(handle_ptr, data_ptr);
+        info_ptr->free_blocks = E_EEPROM_XMC1_lGetFreeDFLASHBlocks(data_ptr);
+        written_blocks = E_EEPROM_XMC1_BANK_DATA_BLOCKS - info_ptr->free_blocks;
+
+        /* The full segments of a rotating log are written up to their end */
+        for (bank = 0U; bank < E_EEPROM_XMC1_BANK_COUNT; bank++)
+        {
+            if ((E_EEPROM_XMC1_BANK_COUNT > 2U) && (data_ptr->bank_seq[bank] != 0U) &&
+                    (bank != data_ptr->current_bank))
+            {
+                written_blocks += E_EEPROM_XMC1_BANK_DATA_BLOCKS;
+            }
+        }
+
+        info_ptr->gc_free_blocks = E_EEPROM_XMC1_lGetGcFreeBlocks(handle_ptr, data_ptr);
+        info_ptr->dead_blocks = written_blocks - info_ptr->live_blocks;
+        status = E_EEPROM_XMC1_OPERATION_STATUS_SUCCESS;
+    }
+
+    return (status);
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_IdleEx
+ ********************************************************************************
+ * Summary:
+ * This function shall be called in idle time. It collects garbage ahead of the
+ * write requests: below gc_low_watermark a garbage collection is started and
+ * further ones follow until gc_high_watermark is reached or no more space is
+ * gained. Pending deferred erases are completed first. The region of the hot
+ * blocks is served before the region of the cold blocks, each one with the
+ * flash operations left over.
+ *
+ * Parameters:
+ * handle_ptr - Pointer to the handle of the instance
+ * max_operations - Maximum number of flash program/erase operations
+ *
+ * Return:
+ * E_EEPROM_XMC1_OPERATION_STATUS_t
+ *
+ *******************************************************************************/
+E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_IdleEx(E_EEPROM_XMC1_t *const handle_ptr, uint32_t max_operations)
+{
+    uint32_t flash_operations;
+    E_EEPROM_XMC1_DATA_t *data_ptr;
+    E_EEPROM_XMC1_OPERATION_STATUS_t status;
+
+    XMC_ASSERT("E_EEPROM_XMC1_IdleEx:Invalid Handle Pointer", (handle_ptr != NULL));
+    XMC_ASSERT("E_EEPROM_XMC1_Idle:Invalid operations budget", (max_operations != 0U));
+
+    status = E_EEPROM_XMC1_OPERATION_STATUS_NOT_ALLOWED;
+
+    /* Check if the E_EEPROM_XMC1_Init API is called and the policy is configured */
+    if ((handle_ptr->state == E_EEPROM_XMC1_STATUS_SUCCESS) &&
+            (handle_ptr->gc_low_watermark != 0U))
+    {
+        status = E_EEPROM_XMC1_OPERATION_STATUS_SUCCESS;
+
+        data_ptr = handle_ptr->data_ptr;
+        flash_operations = E_EEPROM_XMC1_lIdleRegion(handle_ptr, data_ptr, max_operations);
+        if (data_ptr->gc_state == E_EEPROM_XMC1_GC_FAIL)
+        {
+            status = E_EEPROM_XMC1_OPERATION_STATUS_FAILURE;
+        }
+
+        if ((handle_ptr->cold_data_ptr != NULL) && (flash_operations < max_operations))
+        {
+            data_ptr = handle_ptr->cold_data_ptr;
+            (void)E_EEPROM_XMC1_lIdleRegion(handle_ptr, data_ptr, max_operations - flash_operations);
+            if (data_ptr->gc_state == E_EEPROM_XMC1_GC_FAIL)
+            {
+                status = E_EEPROM_XMC1_OPERATION_STATUS_FAILURE;
+            }
+        }
+    }
+
+    return (status);
+}
+
+#ifdef E_EEPROM_XMC1_CRC_SW_ENABLED
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_VerifyBlockCrcStatusEx
+ ********************************************************************************
+ * Summary:
+ * It reads the complete data block from the flash and compare the CRC from header
+ * block with the computed CRC using CRC_SW APP. Read from arbitrary location and
+ * limited length is not possible under this API.
+ *
+ * Parameters:
+ * handle_ptr - Pointer to the handle of the instance
+ * block_number  - Number of logical block
+ * data_buffer_ptr - Pointer to user data buffer
+ *
+ * Return:
+ * E_EEPROM_XMC1_OPERATION_STATUS_t
+ *
+ *******************************************************************************/
+E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_VerifyBlockCrcStatusEx(E_EEPROM_XMC1_t *const handle_ptr,
+                                                                      uint8_t block_number,
+                                                                      uint8_t *data_buffer_ptr)
+{
+    uint32_t block_size;
+    uint32_t user_block_index;
+    E_EEPROM_XMC1_DATA_t *data_ptr;
+    E_EEPROM_XMC1_OPERATION_STATUS_t status;
+
+    XMC_ASSERT("E_EEPROM_XMC1_VerifyBlockCrcStatusEx:Invalid Handle Pointer", (handle_ptr != NULL));
+
+    data_ptr = E_EEPROM_XMC1_lSelectRegion(handle_ptr, block_number);
+    user_block_index = (uint32_t)E_EEPROM_XMC1_lGetUsrBlockIndex(handle_ptr, block_number);
+    block_size = handle_ptr->block_config_ptr[user_block_index].size;
+
+    XMC_ASSERT("E_EEPROM_XMC1_ReadBlockWithCRC:Wrong Block Number", (user_block_index  !=
+            E_EEPROM_XMC1_LOG_BLOCK_NOT_FOUND));
+    XMC_ASSERT("E_EEPROM_XMC1_ReadBlockWithCRC:Invalid Buffer Pointer", (data_buffer_ptr != NULL));
 
     status = E_EEPROM_XMC1_OPERATION_STATUS_NOT_ALLOWED;
 
     /*Execute only if GC process is in IDLE state */
     if ((data_ptr->gc_state) == E_EEPROM_XMC1_GC_IDLE)
     {
+        /* Search the block in flash on the first access after a lazy mount */
+        E_EEPROM_XMC1_lResolveCacheEntry(handle_ptr, data_ptr, user_block_index);
+
         if (data_ptr->block_info[user_block_index].status.valid == 0U) /* If cache says Inconsistent */
         {
             status = E_EEPROM_XMC1_OPERATION_STATUS_INVALID_BLOCK;
@@ -685,13 +1329,14 @@ E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_VerifyBlockCrcStatus(uint8_t bloc
         {
             data_ptr->read_start_address = data_ptr->block_info[user_block_index].address ;
             /* Call local function to read the specified block of data from flash */
-            status = (E_EEPROM_XMC1_OPERATION_STATUS_t)E_EEPROM_XMC1_lReadBlockContents(data_buffer_ptr,
+            status = (E_EEPROM_XMC1_OPERATION_STATUS_t)E_EEPROM_XMC1_lReadBlockContents(data_ptr, data_buffer_ptr,
                     block_size , 0U);
 
             if (status == E_EEPROM_XMC1_OPERATION_STATUS_SUCCESS)
             {
                 /* Call local function to cross check the CRC, No ECC check done again for the CRC read function  */
-                status = (E_EEPROM_XMC1_OPERATION_STATUS_t)E_EEPROM_XMC1_lReadBlockCrcStatus(block_number, data_buffer_ptr,
+                status = (E_EEPROM_XMC1_OPERATION_STATUS_t)E_EEPROM_XMC1_lReadBlockCrcStatus(handle_ptr, data_ptr,
+                        block_number, data_buffer_ptr,
                         block_size);
             }
             else
@@ -705,13 +1350,14 @@ E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_VerifyBlockCrcStatus(uint8_t bloc
 #endif
 
 /*******************************************************************************
- * Function Name: E_EEPROM_XMC1_GetPreviousData
+ * Function Name: E_EEPROM_XMC1_GetPreviousDataEx
  ********************************************************************************
  * Summary:
  * This function shall read the just previous copy of the particular block when
  * requested. This function is used commonly when the latest copy gets corrupted.
  *
  * Parameters:
+ * handle_ptr - Pointer to the handle of the instance
  * block_number   - Number of logical block
  * offset       - Start Location for Read start
  * data_buffer_ptr - Pointer to user data buffer
@@ -721,10 +1367,11 @@ E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_VerifyBlockCrcStatus(uint8_t bloc
  * E_EEPROM_XMC1_STATUS_t
  *
  *******************************************************************************/
-E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_GetPreviousData(uint8_t block_number,
-        uint32_t offset,
-        uint8_t *data_buffer_ptr,
-        uint32_t length)
+E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_GetPreviousDataEx(E_EEPROM_XMC1_t *const handle_ptr,
+                                                                 uint8_t block_number,
+                                                                 uint32_t offset,
+                                                                 uint8_t *data_buffer_ptr,
+                                                                 uint32_t length)
 {
     uint32_t block_size;
     uint32_t read_start_addr;
@@ -732,9 +1379,11 @@ E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_GetPreviousData(uint8_t block_num
     E_EEPROM_XMC1_DATA_t *data_ptr;
     E_EEPROM_XMC1_OPERATION_STATUS_t status;
 
-    data_ptr = (E_EEPROM_XMC1_DATA_t*)(void*)(e_eeprom_xmc1_handle->data_ptr);
-    user_block_index = E_EEPROM_XMC1_lGetUsrBlockIndex(block_number);
-    block_size = e_eeprom_xmc1_handle->block_config_ptr[user_block_index].size;
+    XMC_ASSERT("E_EEPROM_XMC1_GetPreviousDataEx:Invalid Handle Pointer", (handle_ptr != NULL));
+
+    data_ptr = E_EEPROM_XMC1_lSelectRegion(handle_ptr, block_number);
+    user_block_index = E_EEPROM_XMC1_lGetUsrBlockIndex(handle_ptr, block_number);
+    block_size = handle_ptr->block_config_ptr[user_block_index].size;
 
     XMC_ASSERT("E_EEPROM_XMC1_GetPreviousData:Wrong Block Number", (user_block_index  !=
             E_EEPROM_XMC1_LOG_BLOCK_NOT_FOUND));
@@ -743,15 +1392,18 @@ E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_GetPreviousData(uint8_t block_num
     /*Execute only if GC process is in IDLE state */
     if ((data_ptr->gc_state == E_EEPROM_XMC1_GC_IDLE) && (((uint32_t)offset + length) <= block_size))
     {
+        /* Search the block in flash on the first access after a lazy mount */
+        E_EEPROM_XMC1_lResolveCacheEntry(handle_ptr, data_ptr, user_block_index);
 
-        read_start_addr = E_EEPROM_XMC1_lGetPrevData(block_number);
+        read_start_addr = E_EEPROM_XMC1_lGetPrevData(handle_ptr, data_ptr, block_number);
 
         if (read_start_addr != 0U )
         {
             data_ptr->read_start_address =  read_start_addr;
 
             /* Call local function to read the specified block of data from flash */
-            status = (E_EEPROM_XMC1_OPERATION_STATUS_t)E_EEPROM_XMC1_lReadBlockContents(data_buffer_ptr, length , offset);
+            status = (E_EEPROM_XMC1_OPERATION_STATUS_t)E_EEPROM_XMC1_lReadBlockContents(data_ptr, data_buffer_ptr,
+                    length , offset);
             if ((uint32_t)status != 0U)
             {
                 status = E_EEPROM_XMC1_OPERATION_STATUS_FAILURE;
@@ -771,2046 +1423,5397 @@ E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_GetPreviousData(uint8_t block_num
 }
 
 /*******************************************************************************
- * Function Name: E_EEPROM_XMC1_lGetPrevData
+ * Function Name: E_EEPROM_XMC1_Write
  ********************************************************************************
  * Summary:
- * This function will traverse through the bank and find the previous copy of
- * the block if existing.
+ * Calls E_EEPROM_XMC1_WriteEx() for the instance of the last E_EEPROM_XMC1_Init().
  *
  * Parameters:
- * block_number  - User block number / ID
+ * block_number  - Number of logical block (Block-ID)
+ * data_buffer_ptr - Pointer to user data buffer
  *
  * Return:
- * uint32_t - Flash NVM_STATUS register value
+ * E_EEPROM_XMC1_OPERATION_STATUS_t
  *
  *******************************************************************************/
-static uint32_t E_EEPROM_XMC1_lGetPrevData(uint8_t block_number)
+E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_Write(uint8_t block_number, uint8_t *data_buffer_ptr)
 {
-    uint32_t block_size;
-    uint32_t block_index;
-    uint32_t data_sec_start_addr;
-    uint32_t expected_block_count;
-    uint32_t block_read_start_addr;
-    E_EEPROM_XMC1_DATA_t *data_ptr;
-
-    data_ptr = (E_EEPROM_XMC1_DATA_t*)(void*)(e_eeprom_xmc1_handle->data_ptr);
-
-    /* Get the block details */
-    block_index = (uint32_t)E_EEPROM_XMC1_lGetUsrBlockIndex(block_number);
-    block_size = e_eeprom_xmc1_handle->block_config_ptr[block_index].size;
-    expected_block_count = E_EEPROM_XMC1_lGetDFLASHPhysicalBlocks(block_size);
-
-    /* Find the data bank starting address from current Bank to decide when to stop reading of blocks*/
-    if (data_ptr->current_bank == 0U)
-    {
-        data_sec_start_addr = E_EEPROM_XMC1_FLASH_BANK0_BASE + E_EEPROM_XMC1_DATA_BLOCK_OFFSET;
-    }
-    else
-    {
-        data_sec_start_addr = E_EEPROM_XMC1_FLASH_BANK1_BASE + E_EEPROM_XMC1_DATA_BLOCK_OFFSET;
-    }
-
-    block_read_start_addr = data_ptr->block_info[block_index].address;
-
-    if (block_read_start_addr >= (data_sec_start_addr + E_EEPROM_XMC1_FLASH_BLOCK_SIZE))
-    {
-        block_read_start_addr = E_EEPROM_XMC1_lSearchBlockCopy(block_number,
-                block_read_start_addr - E_EEPROM_XMC1_FLASH_BLOCK_SIZE,
-                data_sec_start_addr);
-
-
-        if ((block_read_start_addr < data_sec_start_addr) ||
-                (data_ptr->block_result.status.consistent != 1U) ||
-                (data_ptr->block_result.block_count != expected_block_count) ||
-                (data_ptr->block_result.status.valid != 1U))
-        {
-            block_read_start_addr = 0U;  /* No Previous copy of block exist*/
-        }
-    }
-    else
-    {
-        block_read_start_addr = 0U;  /* No Previous copy of block can exist*/
-    }
-
-    return (block_read_start_addr);
+    return (E_EEPROM_XMC1_WriteEx(e_eeprom_xmc1_handle, block_number, data_buffer_ptr));
 }
 
 /*******************************************************************************
- * Function Name: E_EEPROM_XMC1_lSearchBlockCopy
+ * Function Name: E_EEPROM_XMC1_Read
  ********************************************************************************
  * Summary:
- * This function reads the block header bytes and compare the block number to
- * find the matching block
+ * Calls E_EEPROM_XMC1_ReadEx() for the instance of the last E_EEPROM_XMC1_Init().
  *
  * Parameters:
- * block_number  - User block number / ID
+ * block_number   - Number of logical block
+ * offset       - Start Location for Read start
+ * data_buffer_ptr - Pointer to user data buffer
+ * length       - End Location for read completion
  *
  * Return:
- * uint32_t - Flash NVM_STATUS register value
+ * E_EEPROM_XMC1_OPERATION_STATUS_t
  *
  *******************************************************************************/
-static uint32_t E_EEPROM_XMC1_lSearchBlockCopy(uint8_t required_block_number,
-        uint32_t read_addr,
-        uint32_t data_sec_start_addr)
+E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_Read(uint8_t block_number,
+        uint32_t offset,
+        uint8_t *data_buffer_ptr,
+        uint32_t length)
 {
-    uint32_t header_word;
-    uint32_t block_count;
-    uint8_t block_status;
-    uint8_t read_block_number;
-    uint32_t block_start_address;
-    uint32_t is_all_blocks_clean;
-    E_EEPROM_XMC1_DATA_t *data_ptr;
-    E_EEPROM_XMC1_BLOCK_HEADER_t* block_header_ptr;
-
-    data_ptr = (E_EEPROM_XMC1_DATA_t*)(void*)(e_eeprom_xmc1_handle->data_ptr);
-
-    block_count = 0U;
-    block_start_address = 0U;
-    is_all_blocks_clean = 1U;
-    data_ptr->block_result.status.consistent = 0U;
-    data_ptr->block_result.status.valid = 0U;
-    data_ptr->block_result.block_count = 0U;
-
-    /* Loop until the first block address and check if any block number is matching the required block number*/
-    while ((data_sec_start_addr <= read_addr) && (block_start_address == 0U))
-    {
-        /* Clear all error status flags before flash operation*/
-        XMC_FLASH_ClearStatus();
-
-        /* Read the header word */
-        header_word = E_EEPROM_XMC1_lReadSingleWord(read_addr);
-
-        block_header_ptr = (E_EEPROM_XMC1_BLOCK_HEADER_t*)(void *)(&header_word);
-        read_block_number = block_header_ptr->block_number;
-        block_status = block_header_ptr->status;
-
-        /*Check whether the block number is matching the required block number*/
-        if (read_block_number == required_block_number)
-        {
-            block_count++;
-
-            /* Check if any ECC error in the header */
-            if ( ( E_EEPROM_XMC1_lGetFlashStatus() & (uint32_t)XMC_FLASH_STATUS_ECC2_READ_ERROR ) != 0U )
-            {
-                is_all_blocks_clean = 0U;
-            }
-            /* Check if block header is of the starting block */
-            if (block_status & E_EEPROM_XMC1_START_BIT)
-            {
-                if ( is_all_blocks_clean == 1U )
-                {
-                    data_ptr->block_result.status.consistent = 1U;
-                }
-
-                if (block_status & (uint8_t)E_EEPROM_XMC1_VALID_BIT)
-                {
-                    data_ptr->block_result.status.valid = 1U;
-                }
-
-                data_ptr->block_result.block_count = block_count;
-                block_start_address = read_addr;
-            }
-            else
-            {
-                read_addr -= E_EEPROM_XMC1_FLASH_BLOCK_SIZE;
-            }
-        }
-        else
-        {
-            read_addr -= E_EEPROM_XMC1_FLASH_BLOCK_SIZE;
-        }
-    }
-    return(block_start_address);
+    return (E_EEPROM_XMC1_ReadEx(e_eeprom_xmc1_handle, block_number, offset, data_buffer_ptr, length));
 }
 
 /*******************************************************************************
- * Function Name: E_EEPROM_XMC1_lInitGc
+ * Function Name: E_EEPROM_XMC1_StartGarbageCollection
  ********************************************************************************
  * Summary:
- * his function shall detect if there was any interruption in the ongoing running
- * state (Read/Write/GC). If yes, then this routine shall decide to run a state
- * machine to bring back the emulation to normal state.
+ * Calls E_EEPROM_XMC1_StartGarbageCollectionEx() for the instance of the last E_EEPROM_XMC1_Init().
  *
  * Parameters:
- * marker_dirty_state  - Dirty state
+ * void
  *
  * Return:
- * void
+ * E_EEPROM_XMC1_OPERATION_STATUS_t
  *
  *******************************************************************************/
-static void E_EEPROM_XMC1_lInitGc(const uint32_t marker_dirty_state)
+E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_StartGarbageCollection(void)
 {
-    E_EEPROM_XMC1_DATA_t *data_ptr;
-    data_ptr = (E_EEPROM_XMC1_DATA_t*)(void*)(e_eeprom_xmc1_handle->data_ptr);
-
-    if ( marker_dirty_state == E_EEPROM_XMC1_BOTH_BANKS_INVALID )  /* If both Bank state markers are in dirty state */
-    {
-        data_ptr->init_gc_state = E_EEPROM_XMC1_MB_DIRTY;
-        E_EEPROM_XMC1_lInitllegalStateMachine();
-    }
-    else if ( marker_dirty_state == E_EEPROM_XMC1_BANK0_INVALID )  /* If Only Bank0 state marker is in dirty state */
-    {
-        data_ptr->init_gc_state &= E_EEPROM_XMC1_INIT_STATE_0F;
-        data_ptr->init_gc_state |= E_EEPROM_XMC1_INIT_STATE_D0;
-        E_EEPROM_XMC1_lInitDirtyStateMachine();
-    }
-    else if ( marker_dirty_state == E_EEPROM_XMC1_BANK1_INVALID )  /* If Only Bank1 state marker is in dirty state */
-    {
-        data_ptr->init_gc_state &= E_EEPROM_XMC1_INIT_STATE_F0;
-        data_ptr->init_gc_state |= E_EEPROM_XMC1_INIT_STATE_0D;
-        E_EEPROM_XMC1_lInitDirtyStateMachine();
-    }
-    else                                      /* If both Bank state markers have valid state */
-    {
-        E_EEPROM_XMC1_lInitNormalStateMachine();
-    }
+    return (E_EEPROM_XMC1_StartGarbageCollectionEx(e_eeprom_xmc1_handle));
 }
 
 /*******************************************************************************
- * Function Name: E_EEPROM_XMC1_lInitllegalStateMachine
+ * Function Name: E_EEPROM_XMC1_GcStep
  ********************************************************************************
  * Summary:
- * This function shall erase all flash and start from fresh depending upon the
- * user configuration
+ * Calls E_EEPROM_XMC1_GcStepEx() for the instance of the last E_EEPROM_XMC1_Init().
  *
  * Parameters:
- * void
+ * max_operations - Maximum number of flash program/erase operations
+ * progress_ptr - Pointer to the progress structure, can be NULL
  *
  * Return:
- * void
+ * E_EEPROM_XMC1_OPERATION_STATUS_t
  *
  *******************************************************************************/
-static void E_EEPROM_XMC1_lInitllegalStateMachine(void)
+E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_GcStep(uint32_t max_operations,
+        E_EEPROM_XMC1_GC_PROGRESS_t *const progress_ptr)
 {
-    E_EEPROM_XMC1_DATA_t *data_ptr;
-    data_ptr = (E_EEPROM_XMC1_DATA_t*)(void*)(e_eeprom_xmc1_handle->data_ptr);
+    return (E_EEPROM_XMC1_GcStepEx(e_eeprom_xmc1_handle, max_operations, progress_ptr));
+}
 
-    /*
-     * Any state apart from the normal states is considered as Illegal state. Next operation = Start Prepare DFlash
-     * (Only if the configuration option Erase all is 1U) IF Configuration Option is 0U, Next Operation = Fail State
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_MountStep
+ ********************************************************************************
+ * Summary:
+ * Calls E_EEPROM_XMC1_MountStepEx() for the instance of the last E_EEPROM_XMC1_Init().
+ *
+ * Parameters:
+ * max_blocks - Maximum number of blocks searched by this call
+ * pending_ptr - Pointer to the number of blocks still to be searched, can be NULL
+ *
+ * Return:
+ * E_EEPROM_XMC1_OPERATION_STATUS_t
+ *
+ *******************************************************************************/
+E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_MountStep(uint32_t max_blocks, uint32_t *const pending_ptr)
+{
+    return (E_EEPROM_XMC1_MountStepEx(e_eeprom_xmc1_handle, max_blocks, pending_ptr));
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_InvalidateBlock
+ ********************************************************************************
+ * Summary:
+ * Calls E_EEPROM_XMC1_InvalidateBlockEx() for the instance of the last E_EEPROM_XMC1_Init().
+ *
+ * Parameters:
+ * block_number  - Number of logical block (Block-ID)
+ *
+ * Return:
+ * E_EEPROM_XMC1_OPERATION_STATUS_t
+ *
+ *******************************************************************************/
+E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_InvalidateBlock(uint8_t block_number)
+{
+    return (E_EEPROM_XMC1_InvalidateBlockEx(e_eeprom_xmc1_handle, block_number));
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_WriteMulti
+ ********************************************************************************
+ * Summary:
+ * Calls E_EEPROM_XMC1_WriteMultiEx() for the instance of the last E_EEPROM_XMC1_Init().
+ *
+ * Parameters:
+ * req_ptr - Pointer to the array of write/invalidate requests
+ * req_count - Number of requests
+ *
+ * Return:
+ * E_EEPROM_XMC1_OPERATION_STATUS_t
+ *
+ *******************************************************************************/
+E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_WriteMulti(const E_EEPROM_XMC1_WRITE_REQ_t *const req_ptr,
+        uint32_t req_count)
+{
+    return (E_EEPROM_XMC1_WriteMultiEx(e_eeprom_xmc1_handle, req_ptr, req_count));
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_EmergencyWrite
+ ********************************************************************************
+ * Summary:
+ * Calls E_EEPROM_XMC1_EmergencyWriteEx() for the instance of the last E_EEPROM_XMC1_Init().
+ *
+ * Parameters:
+ * block_number  - Number of logical block (Block-ID)
+ * data_buffer_ptr - Pointer to user data buffer
+ *
+ * Return:
+ * E_EEPROM_XMC1_OPERATION_STATUS_t
+ *
+ *******************************************************************************/
+E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_EmergencyWrite(uint8_t block_number, uint8_t *data_buffer_ptr)
+{
+    return (E_EEPROM_XMC1_EmergencyWriteEx(e_eeprom_xmc1_handle, block_number, data_buffer_ptr));
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_GetStatus
+ ********************************************************************************
+ * Summary:
+ * Calls E_EEPROM_XMC1_GetStatusEx() for the instance of the last E_EEPROM_XMC1_Init().
+ *
+ * Parameters:
+ * void
+ *
+ * Return:
+ * E_EEPROM_XMC1_STATUS_t
+ *
+ *******************************************************************************/
+E_EEPROM_XMC1_STATUS_t E_EEPROM_XMC1_GetStatus(void)
+{
+    return (E_EEPROM_XMC1_GetStatusEx(e_eeprom_xmc1_handle));
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_IsGarbageCollectionNeeded
+ ********************************************************************************
+ * Summary:
+ * Calls E_EEPROM_XMC1_IsGarbageCollectionNeededEx() for the instance of the last E_EEPROM_XMC1_Init().
+ *
+ * Parameters:
+ * block_number  - Number of logical block (Block-ID)
+ *
+ * Return:
+ * bool
+ *
+ *******************************************************************************/
+bool E_EEPROM_XMC1_IsGarbageCollectionNeeded(uint8_t block_number)
+{
+    return (E_EEPROM_XMC1_IsGarbageCollectionNeededEx(e_eeprom_xmc1_handle, block_number));
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_GetSpaceInfo
+ ********************************************************************************
+ * Summary:
+ * Calls E_EEPROM_XMC1_GetSpaceInfoEx() for the instance of the last E_EEPROM_XMC1_Init().
+ *
+ * Parameters:
+ * block_number  - Number of logical block (Block-ID)
+ * info_ptr - Pointer to the space information to be filled
+ *
+ * Return:
+ * E_EEPROM_XMC1_OPERATION_STATUS_t
+ *
+ *******************************************************************************/
+E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_GetSpaceInfo(uint8_t block_number,
+                                                             E_EEPROM_XMC1_SPACE_INFO_t *const info_ptr)
+{
+    return (E_EEPROM_XMC1_GetSpaceInfoEx(e_eeprom_xmc1_handle, block_number, info_ptr));
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_Idle
+ ********************************************************************************
+ * Summary:
+ * Calls E_EEPROM_XMC1_IdleEx() for the instance of the last E_EEPROM_XMC1_Init().
+ *
+ * Parameters:
+ * max_operations - Maximum number of flash program/erase operations
+ *
+ * Return:
+ * E_EEPROM_XMC1_OPERATION_STATUS_t
+ *
+ *******************************************************************************/
+E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_Idle(uint32_t max_operations)
+{
+    return (E_EEPROM_XMC1_IdleEx(e_eeprom_xmc1_handle, max_operations));
+}
+
+#ifdef E_EEPROM_XMC1_CRC_SW_ENABLED
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_VerifyBlockCrcStatus
+ ********************************************************************************
+ * Summary:
+ * Calls E_EEPROM_XMC1_VerifyBlockCrcStatusEx() for the instance of the last E_EEPROM_XMC1_Init().
+ *
+ * Parameters:
+ * block_number  - Number of logical block (Block-ID)
+ * data_buffer_ptr - Pointer to user data buffer
+ *
+ * Return:
+ * E_EEPROM_XMC1_OPERATION_STATUS_t
+ *
+ *******************************************************************************/
+E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_VerifyBlockCrcStatus(uint8_t block_number, uint8_t *data_buffer_ptr)
+{
+    return (E_EEPROM_XMC1_VerifyBlockCrcStatusEx(e_eeprom_xmc1_handle, block_number, data_buffer_ptr));
+}
+#endif
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_GetPreviousData
+ ********************************************************************************
+ * Summary:
+ * Calls E_EEPROM_XMC1_GetPreviousDataEx() for the instance of the last E_EEPROM_XMC1_Init().
+ *
+ * Parameters:
+ * block_number   - Number of logical block
+ * offset       - Start Location for Read start
+ * data_buffer_ptr - Pointer to user data buffer
+ * length       - End Location for read completion
+ *
+ * Return:
+ * E_EEPROM_XMC1_OPERATION_STATUS_t
+ *
+ *******************************************************************************/
+E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_GetPreviousData(uint8_t block_number,
+        uint32_t offset,
+        uint8_t *data_buffer_ptr,
+        uint32_t length)
+{
+    return (E_EEPROM_XMC1_GetPreviousDataEx(e_eeprom_xmc1_handle, block_number, offset, data_buffer_ptr, length));
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lGetPrevData
+ ********************************************************************************
+ * Summary:
+ * This function will traverse through the bank and find the previous copy of
+ * the block if existing.
+ *
+ * Parameters:
+ * handle_ptr - Pointer to the handle of the instance
+ * data_ptr - State of the region the request operates on
+ * block_number  - User block number / ID
+ *
+ * Return:
+ * uint32_t - Flash NVM_STATUS register value
+ *
+ *******************************************************************************/
+static uint32_t E_EEPROM_XMC1_lGetPrevData(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr,
+        uint8_t block_number)
+{
+    uint32_t bank;
+    uint32_t block_size;
+    uint32_t block_index;
+    uint32_t data_sec_start_addr;
+    uint32_t expected_block_count;
+    uint32_t block_read_start_addr;
+
+    /* Get the block details */
+    block_index = (uint32_t)E_EEPROM_XMC1_lGetUsrBlockIndex(handle_ptr, block_number);
+    block_size = handle_ptr->block_config_ptr[block_index].size;
+    expected_block_count = E_EEPROM_XMC1_lGetDFLASHPhysicalBlocks(block_size);
+
+    block_read_start_addr = data_ptr->block_info[block_index].address;
+
+    /*
+     * Find the data bank starting address from current Bank to decide when to stop reading of blocks. In a
+     * rotating log the latest copy can be in an older segment, its segment is searched.
      */
-    if (e_eeprom_xmc1_handle->erase_all_auto_recovery == 1U)
+    bank = data_ptr->current_bank;
+    if ((E_EEPROM_XMC1_BANK_COUNT > 2U) && (block_read_start_addr >= E_EEPROM_XMC1_BANK0_BASE) &&
+            (block_read_start_addr < E_EEPROM_XMC1_BANK_BASE(E_EEPROM_XMC1_BANK_COUNT)))
+    {
+        bank = (block_read_start_addr - E_EEPROM_XMC1_BANK0_BASE) / E_EEPROM_XMC1_BANK_SIZE;
+    }
+    data_sec_start_addr = E_EEPROM_XMC1_BANK_BASE(bank) + E_EEPROM_XMC1_DATA_BLOCK_OFFSET;
+
+    if (block_read_start_addr >= (data_sec_start_addr + E_EEPROM_XMC1_FLASH_BLOCK_SIZE))
+    {
+        block_read_start_addr = E_EEPROM_XMC1_lSearchBlockCopy(data_ptr, block_number,
+                block_read_start_addr - E_EEPROM_XMC1_FLASH_BLOCK_SIZE,
+                data_sec_start_addr);
+
+        if ((block_read_start_addr < data_sec_start_addr) ||
+                (data_ptr->block_result.status.consistent != 1U) ||
+                (data_ptr->block_result.block_count != expected_block_count) ||
+                (data_ptr->block_result.status.valid != 1U))
+        {
+            block_read_start_addr = 0U;  /* No Previous copy of block exist*/
+        }
+    }
+    else
+    {
+        block_read_start_addr = 0U;  /* No Previous copy of block can exist*/
+    }
+
+    return (block_read_start_addr);
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lSearchBlockCopy
+ ********************************************************************************
+ * Summary:
+ * This function reads the block header bytes and compare the block number to
+ * find the matching block
+ *
+ * Parameters:
+ * data_ptr - State of the region the request operates on
+ * block_number  - User block number / ID
+ *
+ * Return:
+ * uint32_t - Flash NVM_STATUS register value
+ *
+ *******************************************************************************/
+static uint32_t E_EEPROM_XMC1_lSearchBlockCopy(E_EEPROM_XMC1_DATA_t *const data_ptr, uint8_t required_block_number,
+        uint32_t read_addr,
+        uint32_t data_sec_start_addr)
+{
+    uint32_t header_word;
+    uint32_t block_count;
+    uint8_t block_status;
+    uint8_t read_block_number;
+    uint32_t block_start_address;
+    uint32_t is_all_blocks_clean;
+    E_EEPROM_XMC1_BLOCK_HEADER_t* block_header_ptr;
+
+    block_count = 0U;
+    block_start_address = 0U;
+    is_all_blocks_clean = 1U;
+    data_ptr->block_result.status.consistent = 0U;
+    data_ptr->block_result.status.valid = 0U;
+    data_ptr->block_result.status.crc = 0U;
+    data_ptr->block_result.block_count = 0U;
+
+    /* Loop until the first block address and check if any block number is matching the required block number*/
+    while ((data_sec_start_addr <= read_addr) && (block_start_address == 0U))
+    {
+        /* Clear all error status flags before flash operation*/
+        XMC_FLASH_ClearStatus();
+
+        /* Read the header word */
+        header_word = E_EEPROM_XMC1_lReadSingleWord(read_addr);
+
+        block_header_ptr = (E_EEPROM_XMC1_BLOCK_HEADER_t*)(void *)(&header_word);
+        read_block_number = block_header_ptr->block_number;
+        block_status = block_header_ptr->status;
+
+        /*Check whether the block number is matching the required block number*/
+        if (read_block_number == required_block_number)
+        {
+            block_count++;
+
+            /* Check if any ECC error in the header */
+            if ( ( E_EEPROM_XMC1_lGetFlashStatus() & (uint32_t)XMC_FLASH_STATUS_ECC2_READ_ERROR ) != 0U )
+            {
+                is_all_blocks_clean = 0U;
+            }
+            /* Check if block header is of the starting block */
+            if (block_status & E_EEPROM_XMC1_START_BIT)
+            {
+                if ( is_all_blocks_clean == 1U )
+                {
+                    data_ptr->block_result.status.consistent = 1U;
+                }
+
+                if (block_status & (uint8_t)E_EEPROM_XMC1_VALID_BIT)
+                {
+                    data_ptr->block_result.status.valid = 1U;
+
+                    if (block_status & (uint8_t)E_EEPROM_XMC1_CRC_BIT)
+                    {
+                        data_ptr->block_result.status.crc = 1U;
+                    }
+                }
+
+                data_ptr->block_result.block_count = block_count;
+                block_start_address = read_addr;
+            }
+            else
+            {
+                read_addr -= E_EEPROM_XMC1_FLASH_BLOCK_SIZE;
+            }
+        }
+        else
+        {
+            read_addr -= E_EEPROM_XMC1_FLASH_BLOCK_SIZE;
+        }
+    }
+    return(block_start_address);
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lInitGc
+ ********************************************************************************
+ * Summary:
+ * his function shall detect if there was any interruption in the ongoing running
+ * state (Read/Write/GC). If yes, then this routine shall decide to run a state
+ * machine to bring back the emulation to normal state.
+ *
+ * Parameters:
+ * handle_ptr - Pointer to the handle of the instance
+ * data_ptr - State of the region the request operates on
+ * marker_dirty_state  - Dirty state
+ *
+ * Return:
+ * void
+ *
+ *******************************************************************************/
+static void E_EEPROM_XMC1_lInitGc(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr,
+        const uint32_t marker_dirty_state)
+{
+    if ( marker_dirty_state == E_EEPROM_XMC1_BOTH_BANKS_INVALID )  /* If both Bank state markers are in dirty state */
+    {
+        data_ptr->init_gc_state = E_EEPROM_XMC1_MB_DIRTY;
+        E_EEPROM_XMC1_lInitllegalStateMachine(handle_ptr, data_ptr);
+    }
+    else if ( marker_dirty_state == E_EEPROM_XMC1_BANK0_INVALID )  /* If Only Bank0 state marker is in dirty state */
+    {
+        data_ptr->init_gc_state &= E_EEPROM_XMC1_INIT_STATE_0F;
+        data_ptr->init_gc_state |= E_EEPROM_XMC1_INIT_STATE_D0;
+        E_EEPROM_XMC1_lInitDirtyStateMachine(handle_ptr, data_ptr);
+    }
+    else if ( marker_dirty_state == E_EEPROM_XMC1_BANK1_INVALID )  /* If Only Bank1 state marker is in dirty state */
+    {
+        data_ptr->init_gc_state &= E_EEPROM_XMC1_INIT_STATE_F0;
+        data_ptr->init_gc_state |= E_EEPROM_XMC1_INIT_STATE_0D;
+        E_EEPROM_XMC1_lInitDirtyStateMachine(handle_ptr, data_ptr);
+    }
+    else                                      /* If both Bank state markers have valid state */
+    {
+        E_EEPROM_XMC1_lInitNormalStateMachine(handle_ptr, data_ptr);
+    }
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lInitllegalStateMachine
+ ********************************************************************************
+ * Summary:
+ * This function shall erase all flash and start from fresh depending upon the
+ * user configuration
+ *
+ * Parameters:
+ * handle_ptr - Pointer to the handle of the instance
+ * data_ptr - State of the region the request operates on
+ *
+ * Return:
+ * void
+ *
+ *******************************************************************************/
+static void E_EEPROM_XMC1_lInitllegalStateMachine(E_EEPROM_XMC1_t *const handle_ptr,
+        E_EEPROM_XMC1_DATA_t *const data_ptr)
+{
+    /*
+     * Any state apart from the normal states is considered as Illegal state. Next operation = Start Prepare DFlash
+     * (Only if the configuration option Erase all is 1U) IF Configuration Option is 0U, Next Operation = Fail State
+     */
+    if (handle_ptr->erase_all_auto_recovery == 1U)
+    {
+        /* Change the current Bank to Bank0 */
+        data_ptr->current_bank = 0U;
+        E_EEPROM_XMC1_lInitGcNormalStates(handle_ptr, data_ptr, E_EEPROM_XMC1_PREPFLASH_FF, 1U);
+    }
+    else
+    {
+        data_ptr->gc_state = E_EEPROM_XMC1_GC_FAIL;
+    }
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lInitDirtyStateMachine
+ ********************************************************************************
+ * Summary:
+ * This function shall address the dirty state recovery mechanism by erasing and
+ * rewriting states
+ *
+ * Parameters:
+ * handle_ptr - Pointer to the handle of the instance
+ * data_ptr - State of the region the request operates on
+ *
+ * Return:
+ * void
+ *
+ *******************************************************************************/
+static void E_EEPROM_XMC1_lInitDirtyStateMachine(E_EEPROM_XMC1_t *const handle_ptr,
+        E_EEPROM_XMC1_DATA_t *const data_ptr)
+{
+    switch (data_ptr->init_gc_state)
+    {
+    case E_EEPROM_XMC1_INIT_STATE_2D:
+        /* Change the current Bank to Bank0 and recover from the dirty state to 2E  */
+        data_ptr->current_bank = 0U;
+        /* Transition states : 2D -> 2F -> 2E */
+        E_EEPROM_XMC1_lErasedDirtyStateRecovery(handle_ptr, data_ptr, E_EEPROM_XMC1_END_ERASE_OFFSET );
+        break;
+    case E_EEPROM_XMC1_INIT_STATE_D2:
+        /* Change the current Bank to Bank1 and recover from the dirty state to E2 */
+        data_ptr->current_bank = 1U;
+        /* Transition states : D2 -> F2 -> E2 */
+        E_EEPROM_XMC1_lErasedDirtyStateRecovery(handle_ptr, data_ptr, E_EEPROM_XMC1_END_ERASE_OFFSET );
+        break;
+    case E_EEPROM_XMC1_INIT_STATE_AD:
+        /* Change the current Bank to Bank0 and recover from the dirty state to 2E */
+        data_ptr->current_bank = 0U;
+        /* Transition states : AD -> A0 -> GC PROCESS -> 2E */
+        E_EEPROM_XMC1_lCopyProcessDirtyStateRecovery(handle_ptr, data_ptr, E_EEPROM_XMC1_COPY_COMPLETED ,
+                E_EEPROM_XMC1_GC_NEXT_BANK_VALID , 1U);
+        break;
+    case E_EEPROM_XMC1_INIT_STATE_DA:
+        /* Change the current Bank to Bank1  and recover from the dirty state to E2*/
+        data_ptr->current_bank = 1U;
+        /* Transition states : DA -> 0A -> GC PROCESS -> E2 */
+        E_EEPROM_XMC1_lCopyProcessDirtyStateRecovery(handle_ptr, data_ptr, E_EEPROM_XMC1_COPY_COMPLETED ,
+                E_EEPROM_XMC1_GC_NEXT_BANK_VALID , 1U);
+        break;
+    case E_EEPROM_XMC1_INIT_STATE_0D:
+        /* Change the current Bank to Bank1 and recover from the dirty state to E2 */
+        data_ptr->current_bank = 1U;
+        /* Transition states : 0D -> 02 -> GC PROCESS -> E2 */
+        E_EEPROM_XMC1_lCopyProcessDirtyStateRecovery(handle_ptr, data_ptr, E_EEPROM_XMC1_VALID_STATE ,
+                E_EEPROM_XMC1_GC_ERASE_PREV_BANK , 0U);
+        break;
+    case E_EEPROM_XMC1_INIT_STATE_D0:
+        /* Change the current Bank to Bank0 and recover from the dirty state to 2E */
+        data_ptr->current_bank = 0U;
+        /* Transition states : D0 -> 20 -> GC PROCESS -> 2E */
+        E_EEPROM_XMC1_lCopyProcessDirtyStateRecovery(handle_ptr, data_ptr, E_EEPROM_XMC1_VALID_STATE ,
+                E_EEPROM_XMC1_GC_ERASE_PREV_BANK , 0U);
+        break;
+    default:
+        /* Any state apart from the normal states is considered as Illegal state */
+        /* Transition states : Illegal -> PREPARE DFLASH -> 2E */
+        E_EEPROM_XMC1_lInitllegalStateMachine(handle_ptr, data_ptr);
+        break;
+    }
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lInitNormalStateMachine
+ ********************************************************************************
+ * Summary:
+ * Check which normal bank state machine process has executed.
+ *
+ * Parameters:
+ * handle_ptr - Pointer to the handle of the instance
+ * data_ptr - State of the region the request operates on
+ *
+ * Return:
+ * void
+ *
+ *******************************************************************************/
+static void E_EEPROM_XMC1_lInitNormalStateMachine(E_EEPROM_XMC1_t *const handle_ptr,
+        E_EEPROM_XMC1_DATA_t *const data_ptr)
+{
+    /* Check if the state matches with any of the normal marker states with active bank as bank-0*/
+    if (E_EEPROM_XMC1_lInitBank0NormalStateMachine(handle_ptr, data_ptr) == 0U)
+    {
+        /* Check if the state matches with any of the normal marker states with active bank as bank-1*/
+        if (E_EEPROM_XMC1_lInitBank1NormalStateMachine(handle_ptr, data_ptr) == 0U)
+        {
+            /* Check if the state matches with any other intermediate states from where a recover is possible  */
+            if (E_EEPROM_XMC1_lInitOtherNormalStateMachine(handle_ptr, data_ptr) == 0U)
+            {
+                /* If no matches found then go to illegal state and try to recover by erasing complete DFLASH */
+                E_EEPROM_XMC1_lInitllegalStateMachine(handle_ptr, data_ptr);
+            }
+        }
+    }
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lInitBank0NormalStateMachine
+ ********************************************************************************
+ * Summary:
+ * Execute bank 0 state machine process and return the found states.
+ *
+ * Parameters:
+ * handle_ptr - Pointer to the handle of the instance
+ * data_ptr - State of the region the request operates on
+ *
+ * Return:
+ * uint32_t : ( 1= state_found / 0 = State not found )
+ *
+ *******************************************************************************/
+static uint32_t E_EEPROM_XMC1_lInitBank0NormalStateMachine(E_EEPROM_XMC1_t *const handle_ptr,
+        E_EEPROM_XMC1_DATA_t *const data_ptr)
+{
+    uint32_t state_found;
+
+    state_found = 1U;
+
+    switch (data_ptr->init_gc_state)
+    {
+    /*
+     * Normal Data write in Bank-0 interrupted (2E), Next step = Cache Update and get ready to accept new request
+     * Transition states : Nothing
+     */
+    case E_EEPROM_XMC1_INIT_NORMAL1:
+        data_ptr->current_bank = 0U;
+        E_EEPROM_XMC1_lInitGcNormalStates(handle_ptr, data_ptr, E_EEPROM_XMC1_GC_IDLE,
+                E_EEPROM_XMC1_EXECUTE_CACHE_UPDATE);
+        break;
+
+        /*
+         * Data copy from Bank0 to Bank1 interrupted (2A), Next step = Erasing Bank-1 and restart copy from Bank-0
+         * Transition states : (2A) -> ERASE_BANK0 (2F) -> 2E -> GC_PROCESS (2A -> 0A -> 20 -> F2 -> E2)
+         */
+    case E_EEPROM_XMC1_INIT_DATA_COPY1:
+        data_ptr->current_bank = 0U;
+        E_EEPROM_XMC1_lInitGcDataCopyState(handle_ptr, data_ptr, E_EEPROM_XMC1_GC_REQUESTED,
+                E_EEPROM_XMC1_END_ERASE_OFFSET);
+        break;
+
+        /*
+         * Interrupted after copy completion from Bank1 to Bank0 (A0),Next step = Writing Valid state into Bank-0
+         * Transition states : (A0) -> (20) -> GC_PROCESS (2F -> 2E)
+         */
+    case E_EEPROM_XMC1_INIT_COPY_DONE1:
+        data_ptr->current_bank = 0U;
+        E_EEPROM_XMC1_lInitGcNormalStates(handle_ptr, data_ptr, E_EEPROM_XMC1_GC_NEXT_BANK_VALID,
+                E_EEPROM_XMC1_EXECUTE_GC_STATE);
+        break;
+
+        /*
+         * Interrupted after writing valid state to Bank0 (20), Next step = Erase of old redundant Bank-1 (2F)
+         * Transition states : (20) -> (2F) -> GC_PROCESS (2E)
+         */
+    case E_EEPROM_XMC1_INIT_NEXT_VALID1:
+        data_ptr->current_bank = 0U;
+        E_EEPROM_XMC1_lInitGcNormalStates(handle_ptr, data_ptr, E_EEPROM_XMC1_GC_ERASE_PREV_BANK,
+                E_EEPROM_XMC1_EXECUTE_GC_STATE);
+        break;
+
+        /*
+         * Interrupted after erase of old bank completed(2F), Next step = Mark erased Bank-1 with Formatted state(2E)
+         * Transition states : (2F) -> GC_PROCESS (2E)
+         */
+    case E_EEPROM_XMC1_INIT_END_ERASE1:
+        data_ptr->current_bank = 0U;
+        E_EEPROM_XMC1_lInitGcNormalStates(handle_ptr, data_ptr, E_EEPROM_XMC1_GC_MARK_END_ERASE1,
+                E_EEPROM_XMC1_EXECUTE_GC_STATE);
+        break;
+
+    default:
+        state_found = 0U;
+        break;
+    }
+    return (state_found);
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lInitBank1NormalStateMachine
+ ********************************************************************************
+ * Summary:
+ * Execute bank 1 state machine process and return the found states.
+ *
+ * Parameters:
+ * handle_ptr - Pointer to the handle of the instance
+ * data_ptr - State of the region the request operates on
+ * uint32_t : ( 1= state_found / 0 = State not found )
+ *
+ * Return:
+ * E_EEPROM_XMC1_STATUS_t
+ *
+ *******************************************************************************/
+static uint32_t E_EEPROM_XMC1_lInitBank1NormalStateMachine(E_EEPROM_XMC1_t *const handle_ptr,
+        E_EEPROM_XMC1_DATA_t *const data_ptr)
+{
+    uint32_t state_found;
+
+    state_found = 1U;
+
+    switch (data_ptr->init_gc_state)
+    {
+    /*
+     * Normal Data write in Bank-1 interrupted (E2), Next step = Cache Update and get ready to accept new request
+     * Transition states : Nothing
+     */
+    case E_EEPROM_XMC1_INIT_NORMAL2:
+        data_ptr->current_bank = 1U;
+        E_EEPROM_XMC1_lInitGcNormalStates(handle_ptr, data_ptr, E_EEPROM_XMC1_GC_IDLE,
+                E_EEPROM_XMC1_EXECUTE_CACHE_UPDATE);
+        break;
+
+        /*
+         * Data copy from Bank1 to Bank0 interrupted (A2), Next step = Erasing Bank-0 and restart copy from Bank-1
+         * Transition states : (A2) -> ERASE_BANK0 (F2) -> E2 -> GC_PROCESS (A2 -> A0 -> 20 -> 2F -> 2E)
+         */
+    case E_EEPROM_XMC1_INIT_DATA_COPY2:
+        data_ptr->current_bank = 1U;
+        E_EEPROM_XMC1_lInitGcDataCopyState(handle_ptr, data_ptr, E_EEPROM_XMC1_GC_REQUESTED,
+                E_EEPROM_XMC1_END_ERASE_OFFSET);
+        break;
+
+        /*
+         * Interrupted after copy completion from Bank0 to Bank1 (0A),Next step = Writing Valid state into Bank-1
+         * Transition states : (0A) -> (02) -> GC_PROCESS (F2 -> E2)
+         */
+    case E_EEPROM_XMC1_INIT_COPY_DONE2:
+        data_ptr->current_bank = 1U;
+        E_EEPROM_XMC1_lInitGcNormalStates(handle_ptr, data_ptr, E_EEPROM_XMC1_GC_NEXT_BANK_VALID,
+                E_EEPROM_XMC1_EXECUTE_GC_STATE);
+        break;
+
+        /*
+         * Interrupted after writing valid state to Bank1 (02), Next step = Erase of old redundant Bank-0 (F2)
+         * Transition states : (02) -> (F2) -> GC_PROCESS (E2)
+         */
+    case E_EEPROM_XMC1_INIT_NEXT_VALID2:
+        data_ptr->current_bank = 1U;
+        E_EEPROM_XMC1_lInitGcNormalStates(handle_ptr, data_ptr, E_EEPROM_XMC1_GC_ERASE_PREV_BANK,
+                E_EEPROM_XMC1_EXECUTE_GC_STATE);
+        break;
+
+        /*
+         * Interrupted after erase of old bank completed(F2), Next step = Mark erased Bank-0 with Formatted state(E2)
+         * Transition states : (F2) -> GC_PROCESS (E2)
+         */
+    case E_EEPROM_XMC1_INIT_END_ERASE2:
+        data_ptr->current_bank = 1U;
+        E_EEPROM_XMC1_lInitGcNormalStates(handle_ptr, data_ptr, E_EEPROM_XMC1_GC_MARK_END_ERASE1,
+                E_EEPROM_XMC1_EXECUTE_GC_STATE);
+        break;
+
+    default:
+        state_found = 0U;
+        break;
+    }
+    return (state_found);
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lInitOtherNormalStateMachine
+ ********************************************************************************
+ * Summary:
+ * Execute other state machine process and return the found states.
+ *
+ * Parameters:
+ * handle_ptr - Pointer to the handle of the instance
+ * data_ptr - State of the region the request operates on
+ *
+ * Return:
+ * uint32_t : ( 1= state_found / 0 = State not found )
+ *
+ *******************************************************************************/
+static uint32_t E_EEPROM_XMC1_lInitOtherNormalStateMachine(E_EEPROM_XMC1_t *const handle_ptr,
+        E_EEPROM_XMC1_DATA_t *const data_ptr)
+{
+    uint32_t state_found;
+
+    state_found = 1U;
+
+    switch (data_ptr->init_gc_state)
+    {
+    /* Interrupted after erase of both banks completed (FF), Next step = Start Prepare DFlash  */
+    case E_EEPROM_XMC1_INIT_ALL_ERASED:
+        /* Change the current Bank to Bank0 */
+        data_ptr->current_bank = 0U;
+        /* Transition states : FF ->  PREPARE_DFLASH (2F) -> 2E */
+        E_EEPROM_XMC1_lInitGcNormalStates(handle_ptr, data_ptr, E_EEPROM_XMC1_PREPFLASH_FF,
+                E_EEPROM_XMC1_EXECUTE_PREP_FLASH);
+        break;
+
+        /*
+         * Interrupted after erase of Bank1 during previous recovery(AF), Next step = Bank0 marker Page program (A0)
+         * Transition states : AF -> A0 -> GC PROCESS -> 20 -> 2F -> 2E
+         */
+    case E_EEPROM_XMC1_INIT_STATE_AF:
+        /* Change the current Bank to Bank1 */
+        data_ptr->current_bank = 0U;
+
+        E_EEPROM_XMC1_lCopyProcessDirtyStateRecovery(handle_ptr, data_ptr, E_EEPROM_XMC1_COPY_COMPLETED ,
+                E_EEPROM_XMC1_GC_NEXT_BANK_VALID , 1U);
+        break;
+
+        /*
+         * Interrupted after erase of Bank0 during previous recovery(FA), Next step = Bank1 marker Page program (0A)
+         * Transition states : FA -> 0A -> GC PROCESS -> 02 -> F2 -> E2
+         */
+    case E_EEPROM_XMC1_INIT_STATE_FA:
+        data_ptr->current_bank = 1U;
+        E_EEPROM_XMC1_lCopyProcessDirtyStateRecovery(handle_ptr, data_ptr, E_EEPROM_XMC1_COPY_COMPLETED ,
+                E_EEPROM_XMC1_GC_NEXT_BANK_VALID , 1U);
+        break;
+
+        /*
+         * Interrupted after erase of Bank1 during previous recover(0F), Next step = Bank1 marker Page program (02)
+         * Transition states : 0F -> 02 -> GC PROCESS -> F2 -> E2
+         */
+    case E_EEPROM_XMC1_INIT_STATE_0F:
+        data_ptr->current_bank = 1U;
+        E_EEPROM_XMC1_lCopyProcessDirtyStateRecovery(handle_ptr, data_ptr, E_EEPROM_XMC1_VALID_STATE ,
+                E_EEPROM_XMC1_GC_ERASE_PREV_BANK , 0U);
+        break;
+
+        /*
+         * Interrupted after erase of Bank1 during previous recover(F0), Next step = Bank1 marker Page program (20)
+         * Transition states : F0 -> 20 -> GC PROCESS -> 2F -> 2E
+         */
+    case E_EEPROM_XMC1_INIT_STATE_F0:
+        /* Change the current Bank to Bank0 */
+        data_ptr->current_bank = 0U;
+        /* Transition states : D0 -> 20 -> GC PROCESS -> 2E */
+        E_EEPROM_XMC1_lCopyProcessDirtyStateRecovery(handle_ptr, data_ptr, E_EEPROM_XMC1_VALID_STATE ,
+                E_EEPROM_XMC1_GC_ERASE_PREV_BANK , 0U);
+        break;
+
+    default:
+        state_found = 0U;
+        break;
+    }
+    return (state_found);
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lInitGcNormalStates
+ ********************************************************************************
+ * Summary:
+ * Executes normal Garbage collection state machine sub process
+ *
+ * Parameters:
+ * handle_ptr - Pointer to the handle of the instance
+ * data_ptr - State of the region the request operates on
+ * current_state  - Current GC state
+ * next_process  - Number of logical block
+ *
+ * Return:
+ * void
+ *
+ *******************************************************************************/
+static void E_EEPROM_XMC1_lInitGcNormalStates(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr,
+        uint32_t current_state, uint32_t next_process)
+{
+    /* Update the Bank related global variables */
+    E_EEPROM_XMC1_lUpdateCurrBankInfo(data_ptr);
+
+    if (next_process == E_EEPROM_XMC1_EXECUTE_PREP_FLASH)
+    {
+        /* Update the GC state*/
+        data_ptr->gc_state = current_state;
+        /* Start Prepare DFlash routine to build FEE base  */
+        E_EEPROM_XMC1_lPrepareDFlash(data_ptr);
+        /* Update the RAM Cache Table */
+        E_EEPROM_XMC1_lUpdateCache(handle_ptr, data_ptr);
+    }
+    else if (next_process == E_EEPROM_XMC1_EXECUTE_GC_STATE)
+    {
+        /* Update the GC state */
+        data_ptr->gc_state = current_state;
+        /* Update the RAM Cache Table */
+        E_EEPROM_XMC1_lUpdateCache(handle_ptr, data_ptr);
+        /* Start Garbage Collection */
+        E_EEPROM_XMC1_lGarbageCollection(handle_ptr, data_ptr);
+    }
+    else /* if ( next_process == E_EEPROM_XMC1_EXECUTE_CACHE_UPDATE ) */
+    {
+        if (handle_ptr->lazy_mount == 1U)
+        {
+            /* Only find the free space, the cache entries are updated on the first access to each block */
+            E_EEPROM_XMC1_lMountBank(handle_ptr, data_ptr);
+        }
+        else
+        {
+            /* Update the RAM Cache Table */
+            E_EEPROM_XMC1_lUpdateCache(handle_ptr, data_ptr);
+        }
+        /* Update the GC state as Bank-0 Erase Completed state */
+        data_ptr->gc_state = current_state;
+    }
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lInitGcDataCopyState
+ ********************************************************************************
+ * Summary:
+ * Executes data copy state GC state machine sub process.
+ *
+ * Parameters:
+ * handle_ptr - Pointer to the handle of the instance
+ * data_ptr - State of the region the request operates on
+ * current_state  - Current GC state
+ * marker_offset  - Marker block offset
+ *
+ * Return:
+ * void
+ *
+ *******************************************************************************/
+static void E_EEPROM_XMC1_lInitGcDataCopyState(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr,
+        uint32_t current_state, uint32_t marker_offset)
+{
+    uint32_t status;
+
+    /* Update the Bank related global variables */
+    E_EEPROM_XMC1_lUpdateCurrBankInfo(data_ptr);
+
+    /* Update the GC state as restart copy process */
+    data_ptr->gc_state = current_state ;
+
+    /* Update the RAM Cache Table with */
+    E_EEPROM_XMC1_lUpdateCache(handle_ptr, data_ptr);
+
+    /* Erase the previous redundant bank */
+    status = E_EEPROM_XMC1_lEraseBank(data_ptr, data_ptr->prev_bank_end_addr);
+
+    if (status == 0U)
+    {
+        E_EEPROM_XMC1_lSetMarkerBlockBuffer(data_ptr);
+
+        /* Write formatted state to the erased bank (2E)  */
+        status = E_EEPROM_XMC1_lGCWrite(data_ptr, (uint32_t)(data_ptr->gc_dest_addr + marker_offset));
+
+        if (status == 0U)
+        {
+            /* Start Garbage Collection */
+            E_EEPROM_XMC1_lGarbageCollection(handle_ptr, data_ptr);
+        }
+        else
+        {
+            data_ptr->gc_state = E_EEPROM_XMC1_GC_FAIL;
+        }
+
+    }
+    else
+    {
+        data_ptr->gc_state = E_EEPROM_XMC1_GC_FAIL;
+    }
+
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lErasedDirtyStateRecovery
+ ********************************************************************************
+ * Summary:
+ * Executes state machine sub process for erase dirty states to recover.
+ *
+ * Parameters:
+ * handle_ptr - Pointer to the handle of the instance
+ * data_ptr - State of the region the request operates on
+ * marker_offset  - Marker block offset
+ *
+ * Return:
+ * void
+ *
+ *******************************************************************************/
+static void E_EEPROM_XMC1_lErasedDirtyStateRecovery(E_EEPROM_XMC1_t *const handle_ptr,
+        E_EEPROM_XMC1_DATA_t *const data_ptr, uint32_t marker_offset)
+{
+    uint32_t  status;
+
+    /* Update the Bank related global variables */
+    E_EEPROM_XMC1_lUpdateCurrBankInfo(data_ptr);
+
+    /* Erase the previous redundant bank */
+    status = E_EEPROM_XMC1_lEraseBank(data_ptr, data_ptr->prev_bank_end_addr);
+
+    if (status == 0U)
+    {
+        E_EEPROM_XMC1_lSetMarkerBlockBuffer(data_ptr);
+
+        /* Write formatted state to the erased bank */
+        status = E_EEPROM_XMC1_lGCWrite(data_ptr, (uint32_t)(data_ptr->gc_dest_addr + marker_offset));
+        if (status == 0U)
+        {
+            /* Update the RAM Cache Table with the written blocks of data.*/
+            E_EEPROM_XMC1_lUpdateCache(handle_ptr, data_ptr);
+
+            data_ptr->gc_state = E_EEPROM_XMC1_GC_IDLE;
+        }
+        else
+        {
+            data_ptr->gc_state = E_EEPROM_XMC1_GC_FAIL;
+        }
+    }
+    else
+    {
+        data_ptr->gc_state = E_EEPROM_XMC1_GC_FAIL;
+    }
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lCopyProcessDirtyStateRecovery
+ ********************************************************************************
+ * Summary:
+ * Recovers from any copy process dirty state.
+ *
+ * Parameters:
+ * handle_ptr - Pointer to the handle of the instance
+ * data_ptr - State of the region the request operates on
+ * current_state   - Current GC state
+ * NextState      - Next GC state
+ * page_addr_select - Page address from which bank to be written
+ *
+ * Return:
+ * void
+ *
+ *******************************************************************************/
+static void E_EEPROM_XMC1_lCopyProcessDirtyStateRecovery(E_EEPROM_XMC1_t *const handle_ptr,
+        E_EEPROM_XMC1_DATA_t *const data_ptr, uint32_t current_state,
+        uint32_t next_state,
+        uint32_t page_addr_select)
+{
+    uint32_t  status;
+
+    /* Update the Bank related global variables */
+    E_EEPROM_XMC1_lUpdateCurrBankInfo(data_ptr);
+
+    /* Set the marker blocks with copy completed state */
+    E_EEPROM_XMC1_lSetMarkerPageBuffer(data_ptr, current_state);
+
+    /* Clear all error status flags before flash operation*/
+    XMC_FLASH_ClearStatus();
+
+    /* Decide the bank from page_addr_select and Erase the marker page + Program with the current state + Verify */
+    if (page_addr_select == 1U)
+    {
+        E_EEPROM_XMC1_lWriteSinglePage(data_ptr->gc_dest_addr, (uint32_t*)(void*)data_ptr->page_write_buffer);
+    }
+    else
+    {
+        E_EEPROM_XMC1_lWriteSinglePage(data_ptr->gc_src_addr, (uint32_t*)(void*)data_ptr->page_write_buffer);
+    }
+
+    status = E_EEPROM_XMC1_lGetFlashStatus();
+
+    if (status == 0U)
+    {
+        /* Update the GC state as write next bank valid */
+        data_ptr->gc_state = next_state ;
+        /* Update the RAM Cache Table */
+        E_EEPROM_XMC1_lUpdateCache(handle_ptr, data_ptr);
+        /* Start Garbage Collection */
+        E_EEPROM_XMC1_lGarbageCollection(handle_ptr, data_ptr);
+    }
+    else
+    {
+        data_ptr->gc_state = E_EEPROM_XMC1_GC_FAIL;
+    }
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lGarbageCollection
+ ********************************************************************************
+ * Summary:
+ * This function execute's the garbage collection state machine.
+ *
+ * Parameters:
+ * handle_ptr - Pointer to the handle of the instance
+ * data_ptr - State of the region the request operates on
+ *
+ * Return:
+ * void
+ *
+ *******************************************************************************/
+static void E_EEPROM_XMC1_lGarbageCollection(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr)
+{
+    do
+    {
+        (void)E_EEPROM_XMC1_lGarbageCollectionStep(handle_ptr, data_ptr);
+
+    } while ((data_ptr->gc_state != E_EEPROM_XMC1_GC_IDLE) &&
+            (data_ptr->gc_state != E_EEPROM_XMC1_GC_FAIL));
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lGarbageCollectionStep
+ ********************************************************************************
+ * Summary:
+ * This function executes one transition of the garbage collection state machine.
+ * The state variables of the handle are the only context, hence the procedure
+ * can be resumed by calling the function again.
+ *
+ * Parameters:
+ * handle_ptr - Pointer to the handle of the instance
+ * data_ptr - State of the region the request operates on
+ *
+ * Return:
+ * uint32_t - Number of flash program/erase operations executed (0 or 1)
+ *
+ *******************************************************************************/
+static uint32_t E_EEPROM_XMC1_lGarbageCollectionStep(E_EEPROM_XMC1_t *const handle_ptr,
+        E_EEPROM_XMC1_DATA_t *const data_ptr)
+{
+    uint32_t flash_operations;
+
+    flash_operations = 1U;
+
+    switch (data_ptr->gc_state)
+    {
+    case E_EEPROM_XMC1_GC_COPY_START:
+        E_EEPROM_XMC1_lHandleGcStartCopy(handle_ptr, data_ptr);
+        flash_operations = 0U;
+        break;
+
+    case E_EEPROM_XMC1_GC_COPY_WRITE:
+        E_EEPROM_XMC1_lHandleGcCopyWrite(handle_ptr, data_ptr);
+        break;
+
+    case E_EEPROM_XMC1_GC_READ_NXTBLOCK:
+        E_EEPROM_XMC1_lHandleGcCopyRead(handle_ptr, data_ptr);
+        flash_operations = 0U;
+        break;
+
+    case E_EEPROM_XMC1_GC_WRITE_INDEX:
+        E_EEPROM_XMC1_lHandleGcWriteIndex(handle_ptr, data_ptr);
+        break;
+
+    case E_EEPROM_XMC1_GC_COPY_END:
+        E_EEPROM_XMC1_lHandleGcEndOfCopy(data_ptr);
+        break;
+
+    case E_EEPROM_XMC1_GC_NEXT_BANK_VALID:
+        E_EEPROM_XMC1_lHandleGcOtherStates(data_ptr, E_EEPROM_XMC1_GC_NEXT_BANK_VALID,
+                E_EEPROM_XMC1_GC_ERASE_PREV_BANK);
+        break;
+
+    case E_EEPROM_XMC1_GC_ERASE_PREV_BANK:
+        if (handle_ptr->erase_ahead == 1U)
+        {
+            /*
+             * The new bank is already valid, complete the GC here and erase the previous bank page by page with
+             * the next write requests. The additional count stands for the formatted marker write (E2) or (2E).
+             */
+            data_ptr->pending_erase_pages = E_EEPROM_XMC1_BANK_PAGE_COUNT + 1U;
+            data_ptr->gc_state = E_EEPROM_XMC1_GC_IDLE;
+            flash_operations = 0U;
+        }
+        else
+        {
+            E_EEPROM_XMC1_lHandleGcErasePrevBank(data_ptr);
+        }
+        break;
+
+    case E_EEPROM_XMC1_GC_MARK_END_ERASE1:
+        E_EEPROM_XMC1_lHandleGcOtherStates(data_ptr, E_EEPROM_XMC1_GC_MARK_END_ERASE1, E_EEPROM_XMC1_GC_IDLE);
+        break;
+
+    case E_EEPROM_XMC1_GC_RECLAIM_BANK:
+        E_EEPROM_XMC1_lHandleGcReclaimSegment(handle_ptr, data_ptr);
+        break;
+
+    case E_EEPROM_XMC1_GC_ERASE_RECLAIMED:
+        E_EEPROM_XMC1_lHandleGcEraseReclaimed(data_ptr);
+        break;
+
+    default:
+        /* E_EEPROM_XMC1_GC_REQUESTED state, the previous bank must be erased before it takes the copy */
+        if (data_ptr->pending_erase_pages != 0U)
+        {
+            E_EEPROM_XMC1_lHandleEraseAhead(data_ptr);
+        }
+        else if (E_EEPROM_XMC1_BANK_COUNT > 2U)
+        {
+            E_EEPROM_XMC1_lHandleGcOpenSegment(handle_ptr, data_ptr);
+        }
+        else
+        {
+            E_EEPROM_XMC1_lHandleGcRequested(handle_ptr, data_ptr);
+        }
+        break;
+    }
+
+    return (flash_operations);
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lHandleGcRequested
+ ********************************************************************************
+ * Summary:
+ * This function handles Garbage Collection GC REQUESTED state
+ *
+ * Parameters:
+ * handle_ptr - Pointer to the handle of the instance
+ * data_ptr - State of the region the request operates on
+ *
+ * Return:
+ * void
+ *
+ *******************************************************************************/
+static void E_EEPROM_XMC1_lHandleGcRequested(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr)
+{
+    uint32_t status;
+    uint32_t block_count;
+    E_EEPROM_XMC1_CACHE_t *cache_ptr;
+
+    /* The copy process needs the cache entries of all blocks */
+    E_EEPROM_XMC1_lResolveCache(handle_ptr, data_ptr);
+
+    E_EEPROM_XMC1_lSetMarkerBlockBuffer(data_ptr);
+    /* Write Copy start state to new bank  (2A) or (A2) */
+    status = E_EEPROM_XMC1_lGCWrite(data_ptr, (uint32_t)(data_ptr->gc_dest_addr + E_EEPROM_XMC1_BEGIN_OFFSET));
+    if (status == 0U)
+    {
+        /* Initialize the copied status for all the logical blocks */
+        cache_ptr = data_ptr->block_info;
+        block_count = 0U;
+        do
+        {
+            cache_ptr->status.copied = 0U;
+            block_count++;
+            cache_ptr++;
+        } while (block_count != handle_ptr->block_count);
+
+        data_ptr->gc_log_block_count = 0U;
+        data_ptr->gc_state = E_EEPROM_XMC1_GC_COPY_START;
+        data_ptr->gc_dest_addr = data_ptr->gc_dest_addr + E_EEPROM_XMC1_DATA_BLOCK_OFFSET;
+    }
+    else
+    {
+        data_ptr->gc_state = E_EEPROM_XMC1_GC_FAIL;
+    }
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lHandleGcStartCopy
+ ********************************************************************************
+ * Summary:
+ * This function handles Garbage Collection GC START COPY state. Only the live
+ * payload is copied: inconsistent copies are left behind and the tombstone of
+ * an invalidated block is dropped, its cache entry then marks the block as
+ * never written. In a rotating log a tombstone is copied as long as an older
+ * segment may hold a previous copy of the block.
+ *
+ * Parameters:
+ * handle_ptr - Pointer to the handle of the instance
+ * data_ptr - State of the region the request operates on
+ *
+ * Return:
+ * void
+ *
+ *******************************************************************************/
+static void E_EEPROM_XMC1_lHandleGcStartCopy(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr)
+{
+    uint32_t state_flag;
+    uint32_t block_count;
+    uint32_t drop_invalid;
+    E_EEPROM_XMC1_CACHE_t *cache_ptr;
+
+    /* No copy of a block survives the garbage collection if the reclaimed bank is the oldest one */
+    drop_invalid = 1U;
+    if ((E_EEPROM_XMC1_BANK_COUNT > 2U) &&
+            (E_EEPROM_XMC1_lGetOlderSegment(data_ptr, data_ptr->gc_victim_bank) < E_EEPROM_XMC1_BANK_COUNT))
+    {
+        drop_invalid = 0U;
+    }
+
+    state_flag = 0U;
+    /* initialize the copied status for all the logical blocks */
+    block_count = data_ptr->gc_log_block_count;
+    cache_ptr = data_ptr->block_info + block_count;
+    /*
+     * Check all available blocks in cache table for Copy process. Condition breaks on either the current block is
+     * consistent or all blocks check for consistency is finished
+     */
+    while ((state_flag == 0U) && (block_count != handle_ptr->block_count))
+    {
+        /* The tombstone of an invalidated block is not copied, the block is never written in the new bank */
+        if (((cache_ptr->address != 0U) && (cache_ptr->status.consistent == 1U)) &&
+                (cache_ptr->status.copied == 0U) && (cache_ptr->status.valid == 0U) && (drop_invalid == 1U))
+        {
+            cache_ptr->address = 0U;
+            cache_ptr->status.valid = 1U;
+            cache_ptr->status.consistent = 0U;
+            cache_ptr->status.crc = 0U;
+            block_count++;
+            cache_ptr++;
+        }
+        /* If block is consistent set state flag for copy enable*/
+        else if (((cache_ptr->address != 0U) && (cache_ptr->status.consistent == 1U)) &&
+                (cache_ptr->status.copied == 0U))
+        {
+            state_flag = 1U;
+        }
+        /* If block is inconsistent ignore the block from copy and try next block*/
+        else
+        {
+            block_count++;
+            cache_ptr++;
+        }
+    } /* end of while */
+
+    /* If block is consistent */
+    if (state_flag == 1U)
+    {
+        data_ptr->gc_src_addr = cache_ptr->address;
+        data_ptr->gc_block_counter = 0U;
+        data_ptr->gc_log_block_count = block_count;
+
+        E_EEPROM_XMC1_lHandleGcCopyRead(handle_ptr, data_ptr);
+    }
+    /* Finished copying all the logical blocks */
+    else if (E_EEPROM_XMC1_BANK_COUNT > 2U)
+    {
+        /* The new segment is already the current one, the reclaimed segment gets erased */
+        data_ptr->next_free_block_addr = data_ptr->gc_dest_addr;
+        data_ptr->gc_state = E_EEPROM_XMC1_GC_RECLAIM_BANK;
+    }
+    else
+    {
+        /* Update the next free block pointer */
+        data_ptr->next_free_block_addr = data_ptr->gc_dest_addr;
+        data_ptr->gc_src_addr = data_ptr->curr_bank_src_addr;
+        E_EEPROM_XMC1_lUpdateCurrBankInfo(data_ptr);
+        data_ptr->gc_state = E_EEPROM_XMC1_GC_WRITE_INDEX;
+    }
+    data_ptr->gc_log_block_count = block_count;
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lHandleGcCopyWrite
+ ********************************************************************************
+ * Summary:
+ * This function handles Garbage Collection GC START COPY WRITE state.
+ *
+ * Parameters:
+ * handle_ptr - Pointer to the handle of the instance
+ * data_ptr - State of the region the request operates on
+ *
+ * Return:
+ * void
+ *
+ *******************************************************************************/
+static void E_EEPROM_XMC1_lHandleGcCopyWrite(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr)
+{
+    uint32_t size;
+    uint32_t status;
+    uint32_t block_count;
+    uint32_t flash_physical_blocks;
+    E_EEPROM_XMC1_CACHE_t *cache_ptr;
+
+    /* initialize the copied status for all the logical blocks */
+    block_count = data_ptr->gc_log_block_count;
+    cache_ptr = data_ptr->block_info + block_count;
+
+    status = E_EEPROM_XMC1_lGCWriteBlocks(data_ptr, (uint32_t)(data_ptr->gc_dest_addr), data_ptr->gc_copy_blocks);
+    if (status == 0U)
+    {
+        data_ptr->gc_block_counter += data_ptr->gc_copy_blocks;
+        data_ptr->gc_dest_addr += (E_EEPROM_XMC1_FLASH_BLOCK_SIZE * data_ptr->gc_copy_blocks);
+        size = (handle_ptr->block_config_ptr[block_count].size);
+        flash_physical_blocks = E_EEPROM_XMC1_lGetDFLASHPhysicalBlocks(size);
+        /* If all the blocks of the logical block are copied */
+        if ((data_ptr->gc_block_counter == flash_physical_blocks) || (cache_ptr->status.valid == 0U))
+        {
+            cache_ptr->status.copied = 1U;
+            block_count++;
+            data_ptr->gc_state = E_EEPROM_XMC1_GC_COPY_START;
+            cache_ptr->address = data_ptr->gc_dest_addr - (E_EEPROM_XMC1_FLASH_BLOCK_SIZE * data_ptr->gc_block_counter);
+        }
+        else
+        {
+            data_ptr->gc_src_addr += (E_EEPROM_XMC1_FLASH_BLOCK_SIZE * data_ptr->gc_copy_blocks);
+            data_ptr->gc_state = E_EEPROM_XMC1_GC_READ_NXTBLOCK;
+        }
+    }
+    else
+    {
+        data_ptr->gc_state = E_EEPROM_XMC1_GC_FAIL;
+    }
+    data_ptr->gc_log_block_count = block_count;
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lHandleGcCopyRead
+ ********************************************************************************
+ * Summary:
+ * This function reads the next flash blocks of the logical block being copied
+ * into the page buffer. As many blocks as fit into the current destination page
+ * are read, so that they are written with a single flash write request.
+ *
+ * Parameters:
+ * handle_ptr - Pointer to the handle of the instance
+ * data_ptr - State of the region the request operates on
+ *
+ * Return:
+ * void
+ *
+ *******************************************************************************/
+static void E_EEPROM_XMC1_lHandleGcCopyRead(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr)
+{
+    uint32_t size;
+    uint32_t copy_blocks;
+    uint32_t page_blocks;
+    E_EEPROM_XMC1_CACHE_t *cache_ptr;
+
+    cache_ptr = data_ptr->block_info + data_ptr->gc_log_block_count;
+
+    /* An invalidated block consists of a single flash block */
+    copy_blocks = 1U;
+    if (cache_ptr->status.valid == 1U)
+    {
+        size = (handle_ptr->block_config_ptr[data_ptr->gc_log_block_count].size);
+        copy_blocks = E_EEPROM_XMC1_lGetDFLASHPhysicalBlocks(size) - data_ptr->gc_block_counter;
+    }
+
+    /* Limit the copy to the end of the destination page */
+    page_blocks = (E_EEPROM_XMC1_FLASH_PAGE_SIZE - (data_ptr->gc_dest_addr & (E_EEPROM_XMC1_FLASH_PAGE_SIZE - 1U))) /
+            E_EEPROM_XMC1_FLASH_BLOCK_SIZE;
+    if (copy_blocks > page_blocks)
+    {
+        copy_blocks = page_blocks;
+    }
+    data_ptr->gc_copy_blocks = copy_blocks;
+
+    /* Clear all error status flags before flash operation*/
+    XMC_FLASH_ClearStatus();
+
+    E_EEPROM_XMC1_lReadBlocks(data_ptr->gc_src_addr, (uint32_t*)(void*)data_ptr->page_write_buffer, copy_blocks);
+
+    data_ptr->gc_state = E_EEPROM_XMC1_GC_COPY_WRITE;
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lHandleGcWriteIndex
+ ********************************************************************************
+ * Summary:
+ * This function handles Garbage Collection GC WRITE INDEX state. The flash
+ * address and status of all copied blocks and the end of the copied data
+ * (checkpoint) are written into the spare blocks of the marker page of the new
+ * bank. The index lets the initialization scan only the blocks written after
+ * the checkpoint. The index is optional, hence a failed write does not stop the
+ * garbage collection. An index which is not written completely is detected by
+ * its checksum.
+ *
+ * Parameters:
+ * handle_ptr - Pointer to the handle of the instance
+ * data_ptr - State of the region the request operates on
+ *
+ * Return:
+ * void
+ *
+ *******************************************************************************/
+static void E_EEPROM_XMC1_lHandleGcWriteIndex(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr)
+{
+    uint32_t indx;
+    uint32_t entry;
+    uint32_t index_blocks;
+    uint32_t *index_ptr;
+    E_EEPROM_XMC1_CACHE_t *cache_ptr;
+
+    index_ptr = (uint32_t*)(void*)data_ptr->page_write_buffer;
+    cache_ptr = data_ptr->block_info;
+
+    /* Header block followed by one entry word per configured user data block */
+    index_blocks = 1U + (((uint32_t)handle_ptr->block_count + (E_EEPROM_XMC1_MAX_WORDS_IN_BLOCK - 1U)) /
+            E_EEPROM_XMC1_MAX_WORDS_IN_BLOCK);
+
+    for (indx = 0U; indx < (index_blocks * E_EEPROM_XMC1_MAX_WORDS_IN_BLOCK); indx++)
+    {
+        index_ptr[indx] = E_EEPROM_XMC1_ALL_ONES;
+    }
+
+    index_ptr[0] = E_EEPROM_XMC1_INDEX_MAGIC;
+    index_ptr[E_EEPROM_XMC1_INDEX_FRONTIER_WORD] = data_ptr->next_free_block_addr - data_ptr->gc_dest_addr;
+    index_ptr[E_EEPROM_XMC1_INDEX_COUNT_WORD] = handle_ptr->block_count;
+
+    for (indx = 0U; indx < handle_ptr->block_count; indx++)
+    {
+        entry = (uint32_t)handle_ptr->block_config_ptr[indx].block_number << E_EEPROM_XMC1_INDEX_NUMBER_SHIFT;
+        /* Only the copied blocks are part of the new bank, the others are unknown to it */
+        if (cache_ptr->status.copied == 1U)
+        {
+            entry |= (cache_ptr->address - data_ptr->gc_dest_addr) / E_EEPROM_XMC1_FLASH_BLOCK_SIZE;
+            if (cache_ptr->status.valid == 1U)
+            {
+                entry |= E_EEPROM_XMC1_INDEX_VALID_FLAG;
+            }
+            if (cache_ptr->status.crc == 1U)
+            {
+                entry |= E_EEPROM_XMC1_INDEX_CRC_FLAG;
+            }
+        }
+        index_ptr[E_EEPROM_XMC1_INDEX_HEADER_WORDS + indx] = entry;
+        cache_ptr++;
+    }
+
+    index_ptr[E_EEPROM_XMC1_INDEX_CHECKSUM_WORD] = E_EEPROM_XMC1_lGetIndexChecksum(index_ptr,
+            index_blocks * E_EEPROM_XMC1_MAX_WORDS_IN_BLOCK);
+
+    /* The spare blocks are erased unless the marker page was reprogrammed during a recovery */
+    if (E_EEPROM_XMC1_lIsFlashErased(data_ptr, data_ptr->gc_dest_addr + E_EEPROM_XMC1_INDEX_OFFSET, index_blocks) == 1U)
+    {
+        (void)E_EEPROM_XMC1_lGCWriteBlocks(data_ptr, data_ptr->gc_dest_addr + E_EEPROM_XMC1_INDEX_OFFSET, index_blocks);
+    }
+
+    data_ptr->gc_state = E_EEPROM_XMC1_GC_COPY_END;
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lHandleGcOpenSegment
+ ********************************************************************************
+ * Summary:
+ * This function handles Garbage Collection GC REQUESTED state of a rotating
+ * log. The next erased segment is opened with a sequence number above the one
+ * of the current segment and becomes the current segment. If no other erased
+ * segment is left, the segment with the best cost-benefit is selected to be
+ * reclaimed and its live blocks are copied into the new segment.
+ *
+ * Parameters:
+ * handle_ptr - Pointer to the handle of the instance
+ * data_ptr - State of the region the request operates on
+ *
+ * Return:
+ * void
+ *
+ *******************************************************************************/
+static void E_EEPROM_XMC1_lHandleGcOpenSegment(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr)
+{
+    uint32_t bank;
+    uint32_t indx;
+    uint32_t status;
+    uint32_t next_bank;
+    uint32_t erased_banks;
+    E_EEPROM_XMC1_CACHE_t *cache_ptr;
+
+    /* Search the next erased segment following the current one */
+    next_bank = (data_ptr->current_bank + 1U) % E_EEPROM_XMC1_BANK_COUNT;
+    while ((next_bank != data_ptr->current_bank) && (data_ptr->bank_seq[next_bank] != 0U))
+    {
+        next_bank = (next_bank + 1U) % E_EEPROM_XMC1_BANK_COUNT;
+    }
+
+    status = 1U;
+    if (next_bank != data_ptr->current_bank)
+    {
+        status = E_EEPROM_XMC1_lWriteSegmentHeader(data_ptr, next_bank,
+                data_ptr->bank_seq[data_ptr->current_bank] + 1U);
+    }
+
+    if (status == 0U)
+    {
+        data_ptr->current_bank = next_bank;
+        E_EEPROM_XMC1_lUpdateCurrBankInfo(data_ptr);
+        data_ptr->next_free_block_addr = E_EEPROM_XMC1_BANK_BASE(next_bank) + E_EEPROM_XMC1_DATA_BLOCK_OFFSET;
+        data_ptr->gc_dest_addr = data_ptr->next_free_block_addr;
+
+        erased_banks = 0U;
+        for (bank = 0U; bank < E_EEPROM_XMC1_BANK_COUNT; bank++)
+        {
+            if (data_ptr->bank_seq[bank] == 0U)
+            {
+                erased_banks++;
+            }
+        }
+
+        /* One erased segment is always kept in reserve for the next garbage collection */
+        if (erased_banks == 0U)
+        {
+            data_ptr->gc_victim_bank = E_EEPROM_XMC1_lSelectVictimSegment(handle_ptr, data_ptr, data_ptr->current_bank,
+                    data_ptr->bank_seq[data_ptr->current_bank], NULL);
+
+            /* Only the blocks with the latest copy in the reclaimed segment are copied */
+            cache_ptr = data_ptr->block_info;
+            for (indx = 0U; indx < handle_ptr->block_count; indx++)
+            {
+                cache_ptr->status.copied = 1U;
+                if ((cache_ptr->address >= E_EEPROM_XMC1_BANK_BASE(data_ptr->gc_victim_bank)) &&
+                        (cache_ptr->address < E_EEPROM_XMC1_BANK_BASE(data_ptr->gc_victim_bank + 1U)))
+                {
+                    cache_ptr->status.copied = 0U;
+                }
+                cache_ptr++;
+            }
+
+            data_ptr->gc_log_block_count = 0U;
+            data_ptr->gc_state = E_EEPROM_XMC1_GC_COPY_START;
+        }
+        else
+        {
+            data_ptr->gc_state = E_EEPROM_XMC1_GC_IDLE;
+        }
+    }
+    else
+    {
+        data_ptr->gc_state = E_EEPROM_XMC1_GC_FAIL;
+    }
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lHandleGcReclaimSegment
+ ********************************************************************************
+ * Summary:
+ * This function handles Garbage Collection GC RECLAIM BANK state of a rotating
+ * log. The reclaimed marker is written into the segment whose live blocks are
+ * copied, from now on the segment is not part of the log. The cache entries of
+ * the blocks left in the segment, e.g. inconsistent copies, are searched again
+ * in the other segments, as done by the initialization.
+ *
+ * Parameters:
+ * handle_ptr - Pointer to the handle of the instance
+ * data_ptr - State of the region the request operates on
+ *
+ * Return:
+ * void
+ *
+ *******************************************************************************/
+static void E_EEPROM_XMC1_lHandleGcReclaimSegment(E_EEPROM_XMC1_t *const handle_ptr,
+        E_EEPROM_XMC1_DATA_t *const data_ptr)
+{
+    uint32_t indx;
+    uint32_t status;
+    E_EEPROM_XMC1_CACHE_t *cache_ptr;
+
+    E_EEPROM_XMC1_lSetMarkerBlockBuffer(data_ptr);
+    status = E_EEPROM_XMC1_lGCWrite(data_ptr, E_EEPROM_XMC1_BANK_BASE(data_ptr->gc_victim_bank) +
+            E_EEPROM_XMC1_END_OF_COPY_OFFSET);
+    if (status == 0U)
+    {
+        data_ptr->bank_seq[data_ptr->gc_victim_bank] = 0U;
+
+        cache_ptr = data_ptr->block_info;
+        for (indx = 0U; indx < handle_ptr->block_count; indx++)
+        {
+            if ((cache_ptr->address >= E_EEPROM_XMC1_BANK_BASE(data_ptr->gc_victim_bank)) &&
+                    (cache_ptr->address < E_EEPROM_XMC1_BANK_BASE(data_ptr->gc_victim_bank + 1U)))
+            {
+                data_ptr->live_flash_blocks -= E_EEPROM_XMC1_lGetEntryLiveBlocks(handle_ptr, data_ptr, indx);
+                cache_ptr->address = 0U;
+                cache_ptr->status.valid = 1U;
+                cache_ptr->status.consistent = 0U;
+                cache_ptr->status.crc = 0U;
+                cache_ptr->status.resolved = 0U;
+                E_EEPROM_XMC1_lResolveCacheEntry(handle_ptr, data_ptr, indx);
+            }
+            cache_ptr++;
+        }
+
+        /* The erase of the reclaimed segment counts its erased pages in the GC block counter */
+        data_ptr->gc_block_counter = 0U;
+        data_ptr->gc_state = E_EEPROM_XMC1_GC_ERASE_RECLAIMED;
+    }
+    else
+    {
+        data_ptr->gc_state = E_EEPROM_XMC1_GC_FAIL;
+    }
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lHandleGcEraseReclaimed
+ ********************************************************************************
+ * Summary:
+ * This function handles Garbage Collection GC ERASE RECLAIMED state of a
+ * rotating log. One page of the reclaimed segment is erased per call, starting
+ * from the last page so that the marker page is erased at the end. The number
+ * of erased pages is tracked in gc_block_counter.
+ *
+ * Parameters:
+ * data_ptr - State of the region the request operates on
+ *
+ * Return:
+ * void
+ *
+ *******************************************************************************/
+static void E_EEPROM_XMC1_lHandleGcEraseReclaimed(E_EEPROM_XMC1_DATA_t *const data_ptr)
+{
+    uint32_t status;
+    uint32_t page_address;
+
+    page_address = E_EEPROM_XMC1_BANK_BASE(data_ptr->gc_victim_bank + 1U) -
+            (E_EEPROM_XMC1_FLASH_PAGE_SIZE * (data_ptr->gc_block_counter + 1U));
+
+    /* Clear all error status flags before flash operation*/
+    XMC_FLASH_ClearStatus();
+
+    E_EEPROM_XMC1_lEraseSinglePage(page_address);
+
+    status = E_EEPROM_XMC1_lGetFlashStatus();
+
+    if (status == 0U)
+    {
+        (data_ptr->gc_block_counter)++;
+        if (data_ptr->gc_block_counter == E_EEPROM_XMC1_BANK_PAGE_COUNT)
+        {
+            data_ptr->gc_state = E_EEPROM_XMC1_GC_IDLE;
+        }
+    }
+    else
+    {
+        data_ptr->gc_state = E_EEPROM_XMC1_GC_FAIL;
+    }
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lHandleGcEndOfCopy
+ ********************************************************************************
+ * Summary:
+ * This function handles Garbage Collection GC END OF COPY state
+ *
+ * Parameters:
+ * data_ptr - State of the region the request operates on
+ *
+ * Return:
+ * void
+ *
+ *******************************************************************************/
+static void E_EEPROM_XMC1_lHandleGcEndOfCopy(E_EEPROM_XMC1_DATA_t *const data_ptr)
+{
+    uint32_t  status;
+
+    E_EEPROM_XMC1_lSetMarkerBlockBuffer(data_ptr);
+    /* Write Copy completed state to old bank (0A) or (A0) */
+    status = E_EEPROM_XMC1_lGCWrite(data_ptr, (uint32_t)(data_ptr->gc_src_addr + E_EEPROM_XMC1_END_OF_COPY_OFFSET));
+    if (status == 0U)
+    {
+        /* Update the current bank to next bank */
+        data_ptr->current_bank = data_ptr->current_bank ^ 1U;
+
+        /* Update the Bank related global variables */
+        E_EEPROM_XMC1_lUpdateCurrBankInfo(data_ptr);
+        data_ptr->gc_state = E_EEPROM_XMC1_GC_NEXT_BANK_VALID;
+    }
+    else
+    {
+        data_ptr->gc_state = E_EEPROM_XMC1_GC_FAIL;
+    }
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lHandleGcOtherStates
+ ********************************************************************************
+ * Summary:
+ * This function handles Garbage Collection GC NEXT BANk VALID, ERASE PREV BANK
+ * and GC COMPLETED IDLE state
+ *
+ * Parameters:
+ * data_ptr - State of the region the request operates on
+ * current_state - current state machine status
+ * next_state - next state of the state machine
+ *
+ * Return:
+ * void
+ *
+ *******************************************************************************/
+static void E_EEPROM_XMC1_lHandleGcOtherStates(E_EEPROM_XMC1_DATA_t *const data_ptr, uint32_t current_state,
+        uint32_t next_state)
+{
+    uint32_t  status;
+
+    if (current_state == E_EEPROM_XMC1_GC_NEXT_BANK_VALID)
+    {
+        E_EEPROM_XMC1_lSetMarkerBlockBuffer(data_ptr);
+        /* Write next bank to valid state  (02) or (20) */
+        status = E_EEPROM_XMC1_lGCWrite(data_ptr, (uint32_t)(data_ptr->gc_src_addr + E_EEPROM_XMC1_NEXT_VALID_OFFSET));
+        /* The erase of the previous bank counts its erased pages in the GC block counter */
+        data_ptr->gc_block_counter = 0U;
+    }
+    else
+    {
+        E_EEPROM_XMC1_lSetMarkerBlockBuffer(data_ptr);
+        /* Write formatted state to the old erased bank (E2) or (2E) */
+        status = E_EEPROM_XMC1_lGCWrite(data_ptr, (uint32_t)(data_ptr->gc_dest_addr + E_EEPROM_XMC1_END_ERASE_OFFSET));
+    }
+
+    if (status == 0U)
+    {
+        data_ptr->gc_state = next_state;
+    }
+    else
+    {
+        data_ptr->gc_state = E_EEPROM_XMC1_GC_FAIL;
+    }
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lHandleGcErasePrevBank
+ ********************************************************************************
+ * Summary:
+ * This function handles Garbage Collection GC ERASE PREV BANK state. One page of
+ * the previous redundant bank is erased per call, starting from the last page of
+ * the bank so that the marker page is erased at the end (F2) or (2F). The number
+ * of erased pages is tracked in gc_block_counter.
+ *
+ * Parameters:
+ * data_ptr - State of the region the request operates on
+ *
+ * Return:
+ * void
+ *
+ *******************************************************************************/
+static void E_EEPROM_XMC1_lHandleGcErasePrevBank(E_EEPROM_XMC1_DATA_t *const data_ptr)
+{
+    uint32_t status;
+    uint32_t page_address;
+
+    page_address = (data_ptr->prev_bank_end_addr + 1U) -
+            (E_EEPROM_XMC1_FLASH_PAGE_SIZE * (data_ptr->gc_block_counter + 1U));
+
+    /* Clear all error status flags before flash operation*/
+    XMC_FLASH_ClearStatus();
+
+    E_EEPROM_XMC1_lEraseSinglePage(page_address);
+
+    status = E_EEPROM_XMC1_lGetFlashStatus();
+
+    if (status == 0U)
+    {
+        (data_ptr->gc_block_counter)++;
+        if (data_ptr->gc_block_counter == E_EEPROM_XMC1_BANK_PAGE_COUNT)
+        {
+            data_ptr->gc_state = E_EEPROM_XMC1_GC_MARK_END_ERASE1;
+        }
+    }
+    else
+    {
+        data_ptr->gc_state = E_EEPROM_XMC1_GC_FAIL;
+    }
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lHandleEraseAhead
+ ********************************************************************************
+ * Summary:
+ * This function executes one flash operation of the deferred erase of the
+ * previous bank (erase_ahead mode). Pages are erased starting from the last page
+ * of the bank, the marker page is erased at the end (F2) or (2F). Pages already
+ * erased, e.g. before a reset, are skipped. After the marker page is erased the
+ * bank is marked with formatted state (E2) or (2E).
+ *
+ * Parameters:
+ * data_ptr - State of the region the request operates on
+ *
+ * Return:
+ * void
+ *
+ *******************************************************************************/
+static void E_EEPROM_XMC1_lHandleEraseAhead(E_EEPROM_XMC1_DATA_t *const data_ptr)
+{
+    uint32_t status;
+    uint32_t page_address;
+
+    /* Highest page of the previous bank which is not yet erased */
+    page_address = ((data_ptr->prev_bank_end_addr + 1U) - E_EEPROM_XMC1_BANK_SIZE) +
+            (E_EEPROM_XMC1_FLASH_PAGE_SIZE * (data_ptr->pending_erase_pages - 2U));
+
+    while ((data_ptr->pending_erase_pages > 1U) &&
+            (E_EEPROM_XMC1_lIsFlashErased(data_ptr, page_address, E_EEPROM_XMC1_BLOCKS_PER_PAGE) == 1U))
+    {
+        (data_ptr->pending_erase_pages)--;
+        page_address -= E_EEPROM_XMC1_FLASH_PAGE_SIZE;
+    }
+
+    if (data_ptr->pending_erase_pages > 1U)
+    {
+        /* Clear all error status flags before flash operation*/
+        XMC_FLASH_ClearStatus();
+
+        E_EEPROM_XMC1_lEraseSinglePage(page_address);
+
+        status = E_EEPROM_XMC1_lGetFlashStatus();
+
+        if (status == 0U)
+        {
+            (data_ptr->pending_erase_pages)--;
+        }
+        else
+        {
+            data_ptr->gc_state = E_EEPROM_XMC1_GC_FAIL;
+        }
+    }
+    else
+    {
+        /* Write formatted state to the old erased bank (E2) or (2E) */
+        E_EEPROM_XMC1_lHandleGcOtherStates(data_ptr, E_EEPROM_XMC1_GC_MARK_END_ERASE1, data_ptr->gc_state);
+        if (data_ptr->gc_state != E_EEPROM_XMC1_GC_FAIL)
+        {
+            data_ptr->pending_erase_pages = 0U;
+        }
+    }
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lIsFlashErased
+ ********************************************************************************
+ * Summary:
+ * Checks if consecutive flash blocks are in erased state. The blocks are read
+ * with erased hard read level, hence a block with an interrupted erase is not
+ * reported as erased.
+ *
+ * Parameters:
+ * data_ptr - State of the region the request operates on
+ * address - Start address of the first flash block
+ * num_blocks - Number of flash blocks to be checked
+ *
+ * Return:
+ * uint32_t - 1 if all the blocks are erased, else 0
+ *
+ *******************************************************************************/
+static uint32_t E_EEPROM_XMC1_lIsFlashErased(E_EEPROM_XMC1_DATA_t *const data_ptr, uint32_t address,
+        uint32_t num_blocks)
+{
+    uint32_t indx;
+    uint32_t erased;
+    uint32_t block_address;
+    uint32_t *read_word_ptr;
+
+    read_word_ptr = (uint32_t*)(void*)data_ptr->read_write_buffer;
+    erased = 1U;
+    block_address = address;
+
+    XMC_FLASH_SetHardReadLevel(XMC_FLASH_HARDREAD_LEVEL_ERASED);
+    XMC_FLASH_ClearStatus();
+
+    while ((erased == 1U) && (block_address < (address + (E_EEPROM_XMC1_FLASH_BLOCK_SIZE * num_blocks))))
+    {
+        E_EEPROM_XMC1_lReadSingleBlock(block_address, read_word_ptr);
+        for (indx = 0U; indx < E_EEPROM_XMC1_MAX_WORDS_IN_BLOCK; indx++)
+        {
+            if (read_word_ptr[indx] != E_EEPROM_XMC1_ALL_ONES)
+            {
+                erased = 0U;
+            }
+        }
+        if (E_EEPROM_XMC1_lGetFlashStatus() != 0U)
+        {
+            erased = 0U;
+        }
+        block_address += E_EEPROM_XMC1_FLASH_BLOCK_SIZE;
+    }
+
+    XMC_FLASH_SetHardReadLevel(XMC_FLASH_HARDREAD_LEVEL_WRITTEN);
+
+    return (erased);
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lGetGcProgress
+ ********************************************************************************
+ * Summary:
+ * Fills the progress information of the garbage collection procedure from the
+ * state variables of the handle.
+ *
+ * Parameters:
+ * handle_ptr - Pointer to the handle of the instance
+ * data_ptr - State of the region the request operates on
+ * progress_ptr - Pointer to the progress structure to be filled
+ *
+ * Return:
+ * void
+ *
+ *******************************************************************************/
+static void E_EEPROM_XMC1_lGetGcProgress(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr,
+        E_EEPROM_XMC1_GC_PROGRESS_t *const progress_ptr)
+{
+    progress_ptr->copied_blocks = 0U;
+    progress_ptr->erased_pages = 0U;
+    progress_ptr->total_blocks = handle_ptr->block_count;
+    progress_ptr->total_pages = E_EEPROM_XMC1_BANK_PAGE_COUNT;
+
+    switch (data_ptr->gc_state)
+    {
+    case E_EEPROM_XMC1_GC_IDLE:
+        progress_ptr->phase = E_EEPROM_XMC1_GC_PHASE_IDLE;
+        /* Deferred erase of the previous bank is still ongoing */
+        if (data_ptr->pending_erase_pages != 0U)
+        {
+            progress_ptr->phase = E_EEPROM_XMC1_GC_PHASE_ERASE;
+            progress_ptr->copied_blocks = handle_ptr->block_count;
+            progress_ptr->erased_pages = (E_EEPROM_XMC1_BANK_PAGE_COUNT + 1U) - data_ptr->pending_erase_pages;
+        }
+        break;
+
+    case E_EEPROM_XMC1_GC_REQUESTED:
+    case E_EEPROM_XMC1_GC_COPY_START:
+    case E_EEPROM_XMC1_GC_COPY_WRITE:
+    case E_EEPROM_XMC1_GC_READ_NXTBLOCK:
+        progress_ptr->phase = E_EEPROM_XMC1_GC_PHASE_COPY;
+        progress_ptr->copied_blocks = data_ptr->gc_log_block_count;
+        break;
+
+    case E_EEPROM_XMC1_GC_WRITE_INDEX:
+    case E_EEPROM_XMC1_GC_COPY_END:
+    case E_EEPROM_XMC1_GC_NEXT_BANK_VALID:
+    case E_EEPROM_XMC1_GC_RECLAIM_BANK:
+        progress_ptr->phase = E_EEPROM_XMC1_GC_PHASE_SWITCH;
+        progress_ptr->copied_blocks = handle_ptr->block_count;
+        break;
+
+    case E_EEPROM_XMC1_GC_ERASE_PREV_BANK:
+    case E_EEPROM_XMC1_GC_MARK_END_ERASE1:
+    case E_EEPROM_XMC1_GC_ERASE_RECLAIMED:
+        progress_ptr->phase = E_EEPROM_XMC1_GC_PHASE_ERASE;
+        progress_ptr->copied_blocks = handle_ptr->block_count;
+        progress_ptr->erased_pages = data_ptr->gc_block_counter;
+        if (data_ptr->gc_state == E_EEPROM_XMC1_GC_MARK_END_ERASE1)
+        {
+            progress_ptr->erased_pages = E_EEPROM_XMC1_BANK_PAGE_COUNT;
+        }
+        break;
+
+    default:
+        progress_ptr->phase = E_EEPROM_XMC1_GC_PHASE_FAILED;
+        break;
+    }
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lPrepareDFlash
+ ********************************************************************************
+ * Summary:
+ * This function executes the prepare data flash to bring the state machine to
+ * default state (2E).
+ *
+ * Parameters:
+ * data_ptr - State of the region the request operates on
+ *
+ * Return:
+ * void
+ *
+ *******************************************************************************/
+static void E_EEPROM_XMC1_lPrepareDFlash(E_EEPROM_XMC1_DATA_t *const data_ptr)
+{
+    uint32_t status;
+
+    do
+    {
+        switch (data_ptr->gc_state)
+        {
+        case E_EEPROM_XMC1_PREPFLASH_2F:
+
+            /* Set the marker blocks with copy completed state */
+            E_EEPROM_XMC1_lSetMarkerPageBuffer(data_ptr, E_EEPROM_XMC1_VALID_STATE);
+
+            /* Clear all error status flags before flash operation*/
+            XMC_FLASH_ClearStatus();
+
+            E_EEPROM_XMC1_lWriteSinglePage(E_EEPROM_XMC1_BANK0_BASE , (uint32_t*)(void*)data_ptr->page_write_buffer);
+
+            status = E_EEPROM_XMC1_lGetFlashStatus();
+
+            if (status == 0U)
+            {
+                data_ptr->gc_state = E_EEPROM_XMC1_PREPFLASH_2E;
+            }
+            else
+            {
+                data_ptr->gc_state = E_EEPROM_XMC1_GC_FAIL;
+            }
+            break;
+
+        case E_EEPROM_XMC1_PREPFLASH_2E:
+
+            E_EEPROM_XMC1_lSetMarkerBlockBuffer(data_ptr);
+
+            /* Write Bank1 to formatted state  (2E) */
+            status = E_EEPROM_XMC1_lGCWrite(data_ptr,
+                    (uint32_t)E_EEPROM_XMC1_BANK1_BASE + E_EEPROM_XMC1_END_ERASE_OFFSET);
+
+            if (status == 0U)
+            {
+                data_ptr->gc_state = E_EEPROM_XMC1_GC_IDLE;
+            }
+            else
+            {
+                data_ptr->gc_state = E_EEPROM_XMC1_GC_FAIL;
+            }
+            break;
+
+        default:  /* gc_state : E_EEPROM_XMC1_PREPFLASH_FF*/
+
+            /* Erase the previous redundant bank */
+            status = E_EEPROM_XMC1_lEraseBank(data_ptr, data_ptr->curr_bank_end_addr);
+
+            /* Erase the previous redundant bank */
+            if (status == 0U)
+            {
+                status = E_EEPROM_XMC1_lEraseBank(data_ptr, data_ptr->prev_bank_end_addr);
+
+                if (status == 0U)
+                {
+                    data_ptr->gc_state = E_EEPROM_XMC1_PREPFLASH_2F;
+                }
+                else
+                {
+                    data_ptr->gc_state = E_EEPROM_XMC1_GC_FAIL;
+                }
+            }
+            else
+            {
+                data_ptr->gc_state = E_EEPROM_XMC1_GC_FAIL;
+            }
+            break;
+        }
+    } while ((data_ptr->gc_state != E_EEPROM_XMC1_GC_IDLE) &&
+            (data_ptr->gc_state != E_EEPROM_XMC1_GC_FAIL));
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lUpdateCache
+ ********************************************************************************
+ * Summary:
+ * This utility function update's the cache table which contains the latest
+ * information about the FLASH contents.
+ *
+ * Parameters:
+ * handle_ptr - Pointer to the handle of the instance
+ * data_ptr - State of the region the request operates on
+ *
+ * Return:
+ * void
+ *
+ *******************************************************************************/
+static void E_EEPROM_XMC1_lUpdateCache(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr)
+{
+    uint32_t indx;
+    uint32_t bank;
+    uint32_t end_addr;
+    uint32_t read_status;
+    uint32_t bank_base_addr;
+    uint32_t checkpoint_addr;
+    E_EEPROM_XMC1_CACHE_t *cache_ptr;
+
+    /* Evaluate the end address of the bank to start reading blocks for cache update */
+    bank_base_addr = E_EEPROM_XMC1_BANK_BASE(data_ptr->current_bank);
+    end_addr = bank_base_addr + E_EEPROM_XMC1_DATA_BLOCK_OFFSET;
+
+    /* With a valid checkpoint index only the blocks written after the checkpoint are read */
+    checkpoint_addr = E_EEPROM_XMC1_lReadCheckpointIndex(handle_ptr, data_ptr, bank_base_addr);
+    if (checkpoint_addr != 0U)
+    {
+        end_addr = checkpoint_addr;
+    }
+
+    /* Find the last written block and the next free block location */
+    bank = data_ptr->current_bank;
+    read_status = E_EEPROM_XMC1_lSearchNextFreeBlock(data_ptr, bank_base_addr, end_addr);
+
+    do
+    {
+        /* Execute the Cache update state machine until the Start address of bank is reached from end of bank */
+        while (data_ptr->cache_state != E_EEPROM_XMC1_CACHE_UPDATE_DONE)
+        {
+            /* Check If the previous read had an ECC error or not */
+            if (!(read_status & (uint32_t)XMC_FLASH_STATUS_ECC2_READ_ERROR))
+            {
+                /* Evaluate the Block status since no error found */
+                E_EEPROM_XMC1_lEvalBlockStatus(handle_ptr, data_ptr);
+            }
+            else
+            {
+                /* If previous read block of the block had correct block number then mark it as inconsistent */
+                if ( data_ptr->updated_cache_index != E_EEPROM_XMC1_LOG_BLOCK_NOT_FOUND )
+                {
+                    /* Goto the cache table entry for the given block */
+                    cache_ptr = data_ptr->block_info;
+                    cache_ptr = cache_ptr + data_ptr->updated_cache_index;
+                    /* Since CacheUpdateIndex contains valid block the previous read block must belong to it */
+                    cache_ptr->address = E_EEPROM_XMC1_ALL_ONES;
+                }
+                /* Prepare for the next block */
+                data_ptr->updated_cache_index = E_EEPROM_XMC1_LOG_BLOCK_NOT_FOUND;
+                data_ptr->written_block_counter = 0U;
+            }
+            /* Check if all blocks have been read */
+            if ( data_ptr->curr_bank_src_addr == end_addr )
+            {
+                /* Goto the next state */
+                data_ptr->cache_state = E_EEPROM_XMC1_CACHE_UPDATE_DONE;
+            }
+            else
+            {
+                read_status = E_EEPROM_XMC1_lUpdateCacheBlockRead(data_ptr);
+            }
+        }
+
+        /* A rotating log is scanned segment by segment from the newest to the oldest segment */
+        bank = E_EEPROM_XMC1_lGetOlderSegment(data_ptr, bank);
+        if (bank < E_EEPROM_XMC1_BANK_COUNT)
+        {
+            end_addr = E_EEPROM_XMC1_BANK_BASE(bank) + E_EEPROM_XMC1_DATA_BLOCK_OFFSET;
+            read_status = E_EEPROM_XMC1_lSearchNextFreeBlock(data_ptr, E_EEPROM_XMC1_BANK_BASE(bank), end_addr);
+        }
+    } while (bank < E_EEPROM_XMC1_BANK_COUNT);
+
+    /* Blocks not written after the checkpoint are taken from the checkpoint index */
+    if (checkpoint_addr != 0U)
+    {
+        E_EEPROM_XMC1_lApplyCheckpointIndex(handle_ptr, data_ptr, bank_base_addr);
+    }
+
+    /* All cache entries are up to date */
+    cache_ptr = data_ptr->block_info;
+    for (indx = 0U; indx < handle_ptr->block_count; indx++)
+    {
+        cache_ptr->status.resolved = 1U;
+        cache_ptr++;
+    }
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lSearchNextFreeBlock
+ ********************************************************************************
+ * Summary:
+ * Searches the last written block of the bank backwards from the end of the
+ * bank and updates the next free block location. The cache update state machine
+ * is left at the last written block.
+ *
+ * Parameters:
+ * data_ptr - State of the region the request operates on
+ * bank_base_addr - Base address of the bank
+ * end_addr - Address of the lowest block to be searched
+ *
+ * Return:
+ * uint32_t - Flash status of the last block read
+ *
+ *******************************************************************************/
+static uint32_t E_EEPROM_XMC1_lSearchNextFreeBlock(E_EEPROM_XMC1_DATA_t *const data_ptr, uint32_t bank_base_addr,
+        uint32_t end_addr)
+{
+    uint32_t read_status;
+
+    read_status = 0U;
+
+    /* Reset the read number of blocks count variable and reset cache update index */
+    data_ptr->written_block_counter = 0U;
+    data_ptr->updated_cache_index = E_EEPROM_XMC1_LOG_BLOCK_NOT_FOUND;
+
+    /* Start the Cache Update state machine */
+    data_ptr->cache_state = E_EEPROM_XMC1_CACHE_EMPTY_BLOCK;
+
+    /*
+     * Point to starting address of last data block of the bank. The erased blocks at the end of the bank are
+     * skipped with a binary search, the search for the first non empty block below starts from there.
+     */
+    data_ptr->curr_bank_src_addr = bank_base_addr + ( E_EEPROM_XMC1_BANK_SIZE - E_EEPROM_XMC1_FLASH_BLOCK_SIZE);
+    if ((end_addr + E_EEPROM_XMC1_FRONTIER_GUARD) < data_ptr->curr_bank_src_addr)
+    {
+        data_ptr->curr_bank_src_addr = E_EEPROM_XMC1_lSearchFreeBlockFrontier(end_addr, data_ptr->curr_bank_src_addr);
+    }
+
+    /* Bank completely filled by the garbage collection, nothing written after the checkpoint */
+    if (end_addr == (bank_base_addr + E_EEPROM_XMC1_BANK_SIZE))
+    {
+        data_ptr->next_free_block_addr = end_addr;
+        data_ptr->cache_state = E_EEPROM_XMC1_CACHE_UPDATE_DONE;
+    }
+    else
+    {
+        /* Search for the first entry of a non empty block inside the valid bank starting from bottom */
+        do{
+            read_status = E_EEPROM_XMC1_lCacheEmptyBlkEval(data_ptr, end_addr);
+        } while (data_ptr->cache_state == E_EEPROM_XMC1_CACHE_EMPTY_BLOCK);
+    }
+
+    /* Update the next free block location only if it is not done by the previous function call  */
+    if (data_ptr->next_free_block_addr == 0U)
+    {
+        data_ptr->next_free_block_addr = (data_ptr->curr_bank_src_addr) + E_EEPROM_XMC1_FLASH_BLOCK_SIZE;
+    }
+
+    return (read_status);
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lMountBank
+ ********************************************************************************
+ * Summary:
+ * Lazy mount of the valid bank. Only the next free block location and the
+ * checkpoint index are evaluated. The cache entries are updated on the first
+ * access to each block by E_EEPROM_XMC1_lResolveCacheEntry(handle_ptr, data_ptr).
+ *
+ * Parameters:
+ * handle_ptr - Pointer to the handle of the instance
+ * data_ptr - State of the region the request operates on
+ *
+ * Return:
+ * void
+ *
+ *******************************************************************************/
+static void E_EEPROM_XMC1_lMountBank(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr)
+{
+    uint32_t end_addr;
+    uint32_t bank_base_addr;
+
+    bank_base_addr = E_EEPROM_XMC1_BANK_BASE(data_ptr->current_bank);
+    end_addr = bank_base_addr + E_EEPROM_XMC1_DATA_BLOCK_OFFSET;
+
+    /* Blocks older than the checkpoint are found in the checkpoint index */
+    data_ptr->checkpoint_addr = E_EEPROM_XMC1_lReadCheckpointIndex(handle_ptr, data_ptr, bank_base_addr);
+    if (data_ptr->checkpoint_addr != 0U)
+    {
+        end_addr = data_ptr->checkpoint_addr;
+    }
+
+    (void)E_EEPROM_XMC1_lSearchNextFreeBlock(data_ptr, bank_base_addr, end_addr);
+
+    data_ptr->updated_cache_index = E_EEPROM_XMC1_LOG_BLOCK_NOT_FOUND;
+    data_ptr->written_block_counter = 0U;
+    data_ptr->cache_state = E_EEPROM_XMC1_CACHE_IDLE;
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lResolveCacheEntry
+ ********************************************************************************
+ * Summary:
+ * Updates the cache entry of a block not yet evaluated after a lazy mount. The
+ * latest copy of the block is searched backwards from the last written block
+ * down to the checkpoint. If it is not found, the entry of the checkpoint index
+ * is taken. In a rotating log the older segments are searched instead. The
+ * result is kept in the cache, hence the search is done once. A block of the
+ * other region is not searched.
+ *
+ * Parameters:
+ * handle_ptr - Pointer to the handle of the instance
+ * data_ptr - State of the region the request operates on
+ * block_index - Index of the block in the user configuration
+ *
+ * Return:
+ * void
+ *
+ *******************************************************************************/
+static void E_EEPROM_XMC1_lResolveCacheEntry(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr,
+        uint32_t block_index)
+{
+    uint32_t bank;
+    uint32_t entry;
+    uint32_t end_addr;
+    uint32_t bank_base_addr;
+    uint32_t block_start_addr;
+    uint32_t physical_blocks;
+    E_EEPROM_XMC1_CACHE_t *cache_ptr;
+
+    cache_ptr = data_ptr->block_info + block_index;
+
+    /* A block of the other temperature class is never written in this region */
+    if ((cache_ptr->status.resolved == 0U) && (E_EEPROM_XMC1_lGetBlockRegion(handle_ptr, block_index) != data_ptr))
+    {
+        cache_ptr->status.resolved = 1U;
+    }
+
+    if (cache_ptr->status.resolved == 0U)
+    {
+        data_ptr->live_flash_blocks -= E_EEPROM_XMC1_lGetEntryLiveBlocks(handle_ptr, data_ptr, block_index);
+
+        bank_base_addr = E_EEPROM_XMC1_BANK_BASE(data_ptr->current_bank);
+        end_addr = bank_base_addr + E_EEPROM_XMC1_DATA_BLOCK_OFFSET;
+        if (data_ptr->checkpoint_addr != 0U)
+        {
+            end_addr = data_ptr->checkpoint_addr;
+        }
+
+        block_start_addr = 0U;
+        if (data_ptr->next_free_block_addr > end_addr)
+        {
+            block_start_addr = E_EEPROM_XMC1_lSearchBlockCopy(data_ptr,
+                    handle_ptr->block_config_ptr[block_index].block_number,
+                    data_ptr->next_free_block_addr - E_EEPROM_XMC1_FLASH_BLOCK_SIZE, end_addr);
+        }
+
+        /* The older segments of a rotating log are searched from the newest one on */
+        bank = E_EEPROM_XMC1_lGetOlderSegment(data_ptr, data_ptr->current_bank);
+        while ((block_start_addr == 0U) && (bank < E_EEPROM_XMC1_BANK_COUNT))
+        {
+            block_start_addr = E_EEPROM_XMC1_lSearchBlockCopy(data_ptr,
+                    handle_ptr->block_config_ptr[block_index].block_number,
+                    (E_EEPROM_XMC1_BANK_BASE(bank) + E_EEPROM_XMC1_BANK_SIZE) - E_EEPROM_XMC1_FLASH_BLOCK_SIZE,
+                    E_EEPROM_XMC1_BANK_BASE(bank) + E_EEPROM_XMC1_DATA_BLOCK_OFFSET);
+            bank = E_EEPROM_XMC1_lGetOlderSegment(data_ptr, bank);
+        }
+
+        if (block_start_addr != 0U)
+        {
+            cache_ptr->address = block_start_addr;
+            cache_ptr->status.valid = data_ptr->block_result.status.valid;
+            cache_ptr->status.crc = data_ptr->block_result.status.crc;
+
+            /* Same evaluation as the cache update: an invalidated block is always consistent */
+            physical_blocks = E_EEPROM_XMC1_lGetDFLASHPhysicalBlocks(
+                    (uint32_t)handle_ptr->block_config_ptr[block_index].size);
+            if ((cache_ptr->status.valid == 0U) ||
+                    ((data_ptr->block_result.status.consistent == 1U) &&
+                     (data_ptr->block_result.block_count == physical_blocks)))
+            {
+                cache_ptr->status.consistent = 1U;
+            }
+            else
+            {
+                cache_ptr->status.consistent = 0U;
+            }
+        }
+        else if (data_ptr->checkpoint_addr != 0U)
+        {
+            /* Clear all error status flags before flash operation*/
+            XMC_FLASH_ClearStatus();
+
+            entry = E_EEPROM_XMC1_lReadSingleWord(bank_base_addr + E_EEPROM_XMC1_INDEX_OFFSET +
+                    ((E_EEPROM_XMC1_INDEX_HEADER_WORDS + block_index) * E_EEPROM_XMC1_FOUR_BYTES));
+
+            if ((E_EEPROM_XMC1_lGetFlashStatus() & (uint32_t)XMC_FLASH_STATUS_ECC2_READ_ERROR) == 0U)
+            {
+                E_EEPROM_XMC1_lSetCacheFromIndexEntry(cache_ptr, entry, bank_base_addr);
+            }
+        }
+        else
+        {
+            /* Block never written in this bank */
+        }
+
+        cache_ptr->status.resolved = 1U;
+        data_ptr->live_flash_blocks += E_EEPROM_XMC1_lGetEntryLiveBlocks(handle_ptr, data_ptr, block_index);
+
+        E_EEPROM_XMC1_lSealWarmState(handle_ptr, data_ptr);
+    }
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lResolveCache
+ ********************************************************************************
+ * Summary:
+ * Updates the cache entries of all blocks not yet evaluated after a lazy mount.
+ *
+ * Parameters:
+ * handle_ptr - Pointer to the handle of the instance
+ * data_ptr - State of the region the request operates on
+ *
+ * Return:
+ * void
+ *
+ *******************************************************************************/
+static void E_EEPROM_XMC1_lResolveCache(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr)
+{
+    uint32_t indx;
+
+    for (indx = 0U; indx < handle_ptr->block_count; indx++)
+    {
+        E_EEPROM_XMC1_lResolveCacheEntry(handle_ptr, data_ptr, indx);
+    }
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lSearchFreeBlockFrontier
+ ********************************************************************************
+ * Summary:
+ * Searches the boundary between the written and the erased blocks of the bank
+ * with a binary search on the block header words. The blocks are written in
+ * ascending order, hence all blocks above the first written block found are
+ * erased. Blocks with ECC errors are handled as written. The returned address
+ * is one page above the boundary, the linear search for the first non empty
+ * block starts from there to evaluate the blocks around the boundary as before.
+ *
+ * Parameters:
+ * end_addr - Address of the lowest block to be searched
+ * last_block_addr - Address of the last block of the bank
+ *
+ * Return:
+ * uint32_t - Address of the block to start the linear search
+ *
+ *******************************************************************************/
+static uint32_t E_EEPROM_XMC1_lSearchFreeBlockFrontier(uint32_t end_addr, uint32_t last_block_addr)
+{
+    uint32_t low_addr;
+    uint32_t high_addr;
+    uint32_t mid_addr;
+
+    /* Invariant: blocks below low_addr are written, blocks from high_addr are erased */
+    low_addr = end_addr;
+    high_addr = last_block_addr + E_EEPROM_XMC1_FLASH_BLOCK_SIZE;
+
+    while (low_addr < high_addr)
+    {
+        mid_addr = low_addr + ((((high_addr - low_addr) / E_EEPROM_XMC1_FLASH_BLOCK_SIZE) / 2U) *
+                E_EEPROM_XMC1_FLASH_BLOCK_SIZE);
+
+        if (E_EEPROM_XMC1_lIsBlockWritten(mid_addr) == 1U)
+        {
+            low_addr = mid_addr + E_EEPROM_XMC1_FLASH_BLOCK_SIZE;
+        }
+        else
+        {
+            high_addr = mid_addr;
+        }
+    }
+
+    /* Keep a guard of one page above the boundary for the linear search */
+    high_addr += E_EEPROM_XMC1_FRONTIER_GUARD;
+    if (high_addr > last_block_addr)
+    {
+        high_addr = last_block_addr;
+    }
+
+    return (high_addr);
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lIsBlockWritten
+ ********************************************************************************
+ * Summary:
+ * Checks if a flash block is written by reading the header word of the block.
+ * The header word of a written block is never all ones. A block with ECC error
+ * is handled as written.
+ *
+ * Parameters:
+ * block_address - Flash address of the block
+ *
+ * Return:
+ * uint32_t - 1 if the block is written, else 0
+ *
+ *******************************************************************************/
+static uint32_t E_EEPROM_XMC1_lIsBlockWritten(uint32_t block_address)
+{
+    uint32_t written;
+    uint32_t header_word;
+
+    written = 0U;
+
+    /* Clear all error status flags before flash operation*/
+    XMC_FLASH_ClearStatus();
+
+    header_word = E_EEPROM_XMC1_lReadSingleWord(block_address);
+
+    if (((E_EEPROM_XMC1_lGetFlashStatus() & (uint32_t)XMC_FLASH_STATUS_ECC2_READ_ERROR) != 0U) ||
+            (header_word != E_EEPROM_XMC1_ALL_ONES))
+    {
+        written = 1U;
+    }
+
+    return (written);
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lReadCheckpointIndex
+ ********************************************************************************
+ * Summary:
+ * Reads the checkpoint index written by the garbage collection from the marker
+ * page of the bank into the page buffer and verifies it against the user block
+ * configuration.
+ *
+ * Parameters:
+ * handle_ptr - Pointer to the handle of the instance
+ * data_ptr - State of the region the request operates on
+ * bank_base_addr - Base address of the bank
+ *
+ * Return:
+ * uint32_t - Flash address of the checkpoint, 0 if no valid index is found
+ *
+ *******************************************************************************/
+static uint32_t E_EEPROM_XMC1_lReadCheckpointIndex(E_EEPROM_XMC1_t *const handle_ptr,
+        E_EEPROM_XMC1_DATA_t *const data_ptr, uint32_t bank_base_addr)
+{
+    uint32_t indx;
+    uint32_t entry;
+    uint32_t entry_block;
+    uint32_t index_blocks;
+    uint32_t frontier_block;
+    uint32_t checkpoint_addr;
+    uint32_t *index_ptr;
+
+    index_ptr = (uint32_t*)(void*)data_ptr->page_write_buffer;
+    index_blocks = 1U + (((uint32_t)handle_ptr->block_count + (E_EEPROM_XMC1_MAX_WORDS_IN_BLOCK - 1U)) /
+            E_EEPROM_XMC1_MAX_WORDS_IN_BLOCK);
+
+    /* Clear all error status flags before flash operation*/
+    XMC_FLASH_ClearStatus();
+
+    E_EEPROM_XMC1_lReadBlocks(bank_base_addr + E_EEPROM_XMC1_INDEX_OFFSET, index_ptr, index_blocks);
+
+    checkpoint_addr = 0U;
+    frontier_block = index_ptr[E_EEPROM_XMC1_INDEX_FRONTIER_WORD] / E_EEPROM_XMC1_FLASH_BLOCK_SIZE;
+
+    /* Index must be readable, complete and written for the same block configuration */
+    if (((E_EEPROM_XMC1_lGetFlashStatus() & (uint32_t)XMC_FLASH_STATUS_ECC2_READ_ERROR) == 0U) &&
+            (index_ptr[0] == E_EEPROM_XMC1_INDEX_MAGIC) &&
+            (index_ptr[E_EEPROM_XMC1_INDEX_COUNT_WORD] == handle_ptr->block_count) &&
+            (index_ptr[E_EEPROM_XMC1_INDEX_CHECKSUM_WORD] ==
+                    E_EEPROM_XMC1_lGetIndexChecksum(index_ptr, index_blocks * E_EEPROM_XMC1_MAX_WORDS_IN_BLOCK)) &&
+            (index_ptr[E_EEPROM_XMC1_INDEX_FRONTIER_WORD] >= E_EEPROM_XMC1_DATA_BLOCK_OFFSET) &&
+            (index_ptr[E_EEPROM_XMC1_INDEX_FRONTIER_WORD] <= E_EEPROM_XMC1_BANK_SIZE))
+    {
+        checkpoint_addr = bank_base_addr + index_ptr[E_EEPROM_XMC1_INDEX_FRONTIER_WORD];
+
+        for (indx = 0U; indx < handle_ptr->block_count; indx++)
+        {
+            entry = index_ptr[E_EEPROM_XMC1_INDEX_HEADER_WORDS + indx];
+            entry_block = entry & E_EEPROM_XMC1_INDEX_BLOCK_MASK;
+            if ((((entry & E_EEPROM_XMC1_INDEX_NUMBER_MASK) >> E_EEPROM_XMC1_INDEX_NUMBER_SHIFT) !=
+                    handle_ptr->block_config_ptr[indx].block_number) ||
+                    ((entry_block != 0U) && (entry_block >= frontier_block)))
+            {
+                checkpoint_addr = 0U;
+            }
+        }
+    }
+
+    return (checkpoint_addr);
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lApplyCheckpointIndex
+ ********************************************************************************
+ * Summary:
+ * Updates the cache entries of the blocks which are not found after the
+ * checkpoint with the address and status stored in the checkpoint index. The
+ * index is expected in the page buffer.
+ *
+ * Parameters:
+ * handle_ptr - Pointer to the handle of the instance
+ * data_ptr - State of the region the request operates on
+ * bank_base_addr - Base address of the bank
+ *
+ * Return:
+ * void
+ *
+ *******************************************************************************/
+static void E_EEPROM_XMC1_lApplyCheckpointIndex(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr,
+        uint32_t bank_base_addr)
+{
+    uint32_t indx;
+    uint32_t entry;
+    uint32_t *index_ptr;
+    E_EEPROM_XMC1_CACHE_t *cache_ptr;
+
+    index_ptr = (uint32_t*)(void*)data_ptr->page_write_buffer;
+    cache_ptr = data_ptr->block_info;
+
+    for (indx = 0U; indx < handle_ptr->block_count; indx++)
+    {
+        entry = index_ptr[E_EEPROM_XMC1_INDEX_HEADER_WORDS + indx];
+        /* Cache address 0U => block not found after the checkpoint */
+        if (cache_ptr->address == 0U)
+        {
+            E_EEPROM_XMC1_lSetCacheFromIndexEntry(cache_ptr, entry, bank_base_addr);
+        }
+        cache_ptr++;
+    }
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lSetCacheFromIndexEntry
+ ********************************************************************************
+ * Summary:
+ * Updates a cache entry with the address and status stored in an entry of the
+ * checkpoint index. Nothing is updated if the block is not stored in the index.
+ *
+ * Parameters:
+ * cache_ptr - Pointer to the cache entry
+ * entry - Entry of the checkpoint index
+ * bank_base_addr - Base address of the bank
+ *
+ * Return:
+ * void
+ *
+ *******************************************************************************/
+static void E_EEPROM_XMC1_lSetCacheFromIndexEntry(E_EEPROM_XMC1_CACHE_t *const cache_ptr, uint32_t entry,
+        uint32_t bank_base_addr)
+{
+    if ((entry & E_EEPROM_XMC1_INDEX_BLOCK_MASK) != 0U)
+    {
+        cache_ptr->address = bank_base_addr +
+                ((entry & E_EEPROM_XMC1_INDEX_BLOCK_MASK) * E_EEPROM_XMC1_FLASH_BLOCK_SIZE);
+        cache_ptr->status.consistent = 1U;
+        cache_ptr->status.valid = 0U;
+        cache_ptr->status.crc = 0U;
+        if ((entry & E_EEPROM_XMC1_INDEX_VALID_FLAG) != 0U)
+        {
+            cache_ptr->status.valid = 1U;
+            if ((entry & E_EEPROM_XMC1_INDEX_CRC_FLAG) != 0U)
+            {
+                cache_ptr->status.crc = 1U;
+            }
+        }
+    }
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lGetIndexChecksum
+ ********************************************************************************
+ * Summary:
+ * Calculates the checksum of the checkpoint index. The checksum word itself is
+ * excluded from the calculation.
+ *
+ * Parameters:
+ * index_ptr - Pointer to the checkpoint index
+ * index_words - Number of words of the index
+ *
+ * Return:
+ * uint32_t - Checksum of the index
+ *
+ *******************************************************************************/
+static uint32_t E_EEPROM_XMC1_lGetIndexChecksum(const uint32_t *const index_ptr, uint32_t index_words)
+{
+    uint32_t indx;
+    uint32_t checksum;
+
+    checksum = 0U;
+    for (indx = 0U; indx < index_words; indx++)
+    {
+        if (indx != E_EEPROM_XMC1_INDEX_CHECKSUM_WORD)
+        {
+            /* Rotate before adding so that swapped words change the checksum */
+            checksum = ((checksum << 1U) | (checksum >> 31U)) + index_ptr[indx];
+        }
+    }
+    return (~checksum);
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lSealWarmState
+ ********************************************************************************
+ * Summary:
+ * Seals the run time state with a checksum, hence it can be used by the
+ * initialization after a warm reset. Only done if
+ * E_EEPROM_XMC1_WARM_RESET_ENABLED is defined.
+ *
+ * Parameters:
+ * handle_ptr - Pointer to the handle of the instance
+ * data_ptr - State of the region the request operates on
+ *
+ * Return:
+ * void
+ *
+ *******************************************************************************/
+static void E_EEPROM_XMC1_lSealWarmState(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr)
+{
+#ifdef E_EEPROM_XMC1_WARM_RESET_ENABLED
+    data_ptr->warm_checksum = E_EEPROM_XMC1_lGetWarmChecksum(handle_ptr, data_ptr);
+#else
+    (void)handle_ptr;
+    (void)data_ptr;
+#endif
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lUnsealWarmState
+ ********************************************************************************
+ * Summary:
+ * Invalidates the seal of the run time state before the flash gets modified.
+ * Incrementing the generation counter changes the checksum of the state. Only
+ * done if E_EEPROM_XMC1_WARM_RESET_ENABLED is defined.
+ *
+ * Parameters:
+ * data_ptr - State of the region the request operates on
+ *
+ * Return:
+ * void
+ *
+ *******************************************************************************/
+static void E_EEPROM_XMC1_lUnsealWarmState(E_EEPROM_XMC1_DATA_t *const data_ptr)
+{
+#ifdef E_EEPROM_XMC1_WARM_RESET_ENABLED
+    data_ptr->warm_generation++;
+#else
+    (void)data_ptr;
+#endif
+}
+
+#ifdef E_EEPROM_XMC1_WARM_RESET_ENABLED
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lIsWarmStateValid
+ ********************************************************************************
+ * Summary:
+ * Checks if the run time state of all regions kept in no-init RAM is sealed and
+ * belongs to the current configuration.
+ *
+ * Parameters:
+ * handle_ptr - Pointer to the handle of the instance
+ *
+ * Return:
+ * uint32_t - 1 if the state can be used, else 0
+ *
+ *******************************************************************************/
+static uint32_t E_EEPROM_XMC1_lIsWarmStateValid(E_EEPROM_XMC1_t *const handle_ptr)
+{
+    uint32_t valid;
+    E_EEPROM_XMC1_DATA_t *data_ptr;
+
+    data_ptr = handle_ptr->data_ptr;
+
+    valid = 0U;
+    if ((data_ptr->gc_state == E_EEPROM_XMC1_GC_IDLE) &&
+            (data_ptr->warm_checksum == E_EEPROM_XMC1_lGetWarmChecksum(handle_ptr, data_ptr)))
+    {
+        valid = 1U;
+    }
+
+    /* The state of the region of the cold blocks must be sealed as well */
+    if ((valid == 1U) && (handle_ptr->cold_data_ptr != NULL))
+    {
+        data_ptr = handle_ptr->cold_data_ptr;
+
+        if ((data_ptr->gc_state != E_EEPROM_XMC1_GC_IDLE) ||
+                (data_ptr->warm_checksum != E_EEPROM_XMC1_lGetWarmChecksum(handle_ptr, data_ptr)))
+        {
+            valid = 0U;
+        }
+    }
+    return (valid);
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lGetWarmChecksum
+ ********************************************************************************
+ * Summary:
+ * Calculates the checksum of the run time state which is kept over a warm
+ * reset: the bank geometry, the bank and garbage collection state, the size
+ * and contents of the cache table and the user block configuration. The
+ * internal buffers are not included.
+ *
+ * Parameters:
+ * handle_ptr - Pointer to the handle of the instance
+ * data_ptr - State of the region the request operates on
+ *
+ * Return:
+ * uint32_t - Checksum of the run time state
+ *
+ *******************************************************************************/
+static uint32_t E_EEPROM_XMC1_lGetWarmChecksum(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr)
+{
+    uint32_t indx;
+    uint32_t checksum;
+    uint32_t status_word;
+    uint32_t state_words[21];
+    E_EEPROM_XMC1_CACHE_STATUS_t *status_ptr;
+
+    state_words[0] = E_EEPROM_XMC1_WARM_MAGIC;
+    state_words[1] = data_ptr->warm_generation;
+    state_words[2] = handle_ptr->block_count * (uint32_t)sizeof(E_EEPROM_XMC1_CACHE_t);
+    state_words[3] = data_ptr->current_bank;
+    state_words[4] = data_ptr->gc_state;
+    state_words[5] = data_ptr->next_free_block_addr;
+    state_words[6] = data_ptr->curr_bank_src_addr;
+    state_words[7] = data_ptr->gc_src_addr;
+    state_words[8] = data_ptr->gc_dest_addr;
+    state_words[9] = data_ptr->curr_bank_end_addr;
+    state_words[10] = data_ptr->prev_bank_end_addr;
+    state_words[11] = data_ptr->gc_block_counter;
+    state_words[12] = data_ptr->pending_erase_pages;
+    state_words[13] = data_ptr->checkpoint_addr;
+    state_words[14] = data_ptr->bank0_base;
+    state_words[15] = data_ptr->bank_size;
+    state_words[16] = ((uint32_t)handle_ptr->block_count << 24U) |
+            ((uint32_t)handle_ptr->data_block_crc << 16U) |
+            ((uint32_t)handle_ptr->erase_ahead << 8U) |
+            (uint32_t)handle_ptr->lazy_mount;
+    state_words[17] = data_ptr->bank_count;
+    state_words[18] = data_ptr->gc_victim_bank;
+    state_words[19] = data_ptr->live_flash_blocks;
+    state_words[20] = data_ptr->idle_gc_active;
+
+    checksum = 0U;
+    for (indx = 0U; indx < 21U; indx++)
+    {
+        checksum = ((checksum << 1U) | (checksum >> 31U)) + state_words[indx];
+    }
+
+    for (indx = 0U; indx < E_EEPROM_XMC1_MAX_BANK_COUNT; indx++)
+    {
+        checksum = ((checksum << 1U) | (checksum >> 31U)) + data_ptr->bank_seq[indx];
+    }
+
+    for (indx = 0U; indx < handle_ptr->block_count; indx++)
+    {
+        checksum = ((checksum << 1U) | (checksum >> 31U)) +
+                handle_ptr->block_config_ptr[indx].block_number;
+        checksum = ((checksum << 1U) | (checksum >> 31U)) + handle_ptr->block_config_ptr[indx].size;
+        checksum = ((checksum << 1U) | (checksum >> 31U)) +
+                handle_ptr->block_config_ptr[indx].temperature;
+        checksum = ((checksum << 1U) | (checksum >> 31U)) + data_ptr->block_info[indx].address;
+
+        /* The status bits are hashed one by one, the unused bits of the bit field are not defined */
+        status_ptr = &data_ptr->block_info[indx].status;
+        status_word = ((uint32_t)status_ptr->valid) | ((uint32_t)status_ptr->consistent << 1U) |
+                ((uint32_t)status_ptr->copied << 2U) | ((uint32_t)status_ptr->crc << 3U) |
+                ((uint32_t)status_ptr->resolved << 4U);
+        checksum = ((checksum << 1U) | (checksum >> 31U)) + status_word;
+    }
+
+    return (~checksum);
+}
+#endif
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lCacheEmptyBlkEval
+ ********************************************************************************
+ * Summary:
+ * This utility function  will search through the FLASH from the bottom of the
+ * bank until a readable data block is found.
+ *
+ * Parameters:
+ * data_ptr - State of the region the request operates on
+ * end_addr - Last address to stop reading the block data
+ *
+ * Return:
+ * uint32_t
+ *
+ *******************************************************************************/
+static uint32_t E_EEPROM_XMC1_lCacheEmptyBlkEval(E_EEPROM_XMC1_DATA_t *const data_ptr, uint32_t end_addr)
+{
+    uint32_t status;
+    uint32_t *read_word_ptr;
+
+    XMC_FLASH_ClearStatus();
+
+    /* Read the complete block */
+    E_EEPROM_XMC1_lReadSingleBlock(data_ptr->curr_bank_src_addr, (uint32_t*)(void*)data_ptr->read_write_buffer);
+
+    status = E_EEPROM_XMC1_lGetFlashStatus();
+
+    /* If ECC error exists because of any previous interruptions or power failures during Flash operation in progress*/
+    if (status & (uint32_t)XMC_FLASH_STATUS_ECC2_READ_ERROR)
+    {
+        /* Update the free block location of the valid bank once and for ever until new write happens*/
+        if (data_ptr->next_free_block_addr == 0U)
+        {
+            data_ptr->next_free_block_addr = (data_ptr->curr_bank_src_addr + E_EEPROM_XMC1_FLASH_BLOCK_SIZE );
+        }
+
+        /* Check if all blocks have been read? If yes go to cache update complete state else move to the next block */
+        if ( data_ptr->curr_bank_src_addr == end_addr )
+        {
+            data_ptr->cache_state = E_EEPROM_XMC1_CACHE_UPDATE_DONE;
+        }
+        else
+        {
+            data_ptr->curr_bank_src_addr -= E_EEPROM_XMC1_FLASH_BLOCK_SIZE;
+        }
+    }
+    /* No ECC Error */
+    else
+    {
+        read_word_ptr = ((uint32_t*)(void*)data_ptr->read_write_buffer);
+        /* Check if the first word of the block is having some data written on it */
+        if (*read_word_ptr != E_EEPROM_XMC1_ALL_ONES)
+        {
+            /* Increment the data block count and go to the next block read state */
+            data_ptr->written_block_counter = data_ptr->written_block_counter + 1U;
+            data_ptr->cache_state = E_EEPROM_XMC1_CACHE_NEXT_BLK;
+        }
+        else
+        {
+            /* Check if all blocks have been read? If yes go to cache update complete state else move to next block */
+            if ( data_ptr->curr_bank_src_addr == end_addr )
+            {
+                data_ptr->cache_state = E_EEPROM_XMC1_CACHE_UPDATE_DONE;
+            }
+            data_ptr->curr_bank_src_addr -= E_EEPROM_XMC1_FLASH_BLOCK_SIZE;
+        }
+    }
+    return (status);
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lEvalBlockStatus
+ ********************************************************************************
+ * Summary:
+ * This function evaluates the block status and updates the cache (if required).
+ *                    Entry Criteria:
+ *                    1) No ECC error
+ *                    2) Block number is non zero
+ *                    Possible results:
+ *                    1) cache updated: consistent
+ *                    2) cache updated: inconsistent
+ *                    3) cache already updated (no actions done)
+ *                    4) cannot evaluate - requires more blocks to be read
+ *
+ * Parameters:
+ * handle_ptr - Pointer to the handle of the instance
+ * data_ptr - State of the region the request operates on
+ *
+ * Return:
+ * void
+ *
+ *******************************************************************************/
+static void E_EEPROM_XMC1_lEvalBlockStatus(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr)
+{
+    uint32_t size;
+    uint32_t indx;
+    uint32_t status_byte;
+    uint8_t  block_number;
+    uint32_t physical_blocks;
+    E_EEPROM_XMC1_CACHE_t *cache_ptr;
+    E_EEPROM_XMC1_BLOCK_HEADER_t *Ptr;
+
+    Ptr = (E_EEPROM_XMC1_BLOCK_HEADER_t *)(void *)data_ptr->read_write_buffer;
+    block_number = Ptr->block_number;
+    status_byte = Ptr->status;
+
+    cache_ptr = data_ptr->block_info;
+
+    /* Get the Index of the read block from the user configuration */
+    indx = E_EEPROM_XMC1_lGetUsrBlockIndex(handle_ptr, block_number);
+
+    /* If the block is found */
+    if ( (indx != E_EEPROM_XMC1_LOG_BLOCK_NOT_FOUND) )
+    {
+        /* Point to the cache table entry for the block to be evaluated */
+        cache_ptr = cache_ptr + indx;
+
+        /* Store Index of current block */
+        data_ptr->updated_cache_index = indx;
+
+        /* Check if cache table is updated for the given block : address = 0U => cache table not yet updated */
+        if (cache_ptr->address == 0U)
+        {
+            /* If the starting block of the block found */
+            if ((status_byte & E_EEPROM_XMC1_START_BIT ) != 0U)
+            {
+                /* Update the cache with block address */
+                cache_ptr->address = data_ptr->curr_bank_src_addr;
+
+                /* if the Valid bit for the logical block is set */
+                if ((status_byte & (E_EEPROM_XMC1_VALID_BIT) ) != 0U)
+                {
+                    cache_ptr->status.valid = 1U;
+
+                    /* if the CRC bit for the logical block is set */
+                    if ((status_byte & (E_EEPROM_XMC1_CRC_BIT) ) != 0U)
+                    {
+                        cache_ptr->status.crc = 1U;
+                    }
+                    else
+                    {
+                        cache_ptr->status.crc = 0U;
+                    }
+                }
+                else
+                {
+                    cache_ptr->status.valid = 0U;
+                }
+
+                /* Check If number of Flash blocks used for this data block is same in size */
+                size = (uint32_t)(handle_ptr->block_config_ptr[indx].size);
+                physical_blocks = E_EEPROM_XMC1_lGetDFLASHPhysicalBlocks(size);
+
+                if ( data_ptr->written_block_counter == physical_blocks)
+                {
+                    cache_ptr->status.consistent = 1U;  /* EVALUATION RESULT : BLOCK CONSISTENT*/
+                }
+                else
+                {
+                    if (cache_ptr->status.valid == 1U)
+                    {
+                        cache_ptr->status.consistent = 0U;  /* EVALUATION RESULT : BLOCK INCONSISTENT */
+                    }
+                    else
+                    {
+                        cache_ptr->status.consistent = 1U; /* If the block is invalid, then mark : BLOCK INCONSISTENT */
+                    }
+                }
+                /* Initialize the Index, block block count for the next read */
+                data_ptr->updated_cache_index = E_EEPROM_XMC1_LOG_BLOCK_NOT_FOUND;
+                data_ptr->written_block_counter = 0U;
+            }
+
+        }
+        else
+        {
+            /*
+             * EVALUATION RESULT : CACHE ALREADY UPDATED
+             * If cache table is already updated for the block, no need to evaluate the block
+             */
+            data_ptr->updated_cache_index = E_EEPROM_XMC1_LOG_BLOCK_NOT_FOUND;
+            data_ptr->written_block_counter = 0U;
+        }
+    }
+    else
+    {
+        data_ptr->updated_cache_index = E_EEPROM_XMC1_LOG_BLOCK_NOT_FOUND;
+        data_ptr->written_block_counter = 0U;
+    }
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lUpdateCacheBlockRead
+ ********************************************************************************
+ * Summary:
+ * Utility function to read data block from flash for cache update function.
+ *
+ * Parameters:
+ * data_ptr - State of the region the request operates on
+ *
+ * Return:
+ * uint32_t
+ *
+ *******************************************************************************/
+static uint32_t E_EEPROM_XMC1_lUpdateCacheBlockRead(E_EEPROM_XMC1_DATA_t *const data_ptr)
+{
+    /* Set the Write Source pointer to the next block */
+    data_ptr->curr_bank_src_addr = data_ptr->curr_bank_src_addr -  E_EEPROM_XMC1_FLASH_BLOCK_SIZE;
+
+    /* Clear all error status flags before flash operation*/
+    XMC_FLASH_ClearStatus();
+
+    E_EEPROM_XMC1_lReadSingleBlock(data_ptr->curr_bank_src_addr,  (uint32_t*)(void*)data_ptr->read_write_buffer);
+
+    /* Increment number of read block counter  */
+    data_ptr->written_block_counter = data_ptr->written_block_counter + 1U;
+
+    return (E_EEPROM_XMC1_lGetFlashStatus());
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lGetUsrBlockIndex
+ ********************************************************************************
+ * Summary:
+ * This utility function will return the Index (location) of the block in the
+ * user configuration.
+ *
+ * Parameters:
+ * handle_ptr - Pointer to the handle of the instance
+ * block_number  - User data block number / ID
+ *
+ * Return:
+ * uint32_t : returns array index pointer of block configuration
+ *
+ *******************************************************************************/
+static uint32_t E_EEPROM_XMC1_lGetUsrBlockIndex(E_EEPROM_XMC1_t *const handle_ptr, uint8_t block_number)
+{
+    uint32_t indx;
+    E_EEPROM_XMC1_BLOCK_t  *block_ptr;
+
+    indx = 0U;
+    block_ptr = &(handle_ptr->block_config_ptr[indx]);
+
+    /* Check for max configured block count reached and block number is matched against the configured block numbers */
+    while ( (indx < handle_ptr->block_count) && (block_ptr->block_number != block_number) )
     {
-        /* Change the current Bank to Bank0 */
-        data_ptr->current_bank = 0U;
-        E_EEPROM_XMC1_lInitGcNormalStates( E_EEPROM_XMC1_PREPFLASH_FF, 1U);
+        indx++;
+        block_ptr++;
     }
-    else
+
+    if ( indx == handle_ptr->block_count )
     {
-        data_ptr->gc_state = E_EEPROM_XMC1_GC_FAIL;
+        indx = E_EEPROM_XMC1_LOG_BLOCK_NOT_FOUND;
     }
+    return (indx);
 }
 
 /*******************************************************************************
- * Function Name: E_EEPROM_XMC1_lInitDirtyStateMachine
+ * Function Name: E_EEPROM_XMC1_lGetDFLASHPhysicalBlocks
  ********************************************************************************
  * Summary:
- * This function shall address the dirty state recovery mechanism by erasing and
- * rewriting states
+ * Calculates and return the number of FLASH blocks required for a user data
+ * block size.
  *
  * Parameters:
- * void
+ * size - size of user data block
  *
  * Return:
- * void
+ * uint32_t - returns maximum physical flash blocks required to store the data.
  *
  *******************************************************************************/
-static void E_EEPROM_XMC1_lInitDirtyStateMachine(void)
+static uint32_t E_EEPROM_XMC1_lGetDFLASHPhysicalBlocks(uint32_t size)
 {
-    E_EEPROM_XMC1_DATA_t *data_ptr;
-    data_ptr = (E_EEPROM_XMC1_DATA_t*)(void*)(e_eeprom_xmc1_handle->data_ptr);
-    switch (data_ptr->init_gc_state)
+    uint32_t physical_blocks;
+
+    physical_blocks = 1U;
+    /* If size is greater than the  */
+    if ( size > E_EEPROM_XMC1_BLOCK1_DATA_SIZE )
     {
-    case E_EEPROM_XMC1_INIT_STATE_2D:
-        /* Change the current Bank to Bank0 and recover from the dirty state to 2E  */
-        data_ptr->current_bank = 0U;
-        /* Transition states : 2D -> 2F -> 2E */
-        E_EEPROM_XMC1_lErasedDirtyStateRecovery( E_EEPROM_XMC1_END_ERASE_OFFSET );
-        break;
-    case E_EEPROM_XMC1_INIT_STATE_D2:
-        /* Change the current Bank to Bank1 and recover from the dirty state to E2 */
-        data_ptr->current_bank = 1U;
-        /* Transition states : D2 -> F2 -> E2 */
-        E_EEPROM_XMC1_lErasedDirtyStateRecovery( E_EEPROM_XMC1_END_ERASE_OFFSET );
-        break;
-    case E_EEPROM_XMC1_INIT_STATE_AD:
-        /* Change the current Bank to Bank0 and recover from the dirty state to 2E */
-        data_ptr->current_bank = 0U;
-        /* Transition states : AD -> A0 -> GC PROCESS -> 2E */
-        E_EEPROM_XMC1_lCopyProcessDirtyStateRecovery( E_EEPROM_XMC1_COPY_COMPLETED ,
-                E_EEPROM_XMC1_GC_NEXT_BANK_VALID , 1U);
-        break;
-    case E_EEPROM_XMC1_INIT_STATE_DA:
-        /* Change the current Bank to Bank1  and recover from the dirty state to E2*/
-        data_ptr->current_bank = 1U;
-        /* Transition states : DA -> 0A -> GC PROCESS -> E2 */
-        E_EEPROM_XMC1_lCopyProcessDirtyStateRecovery( E_EEPROM_XMC1_COPY_COMPLETED ,
-                E_EEPROM_XMC1_GC_NEXT_BANK_VALID , 1U);
-        break;
-    case E_EEPROM_XMC1_INIT_STATE_0D:
-        /* Change the current Bank to Bank1 and recover from the dirty state to E2 */
-        data_ptr->current_bank = 1U;
-        /* Transition states : 0D -> 02 -> GC PROCESS -> E2 */
-        E_EEPROM_XMC1_lCopyProcessDirtyStateRecovery( E_EEPROM_XMC1_VALID_STATE ,
-                E_EEPROM_XMC1_GC_ERASE_PREV_BANK , 0U);
-        break;
-    case E_EEPROM_XMC1_INIT_STATE_D0:
-        /* Change the current Bank to Bank0 and recover from the dirty state to 2E */
-        data_ptr->current_bank = 0U;
-        /* Transition states : D0 -> 20 -> GC PROCESS -> 2E */
-        E_EEPROM_XMC1_lCopyProcessDirtyStateRecovery( E_EEPROM_XMC1_VALID_STATE ,
-                E_EEPROM_XMC1_GC_ERASE_PREV_BANK , 0U);
-        break;
-    default:
-        /* Any state apart from the normal states is considered as Illegal state */
-        /* Transition states : Illegal -> PREPARE DFLASH -> 2E */
-        E_EEPROM_XMC1_lInitllegalStateMachine();
-        break;
+        size = size - E_EEPROM_XMC1_BLOCK1_DATA_SIZE;
+        physical_blocks++;
+
+        while (size > E_EEPROM_XMC1_BLOCK2_DATA_SIZE)
+        {
+            physical_blocks++;
+            size = size - E_EEPROM_XMC1_BLOCK2_DATA_SIZE;
+        }
     }
+    return(physical_blocks);
 }
 
 /*******************************************************************************
- * Function Name: E_EEPROM_XMC1_lInitNormalStateMachine
+ * Function Name: E_EEPROM_XMC1_lGetFreeDFLASHBlocks
  ********************************************************************************
  * Summary:
- * Check which normal bank state machine process has executed.
+ * This routine will calculate the number of empty DFLASH blocks remaining in the bank.
  *
  * Parameters:
- * void
+ * data_ptr - State of the region the request operates on
  *
  * Return:
- * void
+ * uint32_t : Number of physical blocks left in the bank for writing data.
  *
  *******************************************************************************/
-static void E_EEPROM_XMC1_lInitNormalStateMachine(void)
+static uint32_t E_EEPROM_XMC1_lGetFreeDFLASHBlocks(E_EEPROM_XMC1_DATA_t *const data_ptr)
 {
-    /* Check if the state matches with any of the normal marker states with active bank as bank-0*/
-    if (E_EEPROM_XMC1_lInitBank0NormalStateMachine() == 0U)
+    uint32_t base_addr;
+    uint32_t free_blocks;
+
+    base_addr = E_EEPROM_XMC1_BANK_BASE(data_ptr->current_bank);
+    free_blocks = (uint32_t)( ( (base_addr + E_EEPROM_XMC1_BANK_SIZE) - (data_ptr->next_free_block_addr)  )
+            /  E_EEPROM_XMC1_FLASH_BLOCK_SIZE );
+    return (free_blocks);
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lSetBankGeometry
+ ********************************************************************************
+ * Summary:
+ * Resolves the bank geometry of the instance from the bank0_base, bank_size and
+ * bank_count configuration. A size of 0 selects E_EEPROM_XMC1_FLASH_BANK_SIZE, a
+ * count of 0 selects two banks, a base of 0 places all banks at the end of
+ * flash. All banks must be page aligned and inside the flash.
+ *
+ * Parameters:
+ * handle_ptr - Pointer to the handle of the instance
+ * data_ptr - State of the region the request operates on
+ *
+ * Return:
+ * uint32_t - 1 if the geometry is valid, else 0
+ *
+ *******************************************************************************/
+static uint32_t E_EEPROM_XMC1_lSetBankGeometry(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr)
+{
+    uint32_t valid;
+    uint32_t bank_size;
+    uint32_t bank_count;
+    uint32_t bank0_base;
+    uint32_t flash_end;
+
+    flash_end = (uint32_t)E_EEPROM_XMC1_FLASH_BANK1_END + 1U;
+
+    bank_size = handle_ptr->bank_size;
+    if (bank_size == 0U)
     {
-        /* Check if the state matches with any of the normal marker states with active bank as bank-1*/
-        if (E_EEPROM_XMC1_lInitBank1NormalStateMachine() == 0U)
+        bank_size = (uint32_t)E_EEPROM_XMC1_FLASH_BANK_SIZE;
+    }
+
+    bank_count = (uint32_t)handle_ptr->bank_count;
+    if (bank_count == 0U)
+    {
+        bank_count = 2U;
+    }
+
+    valid = 0U;
+    if (((bank_size % E_EEPROM_XMC1_FLASH_PAGE_SIZE) == 0U) &&
+            (bank_size >= (E_EEPROM_XMC1_FLASH_PAGE_SIZE * 2U)) && (bank_size <= E_EEPROM_XMC1_MAX_BANK_SIZE) &&
+            (bank_count >= 2U) && (bank_count <= E_EEPROM_XMC1_MAX_BANK_COUNT) &&
+            ((bank_size * bank_count) <= (flash_end - (uint32_t)XMC_FLASH_BASE)))
+    {
+        bank0_base = handle_ptr->bank0_base;
+        if (bank0_base == 0U)
         {
-            /* Check if the state matches with any other intermediate states from where a recover is possible  */
-            if (E_EEPROM_XMC1_lInitOtherNormalStateMachine() == 0U)
+            bank0_base = flash_end - (bank_size * bank_count);
+        }
+
+        if (((bank0_base % E_EEPROM_XMC1_FLASH_PAGE_SIZE) == 0U) && (bank0_base >= (uint32_t)XMC_FLASH_BASE) &&
+                (bank0_base <= (flash_end - (bank_size * bank_count))))
+        {
+            data_ptr->bank0_base = bank0_base;
+            data_ptr->bank_size = bank_size;
+            data_ptr->bank_count = bank_count;
+            valid = 1U;
+        }
+    }
+    return (valid);
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lSetColdBankGeometry
+ ********************************************************************************
+ * Summary:
+ * Resolves the bank geometry of the region of the cold blocks: two banks of
+ * cold_bank_size bytes placed directly below the banks of the hot region. A
+ * size of 0 selects the bank size of the hot region. The geometry of the hot
+ * region must be resolved before.
+ *
+ * Parameters:
+ * handle_ptr - Pointer to the handle of the instance
+ * data_ptr - State of the region the request operates on
+ *
+ * Return:
+ * uint32_t - 1 if the geometry is valid, else 0
+ *
+ *******************************************************************************/
+static uint32_t E_EEPROM_XMC1_lSetColdBankGeometry(E_EEPROM_XMC1_t *const handle_ptr,
+        E_EEPROM_XMC1_DATA_t *const data_ptr)
+{
+    uint32_t valid;
+    uint32_t bank_size;
+    uint32_t hot_bank0_base;
+
+    hot_bank0_base = handle_ptr->data_ptr->bank0_base;
+
+    bank_size = handle_ptr->cold_bank_size;
+    if (bank_size == 0U)
+    {
+        bank_size = handle_ptr->data_ptr->bank_size;
+    }
+
+    valid = 0U;
+    if (((bank_size % E_EEPROM_XMC1_FLASH_PAGE_SIZE) == 0U) &&
+            (bank_size >= (E_EEPROM_XMC1_FLASH_PAGE_SIZE * 2U)) && (bank_size <= E_EEPROM_XMC1_MAX_BANK_SIZE) &&
+            ((hot_bank0_base - (uint32_t)XMC_FLASH_BASE) >= (bank_size * 2U)))
+    {
+        data_ptr->bank0_base = hot_bank0_base - (bank_size * 2U);
+        data_ptr->bank_size = bank_size;
+        data_ptr->bank_count = 2U;
+        valid = 1U;
+    }
+    return (valid);
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lIsRegionCapacityValid
+ ********************************************************************************
+ * Summary:
+ * Checks that each block of the selected region fits into one bank (segment)
+ * together with the emergency reserve. A block that does not fit could never
+ * be written, each request would execute garbage collections in vain.
+ * The latest copies of all blocks of the region, one further copy of the
+ * largest block and the emergency reserve must also fit into the banks
+ * (segments) not kept free for the garbage collection, else a garbage
+ * collection cannot make room for a write.
+ *
+ * Parameters:
+ * handle_ptr - Pointer to the handle of the instance
+ * data_ptr - State of the region the request operates on
+ *
+ * Return:
+ * uint32_t - 1 if the capacity is valid, else 0
+ *
+ *******************************************************************************/
+static uint32_t E_EEPROM_XMC1_lIsRegionCapacityValid(E_EEPROM_XMC1_t *const handle_ptr,
+        E_EEPROM_XMC1_DATA_t *const data_ptr)
+{
+    uint32_t indx;
+    uint32_t valid;
+    uint32_t flash_blocks;
+    uint32_t live_blocks;
+    uint32_t largest_blocks;
+
+    valid = 1U;
+    live_blocks = 0U;
+    largest_blocks = 0U;
+    for (indx = 0U; indx < handle_ptr->block_count; indx++)
+    {
+        if (E_EEPROM_XMC1_lGetBlockRegion(handle_ptr, indx) == data_ptr)
+        {
+            flash_blocks = E_EEPROM_XMC1_lGetDFLASHPhysicalBlocks(handle_ptr->block_config_ptr[indx].size);
+            live_blocks += flash_blocks;
+            if (flash_blocks > largest_blocks)
             {
-                /* If no matches found then go to illegal state and try to recover by erasing complete DFLASH */
-                E_EEPROM_XMC1_lInitllegalStateMachine();
+                largest_blocks = flash_blocks;
+            }
+            if ((flash_blocks + E_EEPROM_XMC1_lGetEmergencyReserveBlocks(handle_ptr)) > E_EEPROM_XMC1_BANK_DATA_BLOCKS)
+            {
+                valid = 0U;
             }
         }
     }
+
+    flash_blocks = live_blocks + largest_blocks + E_EEPROM_XMC1_lGetEmergencyReserveBlocks(handle_ptr);
+    if (flash_blocks > ((E_EEPROM_XMC1_BANK_COUNT - 1U) * E_EEPROM_XMC1_BANK_DATA_BLOCKS))
+    {
+        valid = 0U;
+    }
+    return (valid);
 }
 
 /*******************************************************************************
- * Function Name: E_EEPROM_XMC1_lInitBank0NormalStateMachine
+ * Function Name: E_EEPROM_XMC1_lInitRegion
  ********************************************************************************
  * Summary:
- * Execute bank 0 state machine process and return the found states.
+ * Initializes the cache table and the run time state of the selected region
+ * and evaluates its banks in flash. The region is ready for requests if the
+ * garbage collection state is IDLE afterwards.
  *
  * Parameters:
- * void
+ * handle_ptr - Pointer to the handle of the instance
+ * data_ptr - State of the region the request operates on
  *
  * Return:
- * uint32_t : ( 1= state_found / 0 = State not found )
+ * void
  *
  *******************************************************************************/
-static uint32_t E_EEPROM_XMC1_lInitBank0NormalStateMachine(void)
+static void E_EEPROM_XMC1_lInitRegion(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr)
 {
-    uint32_t state_found;
-    E_EEPROM_XMC1_DATA_t *data_ptr;
-    data_ptr = (E_EEPROM_XMC1_DATA_t*)(void*)(e_eeprom_xmc1_handle->data_ptr);
+    uint32_t indx;
+    uint32_t marker_state;
+    E_EEPROM_XMC1_CACHE_t *block_ptr;
 
-    state_found = 1U;
+    /* Initialize the cache variables for the User defined Block configuration list */
+    indx = 0U;
+    do
+    {
+        block_ptr = &(data_ptr->block_info[indx]);
+
+        block_ptr->address = 0U;
+        block_ptr->status.consistent = 0U;
+        block_ptr->status.valid = 1U;
+        block_ptr->status.copied = 0U;
+        block_ptr->status.crc = 0U;
+        block_ptr->status.resolved = 0U;
+        indx++;
+    } while (indx < handle_ptr->block_count);
+
+    /********* Initialize all global variables *****************/
+    data_ptr->updated_cache_index = 0U;
+    data_ptr->cache_state = E_EEPROM_XMC1_CACHE_IDLE;
+    data_ptr->gc_state = E_EEPROM_XMC1_GC_UNINT;
+    data_ptr->init_gc_state = 0U;
+    data_ptr->gc_log_block_count = 0U;
+    data_ptr->crc_buffer = 0U;
+
+    data_ptr->written_block_counter = (uint32_t)0;
+    data_ptr->curr_bank_src_addr = 0U;
+    data_ptr->gc_src_addr = 0U;
+    data_ptr->gc_dest_addr = 0U;
+    data_ptr->next_free_block_addr = 0U;
+    data_ptr->gc_block_counter = (uint32_t)0;
+    data_ptr->pending_erase_pages = 0U;
+    data_ptr->checkpoint_addr = 0U;
+    data_ptr->elided_write_count = 0U;
+    data_ptr->elided_flash_blocks = 0U;
+    data_ptr->live_flash_blocks = 0U;
+    data_ptr->idle_gc_active = 0U;
+    data_ptr->user_write_bytes_count = 0U;
 
-    switch (data_ptr->init_gc_state)
+    data_ptr->current_bank = 0U;
+    data_ptr->gc_victim_bank = 0U;
+    for (indx = 0U; indx < E_EEPROM_XMC1_MAX_BANK_COUNT; indx++)
     {
-    /*
-     * Normal Data write in Bank-0 interrupted (2E), Next step = Cache Update and get ready to accept new request
-     * Transition states : Nothing
-     */
-    case E_EEPROM_XMC1_INIT_NORMAL1:
-        data_ptr->current_bank = 0U;
-        E_EEPROM_XMC1_lInitGcNormalStates( E_EEPROM_XMC1_GC_IDLE, E_EEPROM_XMC1_EXECUTE_CACHE_UPDATE);
-        break;
+        data_ptr->bank_seq[indx] = 0U;
+    }
 
-        /*
-         * Data copy from Bank0 to Bank1 interrupted (2A), Next step = Erasing Bank-1 and restart copy from Bank-0
-         * Transition states : (2A) -> ERASE_BANK0 (2F) -> 2E -> GC_PROCESS (2A -> 0A -> 20 -> F2 -> E2)
-         */
-    case E_EEPROM_XMC1_INIT_DATA_COPY1:
-        data_ptr->current_bank = 0U;
-        E_EEPROM_XMC1_lInitGcDataCopyState( E_EEPROM_XMC1_GC_REQUESTED, E_EEPROM_XMC1_END_ERASE_OFFSET);
-        break;
+    if (data_ptr->bank_count > 2U)
+    {
+        /* Rotating log: the segment headers decide the state, no marker state machine */
+        E_EEPROM_XMC1_lInitSegments(handle_ptr, data_ptr);
+    }
+    else
+    {
+        /* Read the marker blocks from flash and decide the MARKER STATES */
+        marker_state = E_EEPROM_XMC1_lReadMarkerBlocks(data_ptr);
 
         /*
-         * Interrupted after copy completion from Bank1 to Bank0 (A0),Next step = Writing Valid state into Bank-0
-         * Transition states : (A0) -> (20) -> GC_PROCESS (2F -> 2E)
+         * Call INIT-GC state machine function to take decision on current MARKER STATE available.
+         * Progress to GC state machine or PrepareDFLASH State machine after completing  the Cache update
          */
-    case E_EEPROM_XMC1_INIT_COPY_DONE1:
-        data_ptr->current_bank = 0U;
-        E_EEPROM_XMC1_lInitGcNormalStates( E_EEPROM_XMC1_GC_NEXT_BANK_VALID, E_EEPROM_XMC1_EXECUTE_GC_STATE);
-        break;
+        E_EEPROM_XMC1_lInitGc(handle_ptr, data_ptr, marker_state);
+    }
 
-        /*
-         * Interrupted after writing valid state to Bank0 (20), Next step = Erase of old redundant Bank-1 (2F)
-         * Transition states : (20) -> (2F) -> GC_PROCESS (2E)
-         */
-    case E_EEPROM_XMC1_INIT_NEXT_VALID1:
-        data_ptr->current_bank = 0U;
-        E_EEPROM_XMC1_lInitGcNormalStates( E_EEPROM_XMC1_GC_ERASE_PREV_BANK, E_EEPROM_XMC1_EXECUTE_GC_STATE);
-        break;
+    /* The cache is built from flash, the running count of the live blocks starts from it */
+    data_ptr->live_flash_blocks = E_EEPROM_XMC1_lCountLiveFlashBlocks(handle_ptr, data_ptr);
 
-        /*
-         * Interrupted after erase of old bank completed(2F), Next step = Mark erased Bank-1 with Formatted state(2E)
-         * Transition states : (2F) -> GC_PROCESS (2E)
-         */
-    case E_EEPROM_XMC1_INIT_END_ERASE1:
-        data_ptr->current_bank = 0U;
-        E_EEPROM_XMC1_lInitGcNormalStates( E_EEPROM_XMC1_GC_MARK_END_ERASE1, E_EEPROM_XMC1_EXECUTE_GC_STATE);
-        break;
+    if (data_ptr->gc_state == E_EEPROM_XMC1_GC_IDLE)
+    {
+        E_EEPROM_XMC1_lSealWarmState(handle_ptr, data_ptr);
+    }
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lGetBlockRegion
+ ********************************************************************************
+ * Summary:
+ * Returns the state of the region a block is stored in: the region of the cold
+ * blocks for a block of temperature E_EEPROM_XMC1_BLOCK_COLD if cold_data_ptr is
+ * configured, else the region of the hot blocks.
+ *
+ * Parameters:
+ * handle_ptr - Pointer to the handle of the instance
+ * block_index - Index of the block in the user configuration
+ *
+ * Return:
+ * E_EEPROM_XMC1_DATA_t* - State of the region of the block
+ *
+ *******************************************************************************/
+static E_EEPROM_XMC1_DATA_t *E_EEPROM_XMC1_lGetBlockRegion(E_EEPROM_XMC1_t *const handle_ptr, uint32_t block_index)
+{
+    E_EEPROM_XMC1_DATA_t *region_ptr;
+
+    region_ptr = handle_ptr->data_ptr;
+
+    if ((handle_ptr->cold_data_ptr != NULL) && (block_index < handle_ptr->block_count) &&
+            (handle_ptr->block_config_ptr[block_index].temperature == E_EEPROM_XMC1_BLOCK_COLD))
+    {
+        region_ptr = handle_ptr->cold_data_ptr;
+    }
+    return (region_ptr);
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lSelectRegion
+ ********************************************************************************
+ * Summary:
+ * Selects the region of a block for a request.
+ *
+ * Parameters:
+ * handle_ptr - Pointer to the handle of the instance
+ * block_number - User data block number / ID
+ *
+ * Return:
+ * E_EEPROM_XMC1_DATA_t* - State of the selected region
+ *
+ *******************************************************************************/
+static E_EEPROM_XMC1_DATA_t *E_EEPROM_XMC1_lSelectRegion(E_EEPROM_XMC1_t *const handle_ptr, uint8_t block_number)
+{
+    return (E_EEPROM_XMC1_lGetBlockRegion(handle_ptr, E_EEPROM_XMC1_lGetUsrBlockIndex(handle_ptr, block_number)));
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lSelectGcRegion
+ ********************************************************************************
+ * Summary:
+ * Selects the region for a garbage collection request. This is the region of
+ * the hot blocks, unless the region of the cold blocks has a pending deferred
+ * erase or a garbage collection not in IDLE state.
+ *
+ * Parameters:
+ * handle_ptr - Pointer to the handle of the instance
+ *
+ * Return:
+ * E_EEPROM_XMC1_DATA_t* - State of the selected region
+ *
+ *******************************************************************************/
+static E_EEPROM_XMC1_DATA_t *E_EEPROM_XMC1_lSelectGcRegion(E_EEPROM_XMC1_t *const handle_ptr)
+{
+    E_EEPROM_XMC1_DATA_t *cold_ptr;
+    E_EEPROM_XMC1_DATA_t *region_ptr;
 
-    default:
-        state_found = 0U;
-        break;
+    region_ptr = handle_ptr->data_ptr;
+
+    cold_ptr = handle_ptr->cold_data_ptr;
+    if ((cold_ptr != NULL) &&
+            ((cold_ptr->pending_erase_pages != 0U) || (cold_ptr->gc_state != E_EEPROM_XMC1_GC_IDLE)))
+    {
+        region_ptr = cold_ptr;
     }
-    return (state_found);
+    return (region_ptr);
 }
 
 /*******************************************************************************
- * Function Name: E_EEPROM_XMC1_lInitBank1NormalStateMachine
+ * Function Name: E_EEPROM_XMC1_lUpdateCurrBankInfo
  ********************************************************************************
  * Summary:
- * Execute bank 1 state machine process and return the found states.
+ * Updates global addresses to keep track of writing and reading operations
+ * respectively.
  *
  * Parameters:
- * uint32_t : ( 1= state_found / 0 = State not found )
+ * data_ptr - State of the region the request operates on
  *
  * Return:
- * E_EEPROM_XMC1_STATUS_t
+ * void
  *
  *******************************************************************************/
-static uint32_t E_EEPROM_XMC1_lInitBank1NormalStateMachine(void)
+static void E_EEPROM_XMC1_lUpdateCurrBankInfo(E_EEPROM_XMC1_DATA_t *const data_ptr)
 {
-    uint32_t state_found;
-    E_EEPROM_XMC1_DATA_t *data_ptr;
-    data_ptr = (E_EEPROM_XMC1_DATA_t*)(void*)(e_eeprom_xmc1_handle->data_ptr);
+    uint32_t next_bank;
 
-    state_found = 1U;
+    /* The other bank of two banks, the following segment of a rotating log */
+    next_bank = (data_ptr->current_bank + 1U) % E_EEPROM_XMC1_BANK_COUNT;
 
-    switch (data_ptr->init_gc_state)
+    data_ptr->curr_bank_src_addr = E_EEPROM_XMC1_BANK_BASE(data_ptr->current_bank);
+    data_ptr->gc_src_addr = E_EEPROM_XMC1_BANK_BASE(data_ptr->current_bank);
+    data_ptr->gc_dest_addr = E_EEPROM_XMC1_BANK_BASE(next_bank);
+    data_ptr->curr_bank_end_addr = (E_EEPROM_XMC1_BANK_BASE(data_ptr->current_bank) + E_EEPROM_XMC1_BANK_SIZE) - 1U;
+    data_ptr->prev_bank_end_addr = (E_EEPROM_XMC1_BANK_BASE(next_bank) + E_EEPROM_XMC1_BANK_SIZE) - 1U;
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lInitSegments
+ ********************************************************************************
+ * Summary:
+ * Initialization of a rotating log. The state of each segment is read from its
+ * header. A segment with an interrupted header write or erase, or a reclaimed
+ * segment, is erased. If all segments are part of the log, the garbage
+ * collection was interrupted while copying into the newest segment, the copies
+ * are dropped by erasing it. Without any segment in the log the emulation is
+ * formatted. More than one segment to be recovered is an illegal state, all
+ * segments are erased if erase_all_auto_recovery is set. The cache is updated
+ * from the newest to the oldest segment.
+ *
+ * Parameters:
+ * handle_ptr - Pointer to the handle of the instance
+ * data_ptr - State of the region the request operates on
+ *
+ * Return:
+ * void
+ *
+ *******************************************************************************/
+static void E_EEPROM_XMC1_lInitSegments(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr)
+{
+    uint32_t bank;
+    uint32_t status;
+    uint32_t head_bank;
+    uint32_t live_banks;
+    uint32_t dirty_bank;
+    uint32_t dirty_banks;
+    uint32_t segment_state;
+
+    status = 0U;
+    live_banks = 0U;
+    dirty_banks = 0U;
+    dirty_bank = 0U;
+    head_bank = E_EEPROM_XMC1_BANK_COUNT;
+
+    for (bank = 0U; bank < E_EEPROM_XMC1_BANK_COUNT; bank++)
     {
-    /*
-     * Normal Data write in Bank-1 interrupted (E2), Next step = Cache Update and get ready to accept new request
-     * Transition states : Nothing
-     */
-    case E_EEPROM_XMC1_INIT_NORMAL2:
-        data_ptr->current_bank = 1U;
-        E_EEPROM_XMC1_lInitGcNormalStates( E_EEPROM_XMC1_GC_IDLE, E_EEPROM_XMC1_EXECUTE_CACHE_UPDATE);
-        break;
+        segment_state = E_EEPROM_XMC1_lReadSegmentState(data_ptr, bank);
+        if (segment_state == E_EEPROM_XMC1_SEGMENT_LIVE)
+        {
+            live_banks++;
+            if ((head_bank == E_EEPROM_XMC1_BANK_COUNT) || (data_ptr->bank_seq[bank] > data_ptr->bank_seq[head_bank]))
+            {
+                head_bank = bank;
+            }
+        }
+        else if (segment_state != E_EEPROM_XMC1_SEGMENT_ERASED)
+        {
+            dirty_banks++;
+            dirty_bank = bank;
+        }
+        else
+        {
+            /* Erased segment, nothing to do */
+        }
+    }
 
-        /*
-         * Data copy from Bank1 to Bank0 interrupted (A2), Next step = Erasing Bank-0 and restart copy from Bank-1
-         * Transition states : (A2) -> ERASE_BANK0 (F2) -> E2 -> GC_PROCESS (A2 -> A0 -> 20 -> 2F -> 2E)
-         */
-    case E_EEPROM_XMC1_INIT_DATA_COPY2:
-        data_ptr->current_bank = 1U;
-        E_EEPROM_XMC1_lInitGcDataCopyState( E_EEPROM_XMC1_GC_REQUESTED, E_EEPROM_XMC1_END_ERASE_OFFSET);
-        break;
+    if (dirty_banks > 1U)
+    {
+        /* Illegal state, all segments are erased only if the configuration option Erase all is 1U */
+        if (handle_ptr->erase_all_auto_recovery == 1U)
+        {
+            for (bank = 0U; (bank < E_EEPROM_XMC1_BANK_COUNT) && (status == 0U); bank++)
+            {
+                status = E_EEPROM_XMC1_lEraseBank(data_ptr,
+                        (E_EEPROM_XMC1_BANK_BASE(bank) + E_EEPROM_XMC1_BANK_SIZE) - 1U);
+                data_ptr->bank_seq[bank] = 0U;
+            }
+            live_banks = 0U;
+        }
+        else
+        {
+            status = 1U;
+        }
+    }
+    else if (dirty_banks == 1U)
+    {
+        status = E_EEPROM_XMC1_lEraseBank(data_ptr,
+                (E_EEPROM_XMC1_BANK_BASE(dirty_bank) + E_EEPROM_XMC1_BANK_SIZE) - 1U);
+    }
+    else
+    {
+        /* No segment to be recovered */
+    }
 
-        /*
-         * Interrupted after copy completion from Bank0 to Bank1 (0A),Next step = Writing Valid state into Bank-1
-         * Transition states : (0A) -> (02) -> GC_PROCESS (F2 -> E2)
-         */
-    case E_EEPROM_XMC1_INIT_COPY_DONE2:
-        data_ptr->current_bank = 1U;
-        E_EEPROM_XMC1_lInitGcNormalStates( E_EEPROM_XMC1_GC_NEXT_BANK_VALID, E_EEPROM_XMC1_EXECUTE_GC_STATE);
-        break;
+    if ((status == 0U) && (live_banks == E_EEPROM_XMC1_BANK_COUNT))
+    {
+        /* Drop the copies of the interrupted garbage collection, the previous segment becomes the newest again */
+        bank = head_bank;
+        head_bank = E_EEPROM_XMC1_lGetOlderSegment(data_ptr, bank);
+        status = E_EEPROM_XMC1_lEraseBank(data_ptr, (E_EEPROM_XMC1_BANK_BASE(bank) + E_EEPROM_XMC1_BANK_SIZE) - 1U);
+        data_ptr->bank_seq[bank] = 0U;
+    }
 
-        /*
-         * Interrupted after writing valid state to Bank1 (02), Next step = Erase of old redundant Bank-0 (F2)
-         * Transition states : (02) -> (F2) -> GC_PROCESS (E2)
-         */
-    case E_EEPROM_XMC1_INIT_NEXT_VALID2:
-        data_ptr->current_bank = 1U;
-        E_EEPROM_XMC1_lInitGcNormalStates( E_EEPROM_XMC1_GC_ERASE_PREV_BANK, E_EEPROM_XMC1_EXECUTE_GC_STATE);
-        break;
+    if ((status == 0U) && (live_banks == 0U))
+    {
+        /* Format the emulation, the first segment is opened */
+        head_bank = 0U;
+        status = E_EEPROM_XMC1_lWriteSegmentHeader(data_ptr, head_bank, 1U);
+    }
 
-        /*
-         * Interrupted after erase of old bank completed(F2), Next step = Mark erased Bank-0 with Formatted state(E2)
-         * Transition states : (F2) -> GC_PROCESS (E2)
-         */
-    case E_EEPROM_XMC1_INIT_END_ERASE2:
-        data_ptr->current_bank = 1U;
-        E_EEPROM_XMC1_lInitGcNormalStates( E_EEPROM_XMC1_GC_MARK_END_ERASE1, E_EEPROM_XMC1_EXECUTE_GC_STATE);
-        break;
+    if (status == 0U)
+    {
+        data_ptr->current_bank = head_bank;
+        E_EEPROM_XMC1_lUpdateCurrBankInfo(data_ptr);
+        data_ptr->next_free_block_addr = 0U;
 
-    default:
-        state_found = 0U;
-        break;
+        /* Update the RAM Cache Table */
+        E_EEPROM_XMC1_lUpdateCache(handle_ptr, data_ptr);
+        data_ptr->gc_state = E_EEPROM_XMC1_GC_IDLE;
+    }
+    else
+    {
+        data_ptr->gc_state = E_EEPROM_XMC1_GC_FAIL;
     }
-    return (state_found);
 }
 
 /*******************************************************************************
- * Function Name: E_EEPROM_XMC1_lInitOtherNormalStateMachine
+ * Function Name: E_EEPROM_XMC1_lReadSegmentState
  ********************************************************************************
  * Summary:
- * Execute other state machine process and return the found states.
+ * Reads the header of a segment of a rotating log. The sequence number of a
+ * segment which is part of the log is stored in bank_seq, else 0. A header
+ * with all ones is only accepted as erased if the complete marker page is
+ * erased. A valid header with a written reclaimed marker belongs to a segment
+ * whose live blocks are already copied.
  *
  * Parameters:
- * void
+ * data_ptr - State of the region the request operates on
+ * bank - Segment number
  *
  * Return:
- * uint32_t : ( 1= state_found / 0 = State not found )
+ * uint32_t - E_EEPROM_XMC1_SEGMENT_ERASED, LIVE, RECLAIMED or DIRTY
  *
  *******************************************************************************/
-static uint32_t E_EEPROM_XMC1_lInitOtherNormalStateMachine(void)
+static uint32_t E_EEPROM_XMC1_lReadSegmentState(E_EEPROM_XMC1_DATA_t *const data_ptr, uint32_t bank)
 {
-    uint32_t state_found;
-    E_EEPROM_XMC1_DATA_t *data_ptr;
-    data_ptr = (E_EEPROM_XMC1_DATA_t*)(void*)(e_eeprom_xmc1_handle->data_ptr);
-
-    state_found = 1U;
-
-    switch (data_ptr->init_gc_state)
-    {
-    /* Interrupted after erase of both banks completed (FF), Next step = Start Prepare DFlash  */
-    case E_EEPROM_XMC1_INIT_ALL_ERASED:
-        /* Change the current Bank to Bank0 */
-        data_ptr->current_bank = 0U;
-        /* Transition states : FF ->  PREPARE_DFLASH (2F) -> 2E */
-        E_EEPROM_XMC1_lInitGcNormalStates( E_EEPROM_XMC1_PREPFLASH_FF, E_EEPROM_XMC1_EXECUTE_PREP_FLASH);
-        break;
+    uint32_t sequence;
+    uint32_t segment_state;
+    uint32_t *header_ptr;
 
-        /*
-         * Interrupted after erase of Bank1 during previous recovery(AF), Next step = Bank0 marker Page program (A0)
-         * Transition states : AF -> A0 -> GC PROCESS -> 20 -> 2F -> 2E
-         */
-    case E_EEPROM_XMC1_INIT_STATE_AF:
-        /* Change the current Bank to Bank1 */
-        data_ptr->current_bank = 0U;
+    header_ptr = (uint32_t*)(void*)data_ptr->read_write_buffer;
 
-        E_EEPROM_XMC1_lCopyProcessDirtyStateRecovery( E_EEPROM_XMC1_COPY_COMPLETED ,
-                E_EEPROM_XMC1_GC_NEXT_BANK_VALID , 1U);
-        break;
+    data_ptr->bank_seq[bank] = 0U;
 
-        /*
-         * Interrupted after erase of Bank0 during previous recovery(FA), Next step = Bank1 marker Page program (0A)
-         * Transition states : FA -> 0A -> GC PROCESS -> 02 -> F2 -> E2
-         */
-    case E_EEPROM_XMC1_INIT_STATE_FA:
-        data_ptr->current_bank = 1U;
-        E_EEPROM_XMC1_lCopyProcessDirtyStateRecovery( E_EEPROM_XMC1_COPY_COMPLETED ,
-                E_EEPROM_XMC1_GC_NEXT_BANK_VALID , 1U);
-        break;
+    /* Clear all error status flags before flash operation*/
+    XMC_FLASH_ClearStatus();
 
-        /*
-         * Interrupted after erase of Bank1 during previous recover(0F), Next step = Bank1 marker Page program (02)
-         * Transition states : 0F -> 02 -> GC PROCESS -> F2 -> E2
-         */
-    case E_EEPROM_XMC1_INIT_STATE_0F:
-        data_ptr->current_bank = 1U;
-        E_EEPROM_XMC1_lCopyProcessDirtyStateRecovery( E_EEPROM_XMC1_VALID_STATE ,
-                E_EEPROM_XMC1_GC_ERASE_PREV_BANK , 0U);
-        break;
+    E_EEPROM_XMC1_lReadSingleBlock(E_EEPROM_XMC1_BANK_BASE(bank), header_ptr);
 
-        /*
-         * Interrupted after erase of Bank1 during previous recover(F0), Next step = Bank1 marker Page program (20)
-         * Transition states : F0 -> 20 -> GC PROCESS -> 2F -> 2E
-         */
-    case E_EEPROM_XMC1_INIT_STATE_F0:
-        /* Change the current Bank to Bank0 */
-        data_ptr->current_bank = 0U;
-        /* Transition states : D0 -> 20 -> GC PROCESS -> 2E */
-        E_EEPROM_XMC1_lCopyProcessDirtyStateRecovery( E_EEPROM_XMC1_VALID_STATE ,
-                E_EEPROM_XMC1_GC_ERASE_PREV_BANK , 0U);
-        break;
+    segment_state = E_EEPROM_XMC1_SEGMENT_DIRTY;
+    if (E_EEPROM_XMC1_lGetFlashStatus() != 0U)
+    {
+        /* Any Hardware errors will result in Dirty state*/
+    }
+    else if ((header_ptr[0] == E_EEPROM_XMC1_SEGMENT_MAGIC) && (header_ptr[E_EEPROM_XMC1_SEGMENT_SEQ_WORD] != 0U) &&
+            (header_ptr[E_EEPROM_XMC1_SEGMENT_SEQ_WORD] == ~header_ptr[E_EEPROM_XMC1_SEGMENT_NSEQ_WORD]) &&
+            (header_ptr[E_EEPROM_XMC1_SEGMENT_COUNT_WORD] == E_EEPROM_XMC1_BANK_COUNT))
+    {
+        sequence = header_ptr[E_EEPROM_XMC1_SEGMENT_SEQ_WORD];
 
-    default:
-        state_found = 0U;
-        break;
+        segment_state = E_EEPROM_XMC1_SEGMENT_RECLAIMED;
+        if (E_EEPROM_XMC1_lReadVerifyMarker(data_ptr, bank,
+                E_EEPROM_XMC1_END_OF_COPY_OFFSET / E_EEPROM_XMC1_FLASH_BLOCK_SIZE) ==
+                E_EEPROM_XMC1_ALL_ONES)
+        {
+            data_ptr->bank_seq[bank] = sequence;
+            segment_state = E_EEPROM_XMC1_SEGMENT_LIVE;
+        }
     }
-    return (state_found);
+    else if ((header_ptr[0] == E_EEPROM_XMC1_ALL_ONES) && (header_ptr[1] == E_EEPROM_XMC1_ALL_ONES) &&
+            (header_ptr[2] == E_EEPROM_XMC1_ALL_ONES) && (header_ptr[3] == E_EEPROM_XMC1_ALL_ONES))
+    {
+        if (E_EEPROM_XMC1_lIsFlashErased(data_ptr, E_EEPROM_XMC1_BANK_BASE(bank), E_EEPROM_XMC1_BLOCKS_PER_PAGE) == 1U)
+        {
+            segment_state = E_EEPROM_XMC1_SEGMENT_ERASED;
+        }
+    }
+    else
+    {
+        /* Interrupted header write or erase */
+    }
+    return (segment_state);
 }
 
 /*******************************************************************************
- * Function Name: E_EEPROM_XMC1_lInitGcNormalStates
+ * Function Name: E_EEPROM_XMC1_lWriteSegmentHeader
  ********************************************************************************
  * Summary:
- * Executes normal Garbage collection state machine sub process
+ * Opens an erased segment of a rotating log by writing its header: magic,
+ * sequence number, inverted sequence number and number of segments.
  *
  * Parameters:
- * current_state  - Current GC state
- * next_process  - Number of logical block
+ * data_ptr - State of the region the request operates on
+ * bank - Segment number
+ * sequence - Sequence number of the segment, above the one of all other segments
  *
  * Return:
- * void
+ * uint32_t - Flash NVM_STATUS register value
  *
  *******************************************************************************/
-static void E_EEPROM_XMC1_lInitGcNormalStates(uint32_t current_state, uint32_t next_process)
+static uint32_t E_EEPROM_XMC1_lWriteSegmentHeader(E_EEPROM_XMC1_DATA_t *const data_ptr, uint32_t bank,
+        uint32_t sequence)
 {
-    E_EEPROM_XMC1_DATA_t *data_ptr;
-    data_ptr = (E_EEPROM_XMC1_DATA_t*)(void*)(e_eeprom_xmc1_handle->data_ptr);
+    uint32_t status;
+    uint32_t *header_ptr;
 
-    /* Update the Bank related global variables */
-    E_EEPROM_XMC1_lUpdateCurrBankInfo();
+    header_ptr = (uint32_t*)(void*)data_ptr->read_write_buffer;
 
-    if (next_process == E_EEPROM_XMC1_EXECUTE_PREP_FLASH)
-    {
-        /* Update the GC state*/
-        data_ptr->gc_state = current_state;
-        /* Start Prepare DFlash routine to build FEE base  */
-        E_EEPROM_XMC1_lPrepareDFlash();
-        /* Update the RAM Cache Table */
-        E_EEPROM_XMC1_lUpdateCache();
-    }
-    else if (next_process == E_EEPROM_XMC1_EXECUTE_GC_STATE)
+    header_ptr[0] = E_EEPROM_XMC1_SEGMENT_MAGIC;
+    header_ptr[E_EEPROM_XMC1_SEGMENT_SEQ_WORD] = sequence;
+    header_ptr[E_EEPROM_XMC1_SEGMENT_NSEQ_WORD] = ~sequence;
+    header_ptr[E_EEPROM_XMC1_SEGMENT_COUNT_WORD] = E_EEPROM_XMC1_BANK_COUNT;
+
+    status = E_EEPROM_XMC1_lGCWrite(data_ptr, E_EEPROM_XMC1_BANK_BASE(bank));
+    if (status == 0U)
     {
-        /* Update the GC state */
-        data_ptr->gc_state = current_state;
-        /* Update the RAM Cache Table */
-        E_EEPROM_XMC1_lUpdateCache();
-        /* Start Garbage Collection */
-        E_EEPROM_XMC1_lGarbageCollection();
+        data_ptr->bank_seq[bank] = sequence;
     }
-    else /* if ( next_process == E_EEPROM_XMC1_EXECUTE_CACHE_UPDATE ) */
+    return (status);
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lGetOlderSegment
+ ********************************************************************************
+ * Summary:
+ * Returns the segment of a rotating log written before the given segment: the
+ * one with the highest sequence number below the sequence number of the given
+ * segment. With two banks there is no older segment.
+ *
+ * Parameters:
+ * data_ptr - State of the region the request operates on
+ * bank - Segment number
+ *
+ * Return:
+ * uint32_t - Segment number, bank_count if no older segment exists
+ *
+ *******************************************************************************/
+static uint32_t E_EEPROM_XMC1_lGetOlderSegment(E_EEPROM_XMC1_DATA_t *const data_ptr, uint32_t bank)
+{
+    uint32_t indx;
+    uint32_t older_bank;
+
+    older_bank = E_EEPROM_XMC1_BANK_COUNT;
+    for (indx = 0U; indx < E_EEPROM_XMC1_BANK_COUNT; indx++)
     {
-        /* Update the RAM Cache Table */
-        E_EEPROM_XMC1_lUpdateCache();
-        /* Update the GC state as Bank-0 Erase Completed state */
-        data_ptr->gc_state = current_state;
+        if ((data_ptr->bank_seq[indx] != 0U) && (data_ptr->bank_seq[indx] < data_ptr->bank_seq[bank]))
+        {
+            if ((older_bank == E_EEPROM_XMC1_BANK_COUNT) ||
+                    (data_ptr->bank_seq[indx] > data_ptr->bank_seq[older_bank]))
+            {
+                older_bank = indx;
+            }
+        }
     }
+    return (older_bank);
 }
 
 /*******************************************************************************
- * Function Name: E_EEPROM_XMC1_lInitGcDataCopyState
+ * Function Name: E_EEPROM_XMC1_lSelectVictimSegment
  ********************************************************************************
  * Summary:
- * Executes data copy state GC state machine sub process.
+ * Selects the segment of a rotating log to be reclaimed with a cost-benefit
+ * policy. The free space gained by reclaiming a segment, weighted by its age,
+ * is divided by the cost of reading the segment and writing its live blocks:
+ * (capacity - live) * age / (capacity + live). The age is the number of
+ * segments opened after it. Segments with rarely updated blocks get old but
+ * keep many live blocks, hence they are reclaimed less often than segments
+ * with frequently updated blocks. On equal score the older segment is taken.
  *
  * Parameters:
- * current_state  - Current GC state
- * marker_offset  - Marker block offset
+ * handle_ptr - Pointer to the handle of the instance
+ * data_ptr - State of the region the request operates on
+ * head_bank - Segment written next, it is not reclaimed. E_EEPROM_XMC1_BANK_COUNT
+ *             if the next segment is not yet opened
+ * head_seq  - Sequence number of the segment written next, the age is taken from it
+ * live_ptr  - Receives the live blocks of the selected segment, NULL if not needed
  *
  * Return:
- * void
+ * uint32_t - Segment number
  *
  *******************************************************************************/
-static void E_EEPROM_XMC1_lInitGcDataCopyState(uint32_t current_state, uint32_t marker_offset)
+static uint32_t E_EEPROM_XMC1_lSelectVictimSegment(E_EEPROM_XMC1_t *const handle_ptr,
+        E_EEPROM_XMC1_DATA_t *const data_ptr, uint32_t head_bank, uint32_t head_seq, uint32_t *const live_ptr)
 {
-    uint32_t status;
-    E_EEPROM_XMC1_DATA_t *data_ptr;
-    data_ptr = (E_EEPROM_XMC1_DATA_t*)(void*)(e_eeprom_xmc1_handle->data_ptr);
-
-    /* Update the Bank related global variables */
-    E_EEPROM_XMC1_lUpdateCurrBankInfo();
+    uint32_t age;
+    uint32_t bank;
+    uint32_t indx;
+    uint32_t score;
+    uint32_t capacity;
+    uint32_t best_bank;
+    uint32_t best_score;
+    uint32_t live_blocks[E_EEPROM_XMC1_MAX_BANK_COUNT];
+    E_EEPROM_XMC1_CACHE_t *cache_ptr;
 
-    /* Update the GC state as restart copy process */
-    data_ptr->gc_state = current_state ;
+    capacity = E_EEPROM_XMC1_BANK_DATA_BLOCKS;
 
-    /* Update the RAM Cache Table with */
-    E_EEPROM_XMC1_lUpdateCache();
+    for (bank = 0U; bank < E_EEPROM_XMC1_BANK_COUNT; bank++)
+    {
+        live_blocks[bank] = 0U;
+    }
 
-    /* Erase the previous redundant bank */
-    status = E_EEPROM_XMC1_lEraseBank(data_ptr->prev_bank_end_addr);
+    /* The latest copy of each consistent block is live in the segment holding it */
+    cache_ptr = data_ptr->block_info;
+    for (indx = 0U; indx < handle_ptr->block_count; indx++)
+    {
+        if ((cache_ptr->address >= E_EEPROM_XMC1_BANK0_BASE) &&
+                (cache_ptr->address < E_EEPROM_XMC1_BANK_BASE(E_EEPROM_XMC1_BANK_COUNT)) &&
+                (cache_ptr->status.consistent == 1U))
+        {
+            bank = (cache_ptr->address - E_EEPROM_XMC1_BANK0_BASE) / E_EEPROM_XMC1_BANK_SIZE;
+            if (cache_ptr->status.valid == 1U)
+            {
+                live_blocks[bank] += E_EEPROM_XMC1_lGetDFLASHPhysicalBlocks(
+                        handle_ptr->block_config_ptr[indx].size);
+            }
+            else
+            {
+                live_blocks[bank]++;
+            }
+        }
+        cache_ptr++;
+    }
 
-    if (status == 0U)
+    best_bank = E_EEPROM_XMC1_BANK_COUNT;
+    best_score = 0U;
+    for (bank = 0U; bank < E_EEPROM_XMC1_BANK_COUNT; bank++)
     {
-        E_EEPROM_XMC1_lSetMarkerBlockBuffer();
+        if ((bank != head_bank) && (data_ptr->bank_seq[bank] != 0U))
+        {
+            age = head_seq - data_ptr->bank_seq[bank];
+            if (age > E_EEPROM_XMC1_SEGMENT_MAX_AGE)
+            {
+                age = E_EEPROM_XMC1_SEGMENT_MAX_AGE;
+            }
 
-        /* Write formatted state to the erased bank (2E)  */
-        status = E_EEPROM_XMC1_lGCWrite((uint32_t)(data_ptr->gc_dest_addr + marker_offset));
+            score = 0U;
+            if (live_blocks[bank] < capacity)
+            {
+                score = ((capacity - live_blocks[bank]) * age) / (capacity + live_blocks[bank]);
+            }
 
-        if (status == 0U)
-        {
-            /* Start Garbage Collection */
-            E_EEPROM_XMC1_lGarbageCollection();
-        }
-        else
-        {
-            data_ptr->gc_state = E_EEPROM_XMC1_GC_FAIL;
+            if ((best_bank == E_EEPROM_XMC1_BANK_COUNT) || (score > best_score) ||
+                    ((score == best_score) && (data_ptr->bank_seq[bank] < data_ptr->bank_seq[best_bank])))
+            {
+                best_bank = bank;
+                best_score = score;
+            }
         }
-
     }
-    else
+
+    if ((live_ptr != NULL) && (best_bank < E_EEPROM_XMC1_BANK_COUNT))
     {
-        data_ptr->gc_state = E_EEPROM_XMC1_GC_FAIL;
+        *live_ptr = live_blocks[best_bank];
     }
-
+    return (best_bank);
 }
 
 /*******************************************************************************
- * Function Name: E_EEPROM_XMC1_lErasedDirtyStateRecovery
+ * Function Name: E_EEPROM_XMC1_lReadMarkerBlocks
  ********************************************************************************
  * Summary:
- * Executes state machine sub process for erase dirty states to recover.
+ * This function will read the Block marker contents
  *
  * Parameters:
- * marker_offset  - Marker block offset
+ * data_ptr - State of the region the request operates on
  *
  * Return:
- * void
+ * uint32_t : marker_dirty_state
  *
  *******************************************************************************/
-static void E_EEPROM_XMC1_lErasedDirtyStateRecovery( uint32_t marker_offset)
+static uint32_t E_EEPROM_XMC1_lReadMarkerBlocks(E_EEPROM_XMC1_DATA_t *const data_ptr)
 {
-    uint32_t  status;
-    E_EEPROM_XMC1_DATA_t *data_ptr;
-    data_ptr = (E_EEPROM_XMC1_DATA_t*)(void*)(e_eeprom_xmc1_handle->data_ptr);
+    uint32_t indx;
+    uint32_t bank;
+    uint32_t block;
+    uint32_t temp_bank_state;
+    uint32_t state_marker_cnt;
+    uint32_t temp_state_marker;
+    uint32_t marker_dirty_state;
 
-    /* Update the Bank related global variables */
-    E_EEPROM_XMC1_lUpdateCurrBankInfo();
+    /* Initialize Local variables */
+    temp_bank_state = 0U;
+    marker_dirty_state = 0U;
+    state_marker_cnt = 0U;
+    do
+    {
+        /* Prepare the variables for state block update */
+        temp_bank_state = (uint32_t)((uint32_t)temp_bank_state << (uint32_t)1U);
 
-    /* Erase the previous redundant bank */
-    status = E_EEPROM_XMC1_lEraseBank(data_ptr->prev_bank_end_addr);
+        bank  = (uint32_t)state_marker_cnt >> E_EEPROM_XMC1_TWO_BIT_POS;
+        block = (uint32_t)state_marker_cnt - ((uint32_t)bank << E_EEPROM_XMC1_TWO_BIT_POS);
 
-    if (status == 0U)
-    {
-        E_EEPROM_XMC1_lSetMarkerBlockBuffer();
+        /* Read the state block of bank*/
+        temp_state_marker = E_EEPROM_XMC1_lReadVerifyMarker(data_ptr, bank , block);
 
-        /* Write formatted state to the erased bank */
-        status = E_EEPROM_XMC1_lGCWrite((uint32_t)(data_ptr->gc_dest_addr + marker_offset));
-        if (status == 0U)
+        if (temp_state_marker == E_EEPROM_XMC1_ALL_ONES)
         {
-            /* Update the RAM Cache Table with the written blocks of data.*/
-            E_EEPROM_XMC1_lUpdateCache();
-
-            data_ptr->gc_state = E_EEPROM_XMC1_GC_IDLE;
+            temp_bank_state |= 1U;
+        }
+        else if (temp_state_marker == E_EEPROM_XMC1_ALL_ZEROS)
+        {
+            temp_bank_state |= 0U;
         }
         else
         {
-            data_ptr->gc_state = E_EEPROM_XMC1_GC_FAIL;
+            indx = (uint32_t)((uint32_t)state_marker_cnt >> E_EEPROM_XMC1_TWO_BIT_POS);
+            marker_dirty_state |= (uint32_t)((uint32_t)1U << (uint32_t)indx);
         }
-    }
-    else
-    {
-        data_ptr->gc_state = E_EEPROM_XMC1_GC_FAIL;
-    }
+        /* Update the counter "StateBlockCnt" */
+        state_marker_cnt++;
+    } while (state_marker_cnt < E_EEPROM_XMC1_EIGHT_BYTES);
+
+    /* Update Global variables */
+    data_ptr->init_gc_state = temp_bank_state;
+
+    return (marker_dirty_state);
 }
 
 /*******************************************************************************
- * Function Name: E_EEPROM_XMC1_lCopyProcessDirtyStateRecovery
+ * Function Name: E_EEPROM_XMC1_lReadVerifyMarker
  ********************************************************************************
  * Summary:
- * Recovers from any copy process dirty state.
+ * This function will verify the marker contents read out from state page.
  *
  * Parameters:
- * current_state   - Current GC state
- * NextState      - Next GC state
- * page_addr_select - Page address from which bank to be written
+ * data_ptr - State of the region the request operates on
+ * Bank  - Bank Number ( 0 / 1 )
+ * Block - Block position
  *
  * Return:
- * void
+ * uint32_t : E_EEPROM_XMC1_ALL_ONES
+ * E_EEPROM_XMC1_ALL_ZEROS
+ * E_EEPROM_XMC1_MB_DIRTY
  *
  *******************************************************************************/
-static void E_EEPROM_XMC1_lCopyProcessDirtyStateRecovery( uint32_t current_state,
-        uint32_t next_state,
-        uint32_t page_addr_select)
+static uint32_t E_EEPROM_XMC1_lReadVerifyMarker(E_EEPROM_XMC1_DATA_t *const data_ptr, uint32_t bank, uint32_t block)
 {
-    uint32_t  status;
-    E_EEPROM_XMC1_DATA_t *data_ptr;
-    data_ptr = (E_EEPROM_XMC1_DATA_t*)(void*)(e_eeprom_xmc1_handle->data_ptr);
+    uint32_t indx;
+    uint32_t return_val;
+    uint32_t ones_counter;
+    uint32_t zeros_counter;
+    uint32_t marker_block_addr;
+    uint32_t *marker_array_ptr;
 
-    /* Update the Bank related global variables */
-    E_EEPROM_XMC1_lUpdateCurrBankInfo();
+    ones_counter = 0U;
+    zeros_counter = 0U;
+    marker_array_ptr = (uint32_t*)(void*)data_ptr->read_write_buffer;
 
-    /* Set the marker blocks with copy completed state */
-    E_EEPROM_XMC1_lSetMarkerPageBuffer(current_state);
+    /* Calculate the Marker Block address from bank and Block size*/
+    marker_block_addr = (E_EEPROM_XMC1_BANK0_BASE +
+            ((uint32_t)bank  * (uint32_t)E_EEPROM_XMC1_BANK_SIZE)) +
+                    ((uint32_t)block * (uint32_t)E_EEPROM_XMC1_FLASH_BLOCK_SIZE);
 
     /* Clear all error status flags before flash operation*/
     XMC_FLASH_ClearStatus();
 
-    /* Decide the bank from page_addr_select and Erase the marker page + Program with the current state + Verify */
-    if (page_addr_select == 1U)
-    {
-        E_EEPROM_XMC1_lWriteSinglePage(data_ptr->gc_dest_addr, (uint32_t*)(void*)data_ptr->page_write_buffer);
-    }
-    else
-    {
-        E_EEPROM_XMC1_lWriteSinglePage(data_ptr->gc_src_addr, (uint32_t*)(void*)data_ptr->page_write_buffer);
-    }
-
-    status = E_EEPROM_XMC1_lGetFlashStatus();
+    /* Read one complete block of data (4 Words = 128 bit) from the targeted Marker Block */
+    E_EEPROM_XMC1_lReadSingleBlock(marker_block_addr, (uint32_t*)(void*)marker_array_ptr);
 
-    if (status == 0U)
+    /* Check for any flash hardware errors*/
+    if (E_EEPROM_XMC1_lGetFlashStatus())
     {
-        /* Update the GC state as write next bank valid */
-        data_ptr->gc_state = next_state ;
-        /* Update the RAM Cache Table */
-        E_EEPROM_XMC1_lUpdateCache();
-        /* Start Garbage Collection */
-        E_EEPROM_XMC1_lGarbageCollection();
+        /* Any Hardware errors will result in Dirty state*/
+        return_val = E_EEPROM_XMC1_MB_DIRTY;
     }
     else
     {
-        data_ptr->gc_state = E_EEPROM_XMC1_GC_FAIL;
+        for (indx = 0U ; indx <E_EEPROM_XMC1_MAX_WORDS_IN_BLOCK ; indx++)
+        {
+            /* Check for the Marker field and verify Marker either 0 or 1*/
+            if (*(marker_array_ptr + indx) == E_EEPROM_XMC1_ALL_ZEROS)
+            {
+                zeros_counter++;
+            }
+
+            if (*(marker_array_ptr + indx) == E_EEPROM_XMC1_ALL_ONES)
+            {
+                ones_counter++;
+            }
+        }
+        if (ones_counter == E_EEPROM_XMC1_FOUR_BYTES)
+        {
+            return_val = E_EEPROM_XMC1_ALL_ONES;
+        }
+        else if (zeros_counter == E_EEPROM_XMC1_FOUR_BYTES)
+        {
+            return_val = E_EEPROM_XMC1_ALL_ZEROS;
+        }
+        else
+        {
+            return_val = E_EEPROM_XMC1_MB_DIRTY;
+        }
     }
+    return (return_val);
 }
 
 /*******************************************************************************
- * Function Name: E_EEPROM_XMC1_lGarbageCollection
+ * Function Name: E_EEPROM_XMC1_lSetMarkerBlockBuffer
  ********************************************************************************
  * Summary:
- * This function execute's the garbage collection state machine.
+ * This function will update the write buffer for a particular bank marker state
  *
  * Parameters:
- * void
+ * data_ptr - State of the region the request operates on
  *
  * Return:
  * void
  *
  *******************************************************************************/
-static void E_EEPROM_XMC1_lGarbageCollection(void)
+static void E_EEPROM_XMC1_lSetMarkerBlockBuffer(E_EEPROM_XMC1_DATA_t *const data_ptr)
 {
-    E_EEPROM_XMC1_DATA_t *data_ptr;
-    data_ptr = (E_EEPROM_XMC1_DATA_t*)(void*)(e_eeprom_xmc1_handle->data_ptr);
+    uint32_t *array_ptr;
+    uint32_t indx;
 
-    do
+    array_ptr = (uint32_t*)(void*)data_ptr->read_write_buffer;
+    for (indx = 0U ; indx < E_EEPROM_XMC1_FOUR_BYTES; indx++)
     {
-        switch (data_ptr->gc_state)
-        {
-        case E_EEPROM_XMC1_GC_COPY_START:
-            E_EEPROM_XMC1_lHandleGcStartCopy();
-            break;
-
-        case E_EEPROM_XMC1_GC_COPY_WRITE:
-            E_EEPROM_XMC1_lHandleGcCopyWrite();
-            break;
-
-        case E_EEPROM_XMC1_GC_READ_NXTBLOCK:
-            XMC_FLASH_ClearStatus();
-            E_EEPROM_XMC1_lReadSingleBlock(data_ptr->gc_src_addr ,(uint32_t*)(void*)data_ptr->read_write_buffer);
-            data_ptr->gc_state = E_EEPROM_XMC1_GC_COPY_WRITE;
-            break;
-
-        case E_EEPROM_XMC1_GC_COPY_END:
-            E_EEPROM_XMC1_lHandleGcEndOfCopy();
-            break;
-
-        case E_EEPROM_XMC1_GC_NEXT_BANK_VALID:
-            E_EEPROM_XMC1_lHandleGcOtherStates(E_EEPROM_XMC1_GC_NEXT_BANK_VALID, E_EEPROM_XMC1_GC_ERASE_PREV_BANK);
-            break;
-
-        case E_EEPROM_XMC1_GC_ERASE_PREV_BANK:
-            E_EEPROM_XMC1_lHandleGcOtherStates( E_EEPROM_XMC1_GC_ERASE_PREV_BANK, E_EEPROM_XMC1_GC_MARK_END_ERASE1);
-            break;
-
-        case E_EEPROM_XMC1_GC_MARK_END_ERASE1:
-            E_EEPROM_XMC1_lHandleGcOtherStates(E_EEPROM_XMC1_GC_MARK_END_ERASE1, E_EEPROM_XMC1_GC_IDLE);
-            break;
-
-        default:
-            E_EEPROM_XMC1_lHandleGcRequested(); /* E_EEPROM_XMC1_GC_REQUESTED state*/
-            break;
-        }
+        array_ptr[indx] = E_EEPROM_XMC1_ALL_ZEROS;
+    }
 
-    } while ((data_ptr->gc_state != E_EEPROM_XMC1_GC_IDLE) &&
-            (data_ptr->gc_state != E_EEPROM_XMC1_GC_FAIL));
 }
 
 /*******************************************************************************
- * Function Name: E_EEPROM_XMC1_lHandleGcRequested
+ * Function Name: E_EEPROM_XMC1_lSetMarkerPageBuffer
  ********************************************************************************
  * Summary:
- * This function handles Garbage Collection GC REQUESTED state
+ * Fill complete Marker PAGE as per the below defined format.
+ *
+ *                          WORD - 0      WORD - 1      WORD - 2     WORD - 3
+ *
+ *             BLOCK0 -  (ZEROS/ONES)  (ZEROS/ONES)   (ZEROS/ONES)   (ZEROS/ONES)
+ *             BLOCK1 -  (ZEROS/ONES)  (ZEROS/ONES)   (ZEROS/ONES)   (ZEROS/ONES)
+ *             BLOCK2 -  (ZEROS/ONES)  (ZEROS/ONES)   (ZEROS/ONES)   (ZEROS/ONES)
+ *             BLOCK3 -  (ZEROS/ONES)  (ZEROS/ONES)   (ZEROS/ONES)   (ZEROS/ONES)
+ *             BLOCK4 -  (0xFFFFFFFF)  (0xFFFFFFFF)   (0xFFFFFFFF)   (0xFFFFFFFF)
+ *             BLOCK5 -  (0xFFFFFFFF)  (0xFFFFFFFF)   (0xFFFFFFFF)   (0xFFFFFFFF)
+ *           ----------------------------------------------------------------------
+ *           ----------------------------------------------------------------------
+ *             BLOCK16-  (0xFFFFFFFF)  (0xFFFFFFFF)   (0xFFFFFFFF)   (0xFFFFFFFF)
  *
  * Parameters:
- * void
+ * data_ptr - State of the region the request operates on
+ * State - Marker State
  *
  * Return:
  * void
  *
  *******************************************************************************/
-static void E_EEPROM_XMC1_lHandleGcRequested(void)
+static void E_EEPROM_XMC1_lSetMarkerPageBuffer(E_EEPROM_XMC1_DATA_t *const data_ptr, uint32_t state)
 {
-    uint32_t status;
-    uint32_t block_count;
-    E_EEPROM_XMC1_DATA_t *data_ptr;
-    E_EEPROM_XMC1_CACHE_t *cache_ptr;
+    uint32_t indx;
+    uint32_t bit_mask;
+    uint32_t word_data;
+    uint32_t *array_ptr;
 
-    data_ptr = (E_EEPROM_XMC1_DATA_t*)(void*)(e_eeprom_xmc1_handle->data_ptr);
+    array_ptr = (uint32_t*)(void*)data_ptr->page_write_buffer;
+    /*
+     * Depending upon the state received check the bit positions where a state marker has to be updated to
+     * get the actual state. Fill the first four blocks of the page with the state marker information.
+     */
 
-    E_EEPROM_XMC1_lSetMarkerBlockBuffer();
-    /* Write Copy start state to new bank  (2A) or (A2) */
-    status = E_EEPROM_XMC1_lGCWrite((uint32_t)(data_ptr->gc_dest_addr + E_EEPROM_XMC1_BEGIN_OFFSET));
-    if (status == 0U)
+    /* Fill the first rest 4 blocks of the page with marker data  */
+    for (bit_mask = 0U;bit_mask < E_EEPROM_XMC1_MARKER_MAX_SHIFT;bit_mask++)
     {
-        /* Initialize the copied status for all the logical blocks */
-        cache_ptr = data_ptr->block_info;
-        block_count = 0U;
-        do
+        if ( (state & (E_EEPROM_XMC1_MARKER_POSITION >> bit_mask )) == 0U )
         {
-            cache_ptr->status.copied = 0U;
-            block_count++;
-            cache_ptr++;
-        } while (block_count != e_eeprom_xmc1_handle->block_count);
+            word_data = E_EEPROM_XMC1_ALL_ZEROS;
+        }
+        else
+        {
+            word_data = E_EEPROM_XMC1_ALL_ONES;
+        }
+        for ( indx = 0U; indx< E_EEPROM_XMC1_MAX_WORDS_IN_BLOCK ; indx++ )
+        {
+            *array_ptr = word_data;
+            array_ptr++;
+        }
 
-        data_ptr->gc_log_block_count = 0U;
-        data_ptr->gc_state = E_EEPROM_XMC1_GC_COPY_START;
-        data_ptr->gc_dest_addr = data_ptr->gc_dest_addr + E_EEPROM_XMC1_DATA_BLOCK_OFFSET;
     }
-    else
+    /* Fill the first rest 12 blocks of the page with all ones*/
+    for (indx = 0U; indx < E_EEPROM_XMC1_PAGE1_EXTRA_WORDS; indx++)
     {
-        data_ptr->gc_state = E_EEPROM_XMC1_GC_FAIL;
+        *array_ptr = E_EEPROM_XMC1_ALL_ONES;
+        array_ptr++;
     }
+
 }
 
 /*******************************************************************************
- * Function Name: E_EEPROM_XMC1_lHandleGcStartCopy
+ * Function Name: E_EEPROM_XMC1_lEraseBank
  ********************************************************************************
  * Summary:
- * This function handles Garbage Collection GC START COPY state
+ * Erases the particular bank
  *
  * Parameters:
- * void
+ * data_ptr - State of the region the request operates on
+ * page_address - Bank end address
  *
  * Return:
- * void
+ * uint32_t - Flash NVM_STATUS register value
  *
  *******************************************************************************/
-static void E_EEPROM_XMC1_lHandleGcStartCopy(void)
+static uint32_t E_EEPROM_XMC1_lEraseBank(E_EEPROM_XMC1_DATA_t *const data_ptr, uint32_t page_address)
 {
-    uint32_t state_flag;
-    uint32_t block_count;
-    E_EEPROM_XMC1_DATA_t *data_ptr;
-    E_EEPROM_XMC1_CACHE_t *cache_ptr;
-
-    data_ptr = (E_EEPROM_XMC1_DATA_t*)(void*)(e_eeprom_xmc1_handle->data_ptr);
-
-    state_flag = 0U;
-    /* initialize the copied status for all the logical blocks */
-    block_count = data_ptr->gc_log_block_count;
-    cache_ptr = data_ptr->block_info + block_count;
-    /*
-     * Check all available blocks in cache table for Copy process. Condition breaks on either the current block is
-     * consistent or all blocks check for consistency is finished
-     */
-    while ((state_flag == 0U) && (block_count != e_eeprom_xmc1_handle->block_count))
-    {
-        /* If block is consistent set state flag for copy enable*/
-        if (((cache_ptr->address != 0U) && (cache_ptr->status.consistent == 1U)) && (cache_ptr->status.copied == 0U))
-        {
-            state_flag = 1U;
-        }
-        /* If block is inconsistent ignore the block from copy and try next block*/
-        else
-        {
-            block_count++;
-            cache_ptr++;
-        }
-    } /* end of while */
+    uint32_t indx;
+    uint32_t status;
+    /* Clear all error status flags before flash operation*/
+    page_address = ((page_address) - E_EEPROM_XMC1_FLASH_PAGE_SIZE );
+    page_address += 1U;
+    indx = 0U;
 
-    /* If block is consistent */
-    if (state_flag == 1U)
+    do
     {
-        data_ptr->gc_src_addr = cache_ptr->address;
-        data_ptr->gc_block_counter = 0U;
-
         /* Clear all error status flags before flash operation*/
         XMC_FLASH_ClearStatus();
 
-        E_EEPROM_XMC1_lReadSingleBlock(data_ptr->gc_src_addr,(uint32_t*)(void*)data_ptr->read_write_buffer);
+        E_EEPROM_XMC1_lEraseSinglePage(page_address);
 
-        /* Return value above is ignored as parameters passed from FEE are correct */
-        data_ptr->gc_state = E_EEPROM_XMC1_GC_COPY_WRITE;
-    }
-    /* Finished copying all the logical blocks */
-    else
-    {
-        /* Update the next free block pointer */
-        data_ptr->next_free_block_addr = data_ptr->gc_dest_addr;
-        data_ptr->gc_src_addr = data_ptr->curr_bank_src_addr;
-        E_EEPROM_XMC1_lUpdateCurrBankInfo();
-        data_ptr->gc_state = E_EEPROM_XMC1_GC_COPY_END;
-    }
-    data_ptr->gc_log_block_count = block_count;
+        status = E_EEPROM_XMC1_lGetFlashStatus();
+
+        page_address = page_address - (E_EEPROM_XMC1_FLASH_PAGE_SIZE );
+        indx++;
+    } while ((indx <E_EEPROM_XMC1_BANK_PAGE_COUNT) && (status == 0U));
+
+    return (status);
 }
 
 /*******************************************************************************
- * Function Name: E_EEPROM_XMC1_lHandleGcCopyWrite
+ * Function Name: E_EEPROM_XMC1_lGCWrite
  ********************************************************************************
  * Summary:
- * This function handles Garbage Collection GC START COPY WRITE state.
+ * Local function to write data into specified location during GC operation
  *
  * Parameters:
- * void
+ * data_ptr - State of the region the request operates on
+ * block_address  - flash address
  *
  * Return:
- * void
+ * uint32_t - Flash NVM_STATUS register value
  *
  *******************************************************************************/
-static void E_EEPROM_XMC1_lHandleGcCopyWrite(void)
+static uint32_t E_EEPROM_XMC1_lGCWrite(E_EEPROM_XMC1_DATA_t *const data_ptr, uint32_t block_address)
 {
-    uint32_t size;
     uint32_t status;
-    uint32_t block_count;
-    uint32_t flash_physical_blocks;
-    E_EEPROM_XMC1_DATA_t *data_ptr;
-    E_EEPROM_XMC1_CACHE_t *cache_ptr;
-
-    data_ptr = (E_EEPROM_XMC1_DATA_t*)(void*)(e_eeprom_xmc1_handle->data_ptr);
 
-    /* initialize the copied status for all the logical blocks */
-    block_count = data_ptr->gc_log_block_count;
-    cache_ptr = data_ptr->block_info + block_count;
+    /* Clear all error status flags before flash operation*/
+    XMC_FLASH_ClearStatus();
 
-    status = E_EEPROM_XMC1_lGCWrite((uint32_t)(data_ptr->gc_dest_addr));
-    if (status == 0U)
-    {
-        (data_ptr->gc_block_counter)++;
-        size = (e_eeprom_xmc1_handle->block_config_ptr[block_count].size);
-        flash_physical_blocks = E_EEPROM_XMC1_lGetDFLASHPhysicalBlocks(size);
-        /* If all the blocks of the logical block are copied */
-        if ((data_ptr->gc_block_counter == flash_physical_blocks) || (cache_ptr->status.valid == 0U))
-        {
-            cache_ptr->status.copied = 1U;
-            block_count++;
-            data_ptr->gc_state = E_EEPROM_XMC1_GC_COPY_START;
-            data_ptr->gc_dest_addr += E_EEPROM_XMC1_FLASH_BLOCK_SIZE;
-            cache_ptr->address = data_ptr->gc_dest_addr - (E_EEPROM_XMC1_FLASH_BLOCK_SIZE * data_ptr->gc_block_counter);
-        }
-        else
-        {
-            data_ptr->gc_src_addr = data_ptr->gc_src_addr + E_EEPROM_XMC1_FLASH_BLOCK_SIZE;
-            data_ptr->gc_dest_addr = data_ptr->gc_dest_addr + E_EEPROM_XMC1_FLASH_BLOCK_SIZE;
-            data_ptr->gc_state = E_EEPROM_XMC1_GC_READ_NXTBLOCK;
-        }
-    }
-    else
-    {
-        data_ptr->gc_state = E_EEPROM_XMC1_GC_FAIL;
-    }
-    data_ptr->gc_log_block_count = block_count;
+    /* Write a single block into flash*/
+    E_EEPROM_XMC1_lWriteSingleBlock(block_address, (uint32_t*)(void*)data_ptr->read_write_buffer);
+    status = E_EEPROM_XMC1_lGetFlashStatus();
+    return (status);
 }
 
 /*******************************************************************************
- * Function Name: E_EEPROM_XMC1_lHandleGcEndOfCopy
+ * Function Name: E_EEPROM_XMC1_lGCWriteBlocks
  ********************************************************************************
  * Summary:
- * This function handles Garbage Collection GC END OF COPY state
+ * Local function to write the blocks of the page buffer into the specified
+ * location during GC copy operation
  *
  * Parameters:
- * void
+ * data_ptr - State of the region the request operates on
+ * block_address  - flash address
+ * num_blocks  - number of flash blocks to be written
  *
  * Return:
- * void
+ * uint32_t - Flash NVM_STATUS register value
  *
  *******************************************************************************/
-static void E_EEPROM_XMC1_lHandleGcEndOfCopy(void)
+static uint32_t E_EEPROM_XMC1_lGCWriteBlocks(E_EEPROM_XMC1_DATA_t *const data_ptr, uint32_t block_address,
+        uint32_t num_blocks)
 {
-    uint32_t  status;
-    E_EEPROM_XMC1_DATA_t *data_ptr;
-    data_ptr = (E_EEPROM_XMC1_DATA_t*)(void*)(e_eeprom_xmc1_handle->data_ptr);
+    uint32_t status;
 
-    E_EEPROM_XMC1_lSetMarkerBlockBuffer();
-    /* Write Copy completed state to old bank (0A) or (A0) */
-    status = E_EEPROM_XMC1_lGCWrite((uint32_t)(data_ptr->gc_src_addr + E_EEPROM_XMC1_END_OF_COPY_OFFSET));
-    if (status == 0U)
-    {
-        /* Update the current bank to next bank */
-        data_ptr->current_bank = data_ptr->current_bank ^ 1U;
+    /* Clear all error status flags before flash operation*/
+    XMC_FLASH_ClearStatus();
 
-        /* Update the Bank related global variables */
-        E_EEPROM_XMC1_lUpdateCurrBankInfo();
-        data_ptr->gc_state = E_EEPROM_XMC1_GC_NEXT_BANK_VALID;
-    }
-    else
-    {
-        data_ptr->gc_state = E_EEPROM_XMC1_GC_FAIL;
-    }
+    /* Write the blocks into flash with a single write request */
+    E_EEPROM_XMC1_lWriteBlocks(block_address, (uint32_t*)(void*)data_ptr->page_write_buffer, num_blocks);
+    status = E_EEPROM_XMC1_lGetFlashStatus();
+    return (status);
 }
 
 /*******************************************************************************
- * Function Name: E_EEPROM_XMC1_lHandleGcOtherStates
+ * Function Name: E_EEPROM_XMC1_lLocalWrite
  ********************************************************************************
  * Summary:
- * This function handles Garbage Collection GC NEXT BANk VALID, ERASE PREV BANK
- * and GC COMPLETED IDLE state
+ * Common local write function to do write block function or invalidate block.
  *
  * Parameters:
- * current_state - current state machine status
- * next_state - next state of the state machine
+ * handle_ptr - Pointer to the handle of the instance
+ * data_ptr - State of the region the request operates on
+ * block_number   - User block number / ID
+ * data_buffer_ptr - Data buffer address
+ * invalidate    - (0 = normal write / 1 = invalidate block)
  *
  * Return:
- * void
+ * uint32_t - Flash NVM_STATUS register value
  *
  *******************************************************************************/
-static void E_EEPROM_XMC1_lHandleGcOtherStates( uint32_t current_state, uint32_t next_state)
+static uint32_t E_EEPROM_XMC1_lLocalWrite(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr,
+        uint8_t block_number,
+        uint8_t* data_buffer_ptr,
+        uint32_t invalidate)
 {
-    uint32_t  status;
-    E_EEPROM_XMC1_DATA_t *data_ptr;
-    data_ptr = (E_EEPROM_XMC1_DATA_t*)(void*)(e_eeprom_xmc1_handle->data_ptr);
+    uint32_t status;
+    uint32_t flash_blocks;
+    uint32_t gc_limit;
+    uint32_t user_block_index;
+    E_EEPROM_XMC1_BLOCK_t *block_ptr;
 
-    if (current_state == E_EEPROM_XMC1_GC_NEXT_BANK_VALID)
-    {
-        E_EEPROM_XMC1_lSetMarkerBlockBuffer();
-        /* Write next bank to valid state  (02) or (20) */
-        status = E_EEPROM_XMC1_lGCWrite((uint32_t)(data_ptr->gc_src_addr + E_EEPROM_XMC1_NEXT_VALID_OFFSET));
-    }
-    else if (current_state == E_EEPROM_XMC1_GC_ERASE_PREV_BANK)
-    {
-        /* Erase the previous redundant bank (F2) or (2F) */
-        status = E_EEPROM_XMC1_lEraseBank(data_ptr->prev_bank_end_addr);
-    }
-    else
+    user_block_index = E_EEPROM_XMC1_lGetUsrBlockIndex(handle_ptr, block_number);
+    block_ptr = handle_ptr->block_config_ptr + user_block_index;
+
+    /* The flash gets modified, the state is sealed again after the write */
+    E_EEPROM_XMC1_lUnsealWarmState(data_ptr);
+
+    /*
+     * Two banks need exactly one garbage collection, a rotating log may need to reclaim every segment once as the
+     * live blocks of a victim fill the opened segment.
+     */
+    gc_limit = 1U;
+    if (E_EEPROM_XMC1_BANK_COUNT > 2U)
     {
-        E_EEPROM_XMC1_lSetMarkerBlockBuffer();
-        /* Write formatted state to the old erased bank (E2) or (2E) */
-        status = E_EEPROM_XMC1_lGCWrite((uint32_t)(data_ptr->gc_dest_addr + E_EEPROM_XMC1_END_ERASE_OFFSET));
+        gc_limit = E_EEPROM_XMC1_BANK_COUNT;
     }
 
-    if (status == 0U)
+    flash_blocks = E_EEPROM_XMC1_lGetDFLASHPhysicalBlocks(block_ptr->size);
+    status = E_EEPROM_XMC1_lReserveFlashBlocks(handle_ptr, data_ptr, flash_blocks, gc_limit);
+
+    /* Write operation Starts */
+    if (status == (uint32_t)E_EEPROM_XMC1_OPERATION_STATUS_SUCCESS)
     {
-        data_ptr->gc_state = next_state;
+        /* The cache entry keeps the previous copy if the write fails, hence it is searched before the write */
+        E_EEPROM_XMC1_lResolveCacheEntry(handle_ptr, data_ptr, user_block_index);
+
+        data_ptr->written_block_counter = 0U;
+        if (invalidate == 1U)
+        {
+            status = E_EEPROM_XMC1_lHandleInvalidReq(handle_ptr, data_ptr, block_number, user_block_index);
+        }
+        else
+        {
+            status = E_EEPROM_XMC1_lHandleWriteReq(handle_ptr, data_ptr, block_number, data_buffer_ptr);
+        }
+        if (status != 0U)
+        {
+            status = (uint32_t)E_EEPROM_XMC1_OPERATION_STATUS_FAILURE;
+        }
+        /* Erase one more page of the previous bank in erase_ahead mode */
+        else if (data_ptr->pending_erase_pages != 0U)
+        {
+            E_EEPROM_XMC1_lHandleEraseAhead(data_ptr);
+        }
+        else
+        {
+            /* Nothing to do */
+        }
     }
-    else
+
+    if (data_ptr->gc_state == E_EEPROM_XMC1_GC_IDLE)
     {
-        data_ptr->gc_state = E_EEPROM_XMC1_GC_FAIL;
+        E_EEPROM_XMC1_lSealWarmState(handle_ptr, data_ptr);
     }
+    return (status);
 }
 
 /*******************************************************************************
- * Function Name: E_EEPROM_XMC1_lPrepareDFlash
+ * Function Name: E_EEPROM_XMC1_lReserveFlashBlocks
  ********************************************************************************
  * Summary:
- * This function executes the prepare data flash to bring the state machine to
- * default state (2E).
+ * Checks that the requested number of physical blocks is free in the current
+ * bank. If not, up to gc_limit garbage collections are executed when it is
+ * enabled by the configuration. Below gc_emergency_level one garbage collection
+ * is executed in any case. The emergency reserve stays free in addition to the
+ * requested blocks.
  *
  * Parameters:
- * void
+ * handle_ptr - Pointer to the handle of the instance
+ * data_ptr - State of the region the request operates on
+ * flash_blocks - Number of physical flash blocks to be written
+ * gc_limit - Maximum number of garbage collections
  *
  * Return:
- * void
+ * uint32_t - E_EEPROM_XMC1_OPERATION_STATUS_SUCCESS if the blocks can be written,
+ *            else NOT_ALLOWED or MEMORY_BANK_FULL
  *
  *******************************************************************************/
-static void E_EEPROM_XMC1_lPrepareDFlash(void)
+static uint32_t E_EEPROM_XMC1_lReserveFlashBlocks(E_EEPROM_XMC1_t *const handle_ptr,
+        E_EEPROM_XMC1_DATA_t *const data_ptr, uint32_t flash_blocks, uint32_t gc_limit)
 {
     uint32_t status;
-    E_EEPROM_XMC1_DATA_t *data_ptr;
-    data_ptr = (E_EEPROM_XMC1_DATA_t*)(void*)(e_eeprom_xmc1_handle->data_ptr);
-
-    do
-    {
-        switch (data_ptr->gc_state)
-        {
-        case E_EEPROM_XMC1_PREPFLASH_2F:
-
-            /* Set the marker blocks with copy completed state */
-            E_EEPROM_XMC1_lSetMarkerPageBuffer(E_EEPROM_XMC1_VALID_STATE);
-
-            /* Clear all error status flags before flash operation*/
-            XMC_FLASH_ClearStatus();
-
-            E_EEPROM_XMC1_lWriteSinglePage(E_EEPROM_XMC1_FLASH_BANK0_BASE , (uint32_t*)(void*)data_ptr->page_write_buffer);
-
-            status = E_EEPROM_XMC1_lGetFlashStatus();
-
-            if (status == 0U)
-            {
-                data_ptr->gc_state = E_EEPROM_XMC1_PREPFLASH_2E;
-            }
-            else
-            {
-                data_ptr->gc_state = E_EEPROM_XMC1_GC_FAIL;
-            }
-            break;
-
-        case E_EEPROM_XMC1_PREPFLASH_2E:
-
-            E_EEPROM_XMC1_lSetMarkerBlockBuffer();
-
-            /* Write Bank1 to formatted state  (2E) */
-            status = E_EEPROM_XMC1_lGCWrite((uint32_t)E_EEPROM_XMC1_FLASH_BANK1_BASE + E_EEPROM_XMC1_END_ERASE_OFFSET);
-
-            if (status == 0U)
-            {
-                data_ptr->gc_state = E_EEPROM_XMC1_GC_IDLE;
-            }
-            else
-            {
-                data_ptr->gc_state = E_EEPROM_XMC1_GC_FAIL;
-            }
-            break;
+    uint32_t gc_count;
+    uint32_t remaining_blocks;
 
-        default:  /* gc_state : E_EEPROM_XMC1_PREPFLASH_FF*/
+    /* Only E_EEPROM_XMC1_EmergencyWrite() writes into the reserve at the end of the bank */
+    flash_blocks += E_EEPROM_XMC1_lGetEmergencyReserveBlocks(handle_ptr);
 
-            /* Erase the previous redundant bank */
-            status = E_EEPROM_XMC1_lEraseBank(data_ptr->curr_bank_end_addr);
+    status = (uint32_t)E_EEPROM_XMC1_OPERATION_STATUS_SUCCESS;
+    remaining_blocks = E_EEPROM_XMC1_lGetFreeDFLASHBlocks(data_ptr);
 
-            /* Erase the previous redundant bank */
-            if (status == 0U)
+    /* Below the emergency level the write executes the garbage collection even if the blocks still fit */
+    if ((remaining_blocks < flash_blocks) ||
+            (E_EEPROM_XMC1_lIsEmergencyGcDue(handle_ptr, data_ptr, remaining_blocks) == 1U))
+    {
+        /* Doesn't do Garbage collection if, GUI option garbage collection is disabled*/
+        if (handle_ptr->garbage_collection == 1U)
+        {
+            /* Request for Garbage Collection and continue */
+            gc_count = 0U;
+            do
             {
-                status = E_EEPROM_XMC1_lEraseBank(data_ptr->prev_bank_end_addr);
+                data_ptr->gc_state = E_EEPROM_XMC1_GC_REQUESTED;
+                E_EEPROM_XMC1_lGarbageCollection(handle_ptr, data_ptr);
+                gc_count++;
 
-                if (status == 0U)
-                {
-                    data_ptr->gc_state = E_EEPROM_XMC1_PREPFLASH_2F;
-                }
-                else
-                {
-                    data_ptr->gc_state = E_EEPROM_XMC1_GC_FAIL;
-                }
-            }
-            else
+                /* Check if space is available in the new bank for the blocks which triggered the GC */
+                remaining_blocks = E_EEPROM_XMC1_lGetFreeDFLASHBlocks(data_ptr);
+
+            } while ((remaining_blocks < flash_blocks) && (data_ptr->gc_state == E_EEPROM_XMC1_GC_IDLE) &&
+                    (gc_count < gc_limit));
+
+            /* Check for GC overflows the complete space in the new bank, hence cant write the GC triggered block*/
+            if ((remaining_blocks < flash_blocks) || (data_ptr->gc_state != E_EEPROM_XMC1_GC_IDLE))
             {
-                data_ptr->gc_state = E_EEPROM_XMC1_GC_FAIL;
+                status = (uint32_t)E_EEPROM_XMC1_OPERATION_STATUS_NOT_ALLOWED;
             }
-            break;
         }
-    } while ((data_ptr->gc_state != E_EEPROM_XMC1_GC_IDLE) &&
-            (data_ptr->gc_state != E_EEPROM_XMC1_GC_FAIL));
+        else
+        {
+            status = (uint32_t)E_EEPROM_XMC1_OPERATION_STATUS_MEMORY_BANK_FULL;
+        }
+    }
+    return (status);
 }
 
 /*******************************************************************************
- * Function Name: E_EEPROM_XMC1_lUpdateCache
+ * Function Name: E_EEPROM_XMC1_lGetEmergencyReserveBlocks
  ********************************************************************************
  * Summary:
- * This utility function update's the cache table which contains the latest
- * information about the FLASH contents.
+ * Returns the number of physical flash blocks of the emergency reserve, the
+ * blocks of a user block of emergency_reserve_size bytes.
  *
  * Parameters:
- * void
+ * handle_ptr - Pointer to the handle of the instance
  *
  * Return:
- * void
+ * uint32_t - Number of physical flash blocks, 0 without reserve
  *
  *******************************************************************************/
-static void E_EEPROM_XMC1_lUpdateCache(void)
+static uint32_t E_EEPROM_XMC1_lGetEmergencyReserveBlocks(E_EEPROM_XMC1_t *const handle_ptr)
 {
-    uint32_t end_addr;
-    uint32_t read_status;
-    E_EEPROM_XMC1_DATA_t *data_ptr;
-    E_EEPROM_XMC1_CACHE_t *cache_ptr;
-
-    data_ptr = (E_EEPROM_XMC1_DATA_t*)(void*)(e_eeprom_xmc1_handle->data_ptr);
+    uint32_t reserve_blocks;
 
-    /* Evaluate the end address of the bank to start reading blocks for cache update */
-    if (data_ptr->current_bank == 0U)
+    reserve_blocks = 0U;
+    if (handle_ptr->emergency_reserve_size != 0U)
     {
-        end_addr = E_EEPROM_XMC1_FLASH_BANK0_BASE + E_EEPROM_XMC1_DATA_BLOCK_OFFSET;
+        reserve_blocks = E_EEPROM_XMC1_lGetDFLASHPhysicalBlocks(handle_ptr->emergency_reserve_size);
     }
-    else
+    return (reserve_blocks);
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lIsGcCopyPending
+ ********************************************************************************
+ * Summary:
+ * Checks if the garbage collection of the selected region is paused in its
+ * block copy, i.e. between the start of the copy and the switch to the new bank
+ * (segment). The free space of the current bank is not known in these states.
+ *
+ * Parameters:
+ * data_ptr - State of the region the request operates on
+ *
+ * Return:
+ * uint32_t - 1 if the block copy is pending, else 0
+ *
+ *******************************************************************************/
+static uint32_t E_EEPROM_XMC1_lIsGcCopyPending(E_EEPROM_XMC1_DATA_t *const data_ptr)
+{
+    uint32_t pending;
+    uint32_t gc_state;
+
+    gc_state = data_ptr->gc_state;
+
+    pending = 0U;
+    if ((gc_state == E_EEPROM_XMC1_GC_COPY_START) || (gc_state == E_EEPROM_XMC1_GC_READ_NXTBLOCK) ||
+            (gc_state == E_EEPROM_XMC1_GC_COPY_WRITE) || (gc_state == E_EEPROM_XMC1_GC_WRITE_INDEX) ||
+            (gc_state == E_EEPROM_XMC1_GC_COPY_END))
     {
-        end_addr = E_EEPROM_XMC1_FLASH_BANK1_BASE + E_EEPROM_XMC1_DATA_BLOCK_OFFSET;
+        pending = 1U;
     }
+    return (pending);
+}
 
-    /* Reset the read number of blocks count variable and reset cache update index */
-    data_ptr->written_block_counter = 0U;
-    data_ptr->updated_cache_index = E_EEPROM_XMC1_LOG_BLOCK_NOT_FOUND;
-
-    /* Start the Cache Update state machine */
-    data_ptr->cache_state = E_EEPROM_XMC1_CACHE_EMPTY_BLOCK;
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lLocalEmergencyWrite
+ ********************************************************************************
+ * Summary:
+ * Writes a block into the free space of the current bank, the emergency
+ * reserve included. Unlike E_EEPROM_XMC1_lLocalWrite(handle_ptr, data_ptr) no garbage collection
+ * and no deferred erase step is executed, a block that does not fit is
+ * rejected.
+ *
+ * Parameters:
+ * handle_ptr - Pointer to the handle of the instance
+ * data_ptr - State of the region the request operates on
+ * block_number   - User block number / ID
+ * data_buffer_ptr - Data buffer address
+ *
+ * Return:
+ * uint32_t - E_EEPROM_XMC1_OPERATION_STATUS_t value
+ *
+ *******************************************************************************/
+static uint32_t E_EEPROM_XMC1_lLocalEmergencyWrite(E_EEPROM_XMC1_t *const handle_ptr,
+        E_EEPROM_XMC1_DATA_t *const data_ptr, uint8_t block_number, uint8_t *data_buffer_ptr)
+{
+    uint32_t status;
+    uint32_t flash_blocks;
+    uint32_t user_block_index;
+    E_EEPROM_XMC1_BLOCK_t *block_ptr;
 
-    /* Point to starting address of last data block of the bank */
-    data_ptr->curr_bank_src_addr += ( E_EEPROM_XMC1_FLASH_BANK_SIZE - E_EEPROM_XMC1_FLASH_BLOCK_SIZE);
-    /* Search for the first entry of a non empty block inside the valid bank starting from bottom */
-    do{
-        read_status = E_EEPROM_XMC1_lCacheEmptyBlkEval(end_addr);
-    } while (data_ptr->cache_state == E_EEPROM_XMC1_CACHE_EMPTY_BLOCK);
+    user_block_index = E_EEPROM_XMC1_lGetUsrBlockIndex(handle_ptr, block_number);
+    block_ptr = handle_ptr->block_config_ptr + user_block_index;
 
-    /* Update the next free block location only if it is not done by the previous function call  */
-    if (data_ptr->next_free_block_addr == 0U)
+    flash_blocks = E_EEPROM_XMC1_lGetDFLASHPhysicalBlocks(block_ptr->size);
+    if (E_EEPROM_XMC1_lGetFreeDFLASHBlocks(data_ptr) < flash_blocks)
     {
-        data_ptr->next_free_block_addr = (data_ptr->curr_bank_src_addr) + E_EEPROM_XMC1_FLASH_BLOCK_SIZE;
+        status = (uint32_t)E_EEPROM_XMC1_OPERATION_STATUS_MEMORY_BANK_FULL;
     }
-
-    /* Execute the Cache update state machine until the Start address of bank is reached traversing from end of bank */
-    while (data_ptr->cache_state != E_EEPROM_XMC1_CACHE_UPDATE_DONE)
+    else
     {
-        /* Check If the previous read had an ECC error or not */
-        if (!(read_status & (uint32_t)XMC_FLASH_STATUS_ECC2_READ_ERROR))
-        {
-            /* Evaluate the Block status since no error found */
-            E_EEPROM_XMC1_lEvalBlockStatus();
-        }
-        else
-        {
-            /* If previous read block of the block had correct block number then mark the block as inconsistent */
-            if ( data_ptr->updated_cache_index != E_EEPROM_XMC1_LOG_BLOCK_NOT_FOUND )
-            {
-                /* Goto the cache table entry for the given block */
-                cache_ptr = data_ptr->block_info;
-                cache_ptr = cache_ptr + data_ptr->updated_cache_index;
-                /* Since CacheUpdateIndex contains valid block the  previous read block must belong to this block */
-                cache_ptr->address = E_EEPROM_XMC1_ALL_ONES;
-            }
-            /* Prepare for the next block */
-            data_ptr->updated_cache_index = E_EEPROM_XMC1_LOG_BLOCK_NOT_FOUND;
-            data_ptr->written_block_counter = 0U;
-        }
-        /* Check if all blocks have been read */
-        if ( data_ptr->curr_bank_src_addr == end_addr )
+        /* The flash gets modified, the state is sealed again after the write */
+        E_EEPROM_XMC1_lUnsealWarmState(data_ptr);
+
+        /* The cache entry keeps the previous copy if the write fails, hence it is searched before the write */
+        E_EEPROM_XMC1_lResolveCacheEntry(handle_ptr, data_ptr, user_block_index);
+
+        data_ptr->written_block_counter = 0U;
+        status = E_EEPROM_XMC1_lHandleWriteReq(handle_ptr, data_ptr, block_number, data_buffer_ptr);
+        if (status != 0U)
         {
-            /* Goto the next state */
-            data_ptr->cache_state = E_EEPROM_XMC1_CACHE_UPDATE_DONE;
+            status = (uint32_t)E_EEPROM_XMC1_OPERATION_STATUS_FAILURE;
         }
-        else
+
+        /* A paused garbage collection is not continued after a warm reset, the state is not sealed */
+        if (data_ptr->gc_state == E_EEPROM_XMC1_GC_IDLE)
         {
-            read_status = E_EEPROM_XMC1_lUpdateCacheBlockRead();
+            E_EEPROM_XMC1_lSealWarmState(handle_ptr, data_ptr);
         }
     }
+    return (status);
 }
 
 /*******************************************************************************
- * Function Name: E_EEPROM_XMC1_lCacheEmptyBlkEval
+ * Function Name: E_EEPROM_XMC1_lIsBlockUnchanged
  ********************************************************************************
  * Summary:
- * This utility function  will search through the FLASH from the bottom of the
- * bank until a readable data block is found.
+ * Checks if the data to be written equals the latest copy of the block in
+ * flash. If the copy has a CRC, a different CRC of the new data shows the
+ * change without reading the data. Otherwise and if the CRC is equal, the data
+ * is compared block by block with the flash contents.
  *
  * Parameters:
- * end_addr - Last address to stop reading the block data
+ * handle_ptr - Pointer to the handle of the instance
+ * data_ptr - State of the region the request operates on
+ * block_number   - User block number / ID
+ * data_buffer_ptr - Data buffer address
  *
  * Return:
- * uint32_t
+ * uint32_t - 1 if the latest copy has the same data and header format, else 0
  *
  *******************************************************************************/
-static uint32_t E_EEPROM_XMC1_lCacheEmptyBlkEval(uint32_t end_addr)
+static uint32_t E_EEPROM_XMC1_lIsBlockUnchanged(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr,
+        uint8_t block_number, uint8_t *const data_buffer_ptr)
 {
-    uint32_t status;
-    uint32_t *read_word_ptr;
-    E_EEPROM_XMC1_DATA_t *data_ptr;
-
-    data_ptr = (E_EEPROM_XMC1_DATA_t*)(void*)(e_eeprom_xmc1_handle->data_ptr);
-
-    XMC_FLASH_ClearStatus();
+    uint32_t unchanged;
+    uint32_t block_size;
+    uint32_t user_block_index;
+    E_EEPROM_XMC1_CACHE_t *cache_ptr;
+#ifdef E_EEPROM_XMC1_CRC_SW_ENABLED
+    uint32_t crc_buffer;
+    uint32_t crc_read_from_flash;
+#endif
 
-    /* Read the complete block */
-    E_EEPROM_XMC1_lReadSingleBlock(data_ptr->curr_bank_src_addr, (uint32_t*)(void*)data_ptr->read_write_buffer);
+    unchanged = 0U;
+    user_block_index = E_EEPROM_XMC1_lGetUsrBlockIndex(handle_ptr, block_number);
+    block_size = handle_ptr->block_config_ptr[user_block_index].size;
+    cache_ptr = data_ptr->block_info + user_block_index;
 
-    status = E_EEPROM_XMC1_lGetFlashStatus();
+    E_EEPROM_XMC1_lResolveCacheEntry(handle_ptr, data_ptr, user_block_index);
 
-    /* If ECC error exists because of any previous interruptions or power failures during Flash operation in progress*/
-    if (status & (uint32_t)XMC_FLASH_STATUS_ECC2_READ_ERROR)
+    /* A copy without CRC is written again if CRC is enabled, and vice versa */
+    if ((cache_ptr->status.valid == 1U) && (cache_ptr->status.consistent == 1U) &&
+            (cache_ptr->status.crc == (uint32_t)handle_ptr->data_block_crc))
     {
-        /* Update the free block location of the valid bank once and for ever until new write happens*/
-        if (data_ptr->next_free_block_addr == 0U)
-        {
-            data_ptr->next_free_block_addr = (data_ptr->curr_bank_src_addr + E_EEPROM_XMC1_FLASH_BLOCK_SIZE );
-        }
+        unchanged = 1U;
 
-        /* Check if all blocks have been read? If yes go to cache update complete state else move to the next block */
-        if ( data_ptr->curr_bank_src_addr == end_addr )
+#ifdef E_EEPROM_XMC1_CRC_SW_ENABLED
+        if (cache_ptr->status.crc == 1U)
         {
-            data_ptr->cache_state = E_EEPROM_XMC1_CACHE_UPDATE_DONE;
+            CRC_SW_CalculateCRC(handle_ptr->crc_handle_ptr, data_buffer_ptr, block_size);
+            crc_buffer = CRC_SW_GetCRCResult(handle_ptr->crc_handle_ptr);
+
+            /* Clear all error status flags before flash operation*/
+            XMC_FLASH_ClearStatus();
+            crc_read_from_flash = E_EEPROM_XMC1_lReadSingleWord(cache_ptr->address);
+
+            if ((E_EEPROM_XMC1_lGetFlashStatus() != 0U) ||
+                    (crc_buffer != (crc_read_from_flash >> E_EEPROM_XMC1_CRC_SHIFT)))
+            {
+                unchanged = 0U;
+            }
         }
-        else
+#endif
+
+        /* An equal CRC does not prove equal data, the data is compared in any case */
+        if (unchanged == 1U)
         {
-            data_ptr->curr_bank_src_addr -= E_EEPROM_XMC1_FLASH_BLOCK_SIZE;
+            unchanged = E_EEPROM_XMC1_lCompareBlockContents(data_ptr, cache_ptr->address, data_buffer_ptr, block_size);
         }
     }
-    /* No ECC Error */
-    else
+    return (unchanged);
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lCompareBlockContents
+ ********************************************************************************
+ * Summary:
+ * Compares the data of a written user data block with a data buffer. The
+ * physical blocks are read one by one, the compare stops at the first
+ * difference or flash read error.
+ *
+ * Parameters:
+ * data_ptr - State of the region the request operates on
+ * block_address   - Flash address of the first physical block
+ * data_buffer_ptr - Data buffer address
+ * block_size      - Size of the user data block
+ *
+ * Return:
+ * uint32_t - 1 if the data is equal, else 0
+ *
+ *******************************************************************************/
+static uint32_t E_EEPROM_XMC1_lCompareBlockContents(E_EEPROM_XMC1_DATA_t *const data_ptr, uint32_t block_address,
+        const uint8_t *const data_buffer_ptr,
+        uint32_t block_size)
+{
+    uint32_t indx;
+    uint32_t equal;
+    uint32_t offset;
+    uint32_t flash_address;
+
+    equal = 1U;
+    indx = 0U;
+    flash_address = block_address;
+    offset = E_EEPROM_XMC1_BLOCK1_DATA_OFFSET;
+
+    while ((equal == 1U) && (indx < block_size))
     {
-        read_word_ptr = ((uint32_t*)(void*)data_ptr->read_write_buffer);
-        /* Check if the first word of the block is having some data written on it */
-        if (*read_word_ptr != E_EEPROM_XMC1_ALL_ONES)
+        XMC_FLASH_ClearStatus();
+        E_EEPROM_XMC1_lReadSingleBlock(flash_address, (uint32_t*)(void*)data_ptr->read_write_buffer);
+        if (E_EEPROM_XMC1_lGetFlashStatus() != 0U)
         {
-            /* Increment the data block count and go to the next block read state */
-            data_ptr->written_block_counter = data_ptr->written_block_counter + 1U;
-            data_ptr->cache_state = E_EEPROM_XMC1_CACHE_NEXT_BLK;
+            equal = 0U;
         }
-        else
+
+        /* Compare the data bytes of the physical block */
+        while ((equal == 1U) && (indx < block_size) && (offset < E_EEPROM_XMC1_FLASH_BLOCK_SIZE))
         {
-            /* Check if all blocks have been read? If yes go to cache update complete state else move to next block */
-            if ( data_ptr->curr_bank_src_addr == end_addr )
+            if (data_ptr->read_write_buffer[offset] != data_buffer_ptr[indx])
             {
-                data_ptr->cache_state = E_EEPROM_XMC1_CACHE_UPDATE_DONE;
+                equal = 0U;
             }
-            data_ptr->curr_bank_src_addr -= E_EEPROM_XMC1_FLASH_BLOCK_SIZE;
+            indx++;
+            offset++;
         }
+
+        flash_address += E_EEPROM_XMC1_FLASH_BLOCK_SIZE;
+        offset = E_EEPROM_XMC1_BLOCK2_DATA_OFFSET;
     }
-    return (status);
+    return (equal);
 }
 
 /*******************************************************************************
- * Function Name: E_EEPROM_XMC1_lEvalBlockStatus
+ * Function Name: E_EEPROM_XMC1_lLocalWriteMulti
  ********************************************************************************
  * Summary:
- * This function evaluates the block status and updates the cache (if required).
- *                    Entry Criteria:
- *                    1) No ECC error
- *                    2) Block number is non zero
- *                    Possible results:
- *                    1) cache updated: consistent
- *                    2) cache updated: inconsistent
- *                    3) cache already updated (no actions done)
- *                    4) cannot evaluate - requires more blocks to be read
+ * Local write function for a list of write/invalidate requests. The space of
+ * all requests is reserved before the first block is programmed, hence a
+ * garbage collection is executed at most once and never between the blocks
+ * of the list. If the list does not fit into the bank after one garbage
+ * collection, no request is written.
  *
  * Parameters:
- * void
+ * handle_ptr - Pointer to the handle of the instance
+ * data_ptr - State of the region the request operates on
+ * req_ptr   - Pointer to the array of write/invalidate requests
+ * req_count - Number of requests in the array
  *
  * Return:
- * void
+ * uint32_t - E_EEPROM_XMC1_OPERATION_STATUS_t value
  *
  *******************************************************************************/
-static void E_EEPROM_XMC1_lEvalBlockStatus(void)
+static uint32_t E_EEPROM_XMC1_lLocalWriteMulti(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr,
+        const E_EEPROM_XMC1_WRITE_REQ_t *const req_ptr, uint32_t req_count)
 {
-    uint32_t size;
     uint32_t indx;
-    uint32_t status_byte;
-    uint8_t  block_number;
-    uint32_t physical_blocks;
-    E_EEPROM_XMC1_DATA_t *data_ptr;
-    E_EEPROM_XMC1_CACHE_t *cache_ptr;
-    E_EEPROM_XMC1_BLOCK_HEADER_t *Ptr;
-
-    data_ptr = (E_EEPROM_XMC1_DATA_t*)(void*)(e_eeprom_xmc1_handle->data_ptr);
-    Ptr = (E_EEPROM_XMC1_BLOCK_HEADER_t *)(void *)data_ptr->read_write_buffer;
-    block_number = Ptr->block_number;
-    status_byte = Ptr->status;
-
-    cache_ptr = data_ptr->block_info;
+    uint32_t status;
+    uint32_t flash_blocks;
+    uint32_t required_blocks;
 
-    /* Get the Index of the read block from the user configuration */
-    indx = E_EEPROM_XMC1_lGetUsrBlockIndex(block_number);
+    /* The flash gets modified, the state is sealed again after the write */
+    E_EEPROM_XMC1_lUnsealWarmState(data_ptr);
 
-    /* If the block is found */
-    if ( (indx != E_EEPROM_XMC1_LOG_BLOCK_NOT_FOUND) )
+    flash_blocks = 0U;
+    for (indx = 0U; indx < req_count; indx++)
     {
-        /* Point to the cache table entry for the block to be evaluated */
-        cache_ptr = cache_ptr + indx;
-
-        /* Store Index of current block */
-        data_ptr->updated_cache_index = indx;
-
-        /* Check if cache table is updated for the given block : address = 0U => cache table not yet updated */
-        if (cache_ptr->address == 0U)
-        {
-            /* If the starting block of the block found */
-            if ((status_byte & E_EEPROM_XMC1_START_BIT ) != 0U)
-            {
-                /* Update the cache with block address */
-                cache_ptr->address = data_ptr->curr_bank_src_addr;
-
-                /* if the Valid bit for the logical block is set */
-                if ((status_byte & (E_EEPROM_XMC1_VALID_BIT) ) != 0U)
-                {
-                    cache_ptr->status.valid = 1U;
-
-                    /* if the CRC bit for the logical block is set */
-                    if ((status_byte & (E_EEPROM_XMC1_CRC_BIT) ) != 0U)
-                    {
-                        cache_ptr->status.crc = 1U;
-                    }
-                    else
-                    {
-                        cache_ptr->status.crc = 0U;
-                    }
-                }
-                else
-                {
-                    cache_ptr->status.valid = 0U;
-                }
-
-                /* Check If number of Flash blocks used for this data block is same in size */
-                size = (uint32_t)(e_eeprom_xmc1_handle->block_config_ptr[indx].size);
-                physical_blocks = E_EEPROM_XMC1_lGetDFLASHPhysicalBlocks(size);
+        XMC_ASSERT("E_EEPROM_XMC1_WriteMulti:Wrong Block Number",
+                (E_EEPROM_XMC1_lGetUsrBlockIndex(handle_ptr, req_ptr[indx].block_number) !=
+                        E_EEPROM_XMC1_LOG_BLOCK_NOT_FOUND));
+        XMC_ASSERT("E_EEPROM_XMC1_WriteMulti:Invalid Buffer Pointer",
+                ((req_ptr[indx].invalidate == 1U) || (req_ptr[indx].data_buffer_ptr != NULL)));
 
-                if ( data_ptr->written_block_counter == physical_blocks)
-                {
-                    cache_ptr->status.consistent = 1U;  /* EVALUATION RESULT : BLOCK CONSISTENT*/
-                }
-                else
-                {
-                    if (cache_ptr->status.valid == 1U)
-                    {
-                        cache_ptr->status.consistent = 0U;  /* EVALUATION RESULT : BLOCK INCONSISTENT */
-                    }
-                    else
-                    {
-                        cache_ptr->status.consistent = 1U; /* If the block is invalid, then mark : BLOCK INCONSISTENT */
-                    }
-                }
-                /* Initialize the Index, block block count for the next read */
-                data_ptr->updated_cache_index = E_EEPROM_XMC1_LOG_BLOCK_NOT_FOUND;
-                data_ptr->written_block_counter = 0U;
-            }
+        flash_blocks += E_EEPROM_XMC1_lGetReqPhysicalBlocks(handle_ptr, &req_ptr[indx]);
+    }
+    required_blocks = flash_blocks + E_EEPROM_XMC1_lGetEmergencyReserveBlocks(handle_ptr);
+
+    /*
+     * A garbage collection is only useful if the blocks it copies and the requests fit into the new bank. A new
+     * segment of a rotating log only takes the live blocks of the reclaimed segment.
+     */
+    if ((E_EEPROM_XMC1_lGetFreeDFLASHBlocks(data_ptr) >= required_blocks) ||
+            (handle_ptr->garbage_collection != 1U) ||
+            ((E_EEPROM_XMC1_BANK_COUNT > 2U) && (required_blocks <= E_EEPROM_XMC1_BANK_DATA_BLOCKS)) ||
+            ((E_EEPROM_XMC1_lGetLiveFlashBlocks(handle_ptr,
+                    data_ptr) + required_blocks) <= E_EEPROM_XMC1_BANK_DATA_BLOCKS))
+    {
+        /* The garbage collection is executed once at most, before the first block is written */
+        status = E_EEPROM_XMC1_lReserveFlashBlocks(handle_ptr, data_ptr, flash_blocks, 1U);
+    }
+    else
+    {
+        status = (uint32_t)E_EEPROM_XMC1_OPERATION_STATUS_MEMORY_BANK_FULL;
+    }
+
+    if ((status == (uint32_t)E_EEPROM_XMC1_OPERATION_STATUS_SUCCESS) && (req_count != 0U))
+    {
+        /* The cache entries keep the previous copies if the write fails, hence they are searched before the write */
+        for (indx = 0U; indx < req_count; indx++)
+        {
+            E_EEPROM_XMC1_lResolveCacheEntry(handle_ptr, data_ptr,
+                    E_EEPROM_XMC1_lGetUsrBlockIndex(handle_ptr, req_ptr[indx].block_number));
+        }
 
+        status = E_EEPROM_XMC1_lHandleWriteMultiReq(handle_ptr, data_ptr, req_ptr, req_count);
+        if (status != 0U)
+        {
+            status = (uint32_t)E_EEPROM_XMC1_OPERATION_STATUS_FAILURE;
+        }
+        /* Erase one more page of the previous bank in erase_ahead mode */
+        else if (data_ptr->pending_erase_pages != 0U)
+        {
+            E_EEPROM_XMC1_lHandleEraseAhead(data_ptr);
         }
         else
         {
-            /*
-             * EVALUATION RESULT : CACHE ALREADY UPDATED
-             * If cache table is already updated for the block, no need to evaluate the block
-             */
-            data_ptr->updated_cache_index = E_EEPROM_XMC1_LOG_BLOCK_NOT_FOUND;
-            data_ptr->written_block_counter = 0U;
+            /* Nothing to do */
         }
     }
+    else if ((status == (uint32_t)E_EEPROM_XMC1_OPERATION_STATUS_NOT_ALLOWED) &&
+            (data_ptr->gc_state == E_EEPROM_XMC1_GC_IDLE))
+    {
+        /* The requests do not fit into the bank after a garbage collection, none of them is written */
+        status = (uint32_t)E_EEPROM_XMC1_OPERATION_STATUS_MEMORY_BANK_FULL;
+    }
     else
     {
-        data_ptr->updated_cache_index = E_EEPROM_XMC1_LOG_BLOCK_NOT_FOUND;
-        data_ptr->written_block_counter = 0U;
+        /* Nothing to do */
+    }
+
+    if (data_ptr->gc_state == E_EEPROM_XMC1_GC_IDLE)
+    {
+        E_EEPROM_XMC1_lSealWarmState(handle_ptr, data_ptr);
     }
+    return (status);
 }
 
 /*******************************************************************************
- * Function Name: E_EEPROM_XMC1_lUpdateCacheBlockRead
+ * Function Name: E_EEPROM_XMC1_lGetReqPhysicalBlocks
  ********************************************************************************
  * Summary:
- * Utility function to read data block from flash for cache update function.
+ * Returns the number of physical flash blocks written for a write/invalidate
+ * request.
  *
  * Parameters:
- * void
+ * handle_ptr - Pointer to the handle of the instance
+ * req_ptr - Pointer to the write/invalidate request
  *
  * Return:
- * uint32_t
+ * uint32_t - Number of physical flash blocks
  *
  *******************************************************************************/
-static uint32_t E_EEPROM_XMC1_lUpdateCacheBlockRead(void)
+static uint32_t E_EEPROM_XMC1_lGetReqPhysicalBlocks(E_EEPROM_XMC1_t *const handle_ptr,
+        const E_EEPROM_XMC1_WRITE_REQ_t *const req_ptr)
 {
-    E_EEPROM_XMC1_DATA_t *data_ptr;
-    data_ptr = (E_EEPROM_XMC1_DATA_t*)(void*)(e_eeprom_xmc1_handle->data_ptr);
-
-    /* Set the Write Source pointer to the next block */
-    data_ptr->curr_bank_src_addr = data_ptr->curr_bank_src_addr -  E_EEPROM_XMC1_FLASH_BLOCK_SIZE;
-
-    /* Clear all error status flags before flash operation*/
-    XMC_FLASH_ClearStatus();
+    uint32_t flash_blocks;
+    E_EEPROM_XMC1_BLOCK_t *block_ptr;
 
-    E_EEPROM_XMC1_lReadSingleBlock(data_ptr->curr_bank_src_addr,  (uint32_t*)(void*)data_ptr->read_write_buffer);
+    if (req_ptr->invalidate == 1U)
+    {
+        flash_blocks = 1U;
+    }
+    else
+    {
+        block_ptr = handle_ptr->block_config_ptr + E_EEPROM_XMC1_lGetUsrBlockIndex(handle_ptr, req_ptr->block_number);
+        flash_blocks = E_EEPROM_XMC1_lGetDFLASHPhysicalBlocks(block_ptr->size);
+    }
+    return (flash_blocks);
+}
 
-    /* Increment number of read block counter  */
-    data_ptr->written_block_counter = data_ptr->written_block_counter + 1U;
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lGetLiveFlashBlocks
+ ********************************************************************************
+ * Summary:
+ * Returns the number of physical flash blocks a garbage collection copies into
+ * the new bank: the latest copy of each consistent and valid user data block.
+ * The tombstones of invalidated blocks are dropped. The running count is exact
+ * once the blocks not yet searched after a lazy mount are searched.
+ *
+ * Parameters:
+ * handle_ptr - Pointer to the handle of the instance
+ * data_ptr - State of the region the request operates on
+ *
+ * Return:
+ * uint32_t - Number of physical flash blocks
+ *
+ *******************************************************************************/
+static uint32_t E_EEPROM_XMC1_lGetLiveFlashBlocks(E_EEPROM_XMC1_t *const handle_ptr,
+        E_EEPROM_XMC1_DATA_t *const data_ptr)
+{
+    /* The garbage collection searches all blocks anyway */
+    E_EEPROM_XMC1_lResolveCache(handle_ptr, data_ptr);
 
-    return (E_EEPROM_XMC1_lGetFlashStatus());
+    return (data_ptr->live_flash_blocks);
 }
 
 /*******************************************************************************
- * Function Name: E_EEPROM_XMC1_lGetUsrBlockIndex
+ * Function Name: E_EEPROM_XMC1_lGetEntryLiveBlocks
  ********************************************************************************
  * Summary:
- * This utility function will return the Index (location) of the block in the
- * user configuration.
+ * Returns the number of physical flash blocks of the latest copy of a block if
+ * the copy is consistent and valid, else 0. The running count of the live blocks
+ * is updated with it before and after each change of the cache entry.
  *
  * Parameters:
- * block_number  - User data block number / ID
+ * handle_ptr - Pointer to the handle of the instance
+ * data_ptr - State of the region the request operates on
+ * block_index - Index of the block in the user configuration
  *
  * Return:
- * uint32_t : returns array index pointer of block configuration
+ * uint32_t - Number of physical flash blocks
  *
  *******************************************************************************/
-static uint32_t E_EEPROM_XMC1_lGetUsrBlockIndex(uint8_t block_number)
+static uint32_t E_EEPROM_XMC1_lGetEntryLiveBlocks(E_EEPROM_XMC1_t *const handle_ptr,
+        E_EEPROM_XMC1_DATA_t *const data_ptr, uint32_t block_index)
 {
-    uint32_t indx;
-    E_EEPROM_XMC1_BLOCK_t  *block_ptr;
+    uint32_t live_blocks;
+    E_EEPROM_XMC1_CACHE_t *cache_ptr;
 
-    indx = 0U;
-    block_ptr = &(e_eeprom_xmc1_handle->block_config_ptr[indx]);
+    cache_ptr = data_ptr->block_info + block_index;
 
-    /* Check for max configured block count reached and block number is matched against the configured block numbers */
-    while ( (indx < e_eeprom_xmc1_handle->block_count) && (block_ptr->block_number != block_number) )
+    live_blocks = 0U;
+    if ((cache_ptr->address != 0U) && (cache_ptr->status.consistent == 1U) && (cache_ptr->status.valid == 1U))
     {
-        indx++;
-        block_ptr++;
+        live_blocks = E_EEPROM_XMC1_lGetDFLASHPhysicalBlocks(handle_ptr->block_config_ptr[block_index].size);
     }
+    return (live_blocks);
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lCountLiveFlashBlocks
+ ********************************************************************************
+ * Summary:
+ * Counts the live flash blocks of all cache entries of the region. Used once
+ * the cache is built by the initialization.
+ *
+ * Parameters:
+ * handle_ptr - Pointer to the handle of the instance
+ * data_ptr - State of the region the request operates on
+ *
+ * Return:
+ * uint32_t - Number of physical flash blocks
+ *
+ *******************************************************************************/
+static uint32_t E_EEPROM_XMC1_lCountLiveFlashBlocks(E_EEPROM_XMC1_t *const handle_ptr,
+        E_EEPROM_XMC1_DATA_t *const data_ptr)
+{
+    uint32_t indx;
+    uint32_t live_blocks;
 
-    if ( indx == e_eeprom_xmc1_handle->block_count )
+    live_blocks = 0U;
+    for (indx = 0U; indx < handle_ptr->block_count; indx++)
     {
-        indx = E_EEPROM_XMC1_LOG_BLOCK_NOT_FOUND;
+        live_blocks += E_EEPROM_XMC1_lGetEntryLiveBlocks(handle_ptr, data_ptr, indx);
     }
-    return (indx);
+    return (live_blocks);
 }
 
 /*******************************************************************************
- * Function Name: E_EEPROM_XMC1_lGetDFLASHPhysicalBlocks
+ * Function Name: E_EEPROM_XMC1_lGetGcFreeBlocks
  ********************************************************************************
  * Summary:
- * Calculates and return the number of FLASH blocks required for a user data
- * block size.
+ * Returns the number of free blocks expected after a garbage collection. With
+ * two banks the live blocks are copied into the other bank. In a rotating log
+ * the next segment is opened and, if it is the last erased one, the live blocks
+ * of the segment selected for reclaim are copied into it. The selection counts
+ * the invalidated blocks as copied, the estimate does not exceed the actual
+ * free space.
  *
  * Parameters:
- * size - size of user data block
+ * handle_ptr - Pointer to the handle of the instance
+ * data_ptr - State of the region the request operates on
  *
  * Return:
- * uint32_t - returns maximum physical flash blocks required to store the data.
+ * uint32_t - Number of physical flash blocks
  *
  *******************************************************************************/
-static uint32_t E_EEPROM_XMC1_lGetDFLASHPhysicalBlocks(uint32_t size)
+static uint32_t E_EEPROM_XMC1_lGetGcFreeBlocks(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr)
 {
-    uint32_t physical_blocks;
+    uint32_t bank;
+    uint32_t erased_banks;
+    uint32_t victim_blocks;
+    uint32_t gc_free_blocks;
 
-    physical_blocks = 1U;
-    /* If size is greater than the  */
-    if ( size > E_EEPROM_XMC1_BLOCK1_DATA_SIZE )
+    if (E_EEPROM_XMC1_BANK_COUNT > 2U)
     {
-        size = size - E_EEPROM_XMC1_BLOCK1_DATA_SIZE;
-        physical_blocks++;
+        erased_banks = 0U;
+        for (bank = 0U; bank < E_EEPROM_XMC1_BANK_COUNT; bank++)
+        {
+            if (data_ptr->bank_seq[bank] == 0U)
+            {
+                erased_banks++;
+            }
+        }
 
-        while (size > E_EEPROM_XMC1_BLOCK2_DATA_SIZE)
+        gc_free_blocks = E_EEPROM_XMC1_BANK_DATA_BLOCKS;
+        if (erased_banks <= 1U)
         {
-            physical_blocks++;
-            size = size - E_EEPROM_XMC1_BLOCK2_DATA_SIZE;
+            victim_blocks = 0U;
+            (void)E_EEPROM_XMC1_lSelectVictimSegment(handle_ptr, data_ptr, E_EEPROM_XMC1_BANK_COUNT,
+                    data_ptr->bank_seq[data_ptr->current_bank] + 1U, &victim_blocks);
+            gc_free_blocks -= victim_blocks;
         }
     }
-    return(physical_blocks);
+    else
+    {
+        gc_free_blocks = E_EEPROM_XMC1_BANK_DATA_BLOCKS - E_EEPROM_XMC1_lGetLiveFlashBlocks(handle_ptr, data_ptr);
+    }
+    return (gc_free_blocks);
 }
 
 /*******************************************************************************
- * Function Name: E_EEPROM_XMC1_lGetFreeDFLASHBlocks
+ * Function Name: E_EEPROM_XMC1_lIsBelowLevel
  ********************************************************************************
  * Summary:
- * This routine will calculate the number of empty DFLASH blocks remaining in the bank.
+ * Checks if a number of free blocks is below a level given in percent of the
+ * data blocks of a bank.
  *
  * Parameters:
- * void
+ * data_ptr - State of the region the request operates on
+ * free_blocks - Number of free physical flash blocks
+ * level       - Level in percent
  *
  * Return:
- * uint32_t : Number of physical blocks left in the bank for writing data.
+ * uint32_t - 1 if the free blocks are below the level, else 0
  *
  *******************************************************************************/
-static uint32_t E_EEPROM_XMC1_lGetFreeDFLASHBlocks(void)
+static uint32_t E_EEPROM_XMC1_lIsBelowLevel(E_EEPROM_XMC1_DATA_t *const data_ptr, uint32_t free_blocks, uint32_t level)
 {
-    uint32_t base_addr;
-    uint32_t free_blocks;
-    E_EEPROM_XMC1_DATA_t *data_ptr;
+    uint32_t below;
 
-    data_ptr = (E_EEPROM_XMC1_DATA_t*)(void*)(e_eeprom_xmc1_handle->data_ptr);
-
-    if (data_ptr->current_bank == 0U)
-    {
-        base_addr = E_EEPROM_XMC1_FLASH_BANK0_BASE;
-    }
-    else
+    below = 0U;
+    if ((free_blocks * E_EEPROM_XMC1_PERCENT) < (level * E_EEPROM_XMC1_BANK_DATA_BLOCKS))
     {
-        base_addr = E_EEPROM_XMC1_FLASH_BANK1_BASE;
+        below = 1U;
     }
-    free_blocks = (uint32_t)( ( (base_addr + E_EEPROM_XMC1_FLASH_BANK_SIZE) - (data_ptr->next_free_block_addr)  )
-            /  E_EEPROM_XMC1_FLASH_BLOCK_SIZE );
-    return (free_blocks);
+    return (below);
 }
 
 /*******************************************************************************
- * Function Name: E_EEPROM_XMC1_lUpdateCurrBankInfo
+ * Function Name: E_EEPROM_XMC1_lIsEmergencyGcDue
  ********************************************************************************
  * Summary:
- * Updates global addresses to keep track of writing and reading operations
- * respectively.
+ * Checks if a write request has to execute a garbage collection although the
+ * blocks still fit: the free space is below gc_emergency_level and the garbage
+ * collection gains space.
  *
  * Parameters:
- * void
+ * handle_ptr - Pointer to the handle of the instance
+ * data_ptr - State of the region the request operates on
+ * free_blocks - Number of free physical flash blocks of the current bank
  *
  * Return:
- * void
+ * uint32_t - 1 if the garbage collection is due, else 0
  *
  *******************************************************************************/
-static void E_EEPROM_XMC1_lUpdateCurrBankInfo(void)
+static uint32_t E_EEPROM_XMC1_lIsEmergencyGcDue(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr,
+        uint32_t free_blocks)
 {
-    E_EEPROM_XMC1_DATA_t *data_ptr;
-    data_ptr = (E_EEPROM_XMC1_DATA_t*)(void*)(e_eeprom_xmc1_handle->data_ptr);
+    uint32_t gc_due;
 
-    if (data_ptr->current_bank == 0U)
+    gc_due = 0U;
+    if ((handle_ptr->garbage_collection == 1U) &&
+            (E_EEPROM_XMC1_lIsBelowLevel(data_ptr, free_blocks, handle_ptr->gc_emergency_level) == 1U) &&
+            (E_EEPROM_XMC1_lGetGcFreeBlocks(handle_ptr, data_ptr) > free_blocks))
     {
-        data_ptr->curr_bank_src_addr = E_EEPROM_XMC1_FLASH_BANK0_BASE;
-        data_ptr->gc_src_addr = E_EEPROM_XMC1_FLASH_BANK0_BASE;
-        data_ptr->gc_dest_addr = E_EEPROM_XMC1_FLASH_BANK1_BASE;
-        data_ptr->curr_bank_end_addr = E_EEPROM_XMC1_FLASH_BANK0_END;
-        data_ptr->prev_bank_end_addr = E_EEPROM_XMC1_FLASH_BANK1_END;
-    }
-    else
-    {
-        data_ptr->curr_bank_src_addr = E_EEPROM_XMC1_FLASH_BANK1_BASE;
-        data_ptr->gc_src_addr = E_EEPROM_XMC1_FLASH_BANK1_BASE;
-        data_ptr->gc_dest_addr = E_EEPROM_XMC1_FLASH_BANK0_BASE;
-        data_ptr->curr_bank_end_addr = E_EEPROM_XMC1_FLASH_BANK1_END;
-        data_ptr->prev_bank_end_addr = E_EEPROM_XMC1_FLASH_BANK0_END;
+        gc_due = 1U;
     }
+    return (gc_due);
 }
 
 /*******************************************************************************
- * Function Name: E_EEPROM_XMC1_lReadMarkerBlocks
+ * Function Name: E_EEPROM_XMC1_lIsIdleGcDue
  ********************************************************************************
  * Summary:
- * This function will read the Block marker contents
+ * Checks if the idle time policy starts a garbage collection of the region.
+ * Below gc_low_watermark a garbage collection is started if it lifts the free
+ * space to the low watermark or above, otherwise it does not pay off until the
+ * bank is full. Once started, further garbage collections follow while the free
+ * space is below gc_high_watermark and each one gains space.
  *
  * Parameters:
- * void
+ * handle_ptr - Pointer to the handle of the instance
+ * data_ptr - State of the region the request operates on
  *
  * Return:
- * uint32_t : marker_dirty_state
+ * uint32_t - 1 if a garbage collection is due, else 0
  *
  *******************************************************************************/
-static uint32_t E_EEPROM_XMC1_lReadMarkerBlocks(void)
+static uint32_t E_EEPROM_XMC1_lIsIdleGcDue(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr)
 {
-    uint32_t indx;
-    uint32_t bank;
-    uint32_t block;
-    uint32_t temp_bank_state;
-    uint32_t state_marker_cnt;
-    uint32_t temp_state_marker;
-    uint32_t marker_dirty_state;
-    E_EEPROM_XMC1_DATA_t *data_ptr;
+    uint32_t gc_due;
+    uint32_t free_blocks;
+    uint32_t gc_free_blocks;
 
-    data_ptr = (E_EEPROM_XMC1_DATA_t*)(void*)(e_eeprom_xmc1_handle->data_ptr);
+    gc_due = 0U;
+    free_blocks = E_EEPROM_XMC1_lGetFreeDFLASHBlocks(data_ptr);
 
-    /* Initialize Local variables */
-    temp_bank_state = 0U;
-    marker_dirty_state = 0U;
-    state_marker_cnt = 0U;
-    do
+    if (data_ptr->idle_gc_active == 1U)
     {
-        /* Prepare the variables for state block update */
-        temp_bank_state = (uint32_t)((uint32_t)temp_bank_state << (uint32_t)1U);
-
-        bank  = (uint32_t)state_marker_cnt >> E_EEPROM_XMC1_TWO_BIT_POS;
-        block = (uint32_t)state_marker_cnt - ((uint32_t)bank << E_EEPROM_XMC1_TWO_BIT_POS);
-
-        /* Read the state block of bank*/
-        temp_state_marker = E_EEPROM_XMC1_lReadVerifyMarker(bank , block);
-
-        if (temp_state_marker == E_EEPROM_XMC1_ALL_ONES)
-        {
-            temp_bank_state |= 1U;
-        }
-        else if (temp_state_marker == E_EEPROM_XMC1_ALL_ZEROS)
+        if ((E_EEPROM_XMC1_lIsBelowLevel(data_ptr, free_blocks, handle_ptr->gc_high_watermark) == 1U) &&
+                (E_EEPROM_XMC1_lGetGcFreeBlocks(handle_ptr, data_ptr) > free_blocks))
         {
-            temp_bank_state |= 0U;
+            gc_due = 1U;
         }
-        else
+    }
+    else if (E_EEPROM_XMC1_lIsBelowLevel(data_ptr, free_blocks, handle_ptr->gc_low_watermark) == 1U)
+    {
+        gc_free_blocks = E_EEPROM_XMC1_lGetGcFreeBlocks(handle_ptr, data_ptr);
+        if ((gc_free_blocks > free_blocks) &&
+                (E_EEPROM_XMC1_lIsBelowLevel(data_ptr, gc_free_blocks, handle_ptr->gc_low_watermark) == 0U))
         {
-            indx = (uint32_t)((uint32_t)state_marker_cnt >> E_EEPROM_XMC1_TWO_BIT_POS);
-            marker_dirty_state |= (uint32_t)((uint32_t)1U << (uint32_t)indx);
+            gc_due = 1U;
         }
-        /* Update the counter "StateBlockCnt" */
-        state_marker_cnt++;
-    } while (state_marker_cnt < E_EEPROM_XMC1_EIGHT_BYTES);
-
-    /* Update Global variables */
-    data_ptr->init_gc_state = temp_bank_state;
-
-    return (marker_dirty_state);
+    }
+    else
+    {
+        /* Enough free space */
+    }
+    return (gc_due);
 }
 
 /*******************************************************************************
- * Function Name: E_EEPROM_XMC1_lReadVerifyMarker
+ * Function Name: E_EEPROM_XMC1_lIdleRegion
  ********************************************************************************
  * Summary:
- * This function will verify the marker contents read out from state page.
+ * Executes the idle time policy for the selected region. A pending garbage
+ * collection or deferred erase is continued, then garbage collections are
+ * started as long as E_EEPROM_XMC1_lIsIdleGcDue(handle_ptr, data_ptr) requests it. Stops when the
+ * given number of flash operations is spent, the garbage collection may then be
+ * paused in any state.
  *
  * Parameters:
- * Bank  - Bank Number ( 0 / 1 )
- * Block - Block position
+ * handle_ptr - Pointer to the handle of the instance
+ * data_ptr - State of the region the request operates on
+ * max_operations - Maximum number of flash program/erase operations
  *
  * Return:
- * uint32_t : E_EEPROM_XMC1_ALL_ONES
- * E_EEPROM_XMC1_ALL_ZEROS
- * E_EEPROM_XMC1_MB_DIRTY
+ * uint32_t - Number of flash program/erase operations executed
  *
  *******************************************************************************/
-static uint32_t E_EEPROM_XMC1_lReadVerifyMarker(uint32_t bank, uint32_t block)
+static uint32_t E_EEPROM_XMC1_lIdleRegion(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr,
+        uint32_t max_operations)
 {
-    uint32_t indx;
-    uint32_t return_val;
-    uint32_t ones_counter;
-    uint32_t zeros_counter;
-    uint32_t marker_block_addr;
-    uint32_t *marker_array_ptr;
-    E_EEPROM_XMC1_DATA_t *data_ptr;
-
-    data_ptr = (E_EEPROM_XMC1_DATA_t*)(void*)(e_eeprom_xmc1_handle->data_ptr);
-
-    ones_counter = 0U;
-    zeros_counter = 0U;
-    marker_array_ptr = (uint32_t*)(void*)data_ptr->read_write_buffer;
-
-    /* Calculate the Marker Block address from bank and Block size*/
-    marker_block_addr = (E_EEPROM_XMC1_FLASH_BANK0_BASE +
-            ((uint32_t)bank  * (uint32_t)E_EEPROM_XMC1_FLASH_BANK_SIZE)) +
-                    ((uint32_t)block * (uint32_t)E_EEPROM_XMC1_FLASH_BLOCK_SIZE);
-
-    /* Clear all error status flags before flash operation*/
-    XMC_FLASH_ClearStatus();
+    uint32_t idle_done;
+    uint32_t flash_operations;
 
-    /* Read one complete block of data (4 Words = 128 bit) from the targeted Marker Block */
-    E_EEPROM_XMC1_lReadSingleBlock(marker_block_addr, (uint32_t*)(void*)marker_array_ptr);
+    flash_operations = 0U;
+    idle_done = 0U;
 
-    /* Check for any flash hardware errors*/
-    if (E_EEPROM_XMC1_lGetFlashStatus())
-    {
-        /* Any Hardware errors will result in Dirty state*/
-        return_val = E_EEPROM_XMC1_MB_DIRTY;
-    }
-    else
+    if (data_ptr->gc_state != E_EEPROM_XMC1_GC_FAIL)
     {
-        for (indx = 0U ; indx <E_EEPROM_XMC1_MAX_WORDS_IN_BLOCK ; indx++)
+        E_EEPROM_XMC1_lUnsealWarmState(data_ptr);
+
+        while ((flash_operations < max_operations) && (idle_done == 0U) &&
+                (data_ptr->gc_state != E_EEPROM_XMC1_GC_FAIL))
         {
-            /* Check for the Marker field and verify Marker either 0 or 1*/
-            if (*(marker_array_ptr + indx) == E_EEPROM_XMC1_ALL_ZEROS)
+            if (data_ptr->gc_state != E_EEPROM_XMC1_GC_IDLE)
             {
-                zeros_counter++;
+                flash_operations += E_EEPROM_XMC1_lGarbageCollectionStep(handle_ptr, data_ptr);
             }
-
-            if (*(marker_array_ptr + indx) == E_EEPROM_XMC1_ALL_ONES)
+            else if (data_ptr->pending_erase_pages != 0U)
             {
-                ones_counter++;
+                E_EEPROM_XMC1_lHandleEraseAhead(data_ptr);
+                flash_operations++;
+            }
+            else if (E_EEPROM_XMC1_lIsIdleGcDue(handle_ptr, data_ptr) == 1U)
+            {
+                data_ptr->idle_gc_active = 1U;
+                data_ptr->gc_state = E_EEPROM_XMC1_GC_REQUESTED;
+            }
+            else
+            {
+                data_ptr->idle_gc_active = 0U;
+                idle_done = 1U;
             }
         }
-        if (ones_counter == E_EEPROM_XMC1_FOUR_BYTES)
-        {
-            return_val = E_EEPROM_XMC1_ALL_ONES;
-        }
-        else if (zeros_counter == E_EEPROM_XMC1_FOUR_BYTES)
-        {
-            return_val = E_EEPROM_XMC1_ALL_ZEROS;
-        }
-        else
+
+        /* A paused garbage collection is not continued after a warm reset, the state is not sealed */
+        if (data_ptr->gc_state == E_EEPROM_XMC1_GC_IDLE)
         {
-            return_val = E_EEPROM_XMC1_MB_DIRTY;
+            E_EEPROM_XMC1_lSealWarmState(handle_ptr, data_ptr);
         }
     }
-    return (return_val);
+    return (flash_operations);
 }
 
 /*******************************************************************************
- * Function Name: E_EEPROM_XMC1_lSetMarkerBlockBuffer
+ * Function Name: E_EEPROM_XMC1_lCompleteIdleGc
  ********************************************************************************
  * Summary:
- * This function will update the write buffer for a particular bank marker state
+ * Completes a garbage collection of the selected region paused by
+ * E_EEPROM_XMC1_Idle(), so that the following write request is accepted. A
+ * garbage collection paused by E_EEPROM_XMC1_GcStep() is not touched.
  *
  * Parameters:
- * void
+ * handle_ptr - Pointer to the handle of the instance
+ * data_ptr - State of the region the request operates on
  *
  * Return:
  * void
  *
  *******************************************************************************/
-static void E_EEPROM_XMC1_lSetMarkerBlockBuffer(void)
+static void E_EEPROM_XMC1_lCompleteIdleGc(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr)
 {
-    uint32_t *array_ptr;
-    uint32_t indx;
-    E_EEPROM_XMC1_DATA_t *data_ptr;
-    data_ptr = (E_EEPROM_XMC1_DATA_t*)(void*)(e_eeprom_xmc1_handle->data_ptr);
-
-    array_ptr = (uint32_t*)(void*)data_ptr->read_write_buffer;
-    for (indx = 0U ; indx < E_EEPROM_XMC1_FOUR_BYTES; indx++)
+    if ((handle_ptr->state == E_EEPROM_XMC1_STATUS_SUCCESS) && (data_ptr->idle_gc_active == 1U) &&
+            (data_ptr->gc_state != E_EEPROM_XMC1_GC_IDLE) && (data_ptr->gc_state != E_EEPROM_XMC1_GC_FAIL))
     {
-        array_ptr[indx] = E_EEPROM_XMC1_ALL_ZEROS;
-    }
+        E_EEPROM_XMC1_lGarbageCollection(handle_ptr, data_ptr);
 
+        if (data_ptr->gc_state == E_EEPROM_XMC1_GC_IDLE)
+        {
+            E_EEPROM_XMC1_lSealWarmState(handle_ptr, data_ptr);
+        }
+    }
 }
 
 /*******************************************************************************
- * Function Name: E_EEPROM_XMC1_lSetMarkerPageBuffer
+ * Function Name: E_EEPROM_XMC1_lHandleWriteMultiReq
  ********************************************************************************
  * Summary:
- * Fill complete Marker PAGE as per the below defined format.
- *
- *                          WORD - 0      WORD - 1      WORD - 2     WORD - 3
- *
- *             BLOCK0 -  (ZEROS/ONES)  (ZEROS/ONES)   (ZEROS/ONES)   (ZEROS/ONES)
- *             BLOCK1 -  (ZEROS/ONES)  (ZEROS/ONES)   (ZEROS/ONES)   (ZEROS/ONES)
- *             BLOCK2 -  (ZEROS/ONES)  (ZEROS/ONES)   (ZEROS/ONES)   (ZEROS/ONES)
- *             BLOCK3 -  (ZEROS/ONES)  (ZEROS/ONES)   (ZEROS/ONES)   (ZEROS/ONES)
- *             BLOCK4 -  (0xFFFFFFFF)  (0xFFFFFFFF)   (0xFFFFFFFF)   (0xFFFFFFFF)
- *             BLOCK5 -  (0xFFFFFFFF)  (0xFFFFFFFF)   (0xFFFFFFFF)   (0xFFFFFFFF)
- *           ----------------------------------------------------------------------
- *           ----------------------------------------------------------------------
- *             BLOCK16-  (0xFFFFFFFF)  (0xFFFFFFFF)   (0xFFFFFFFF)   (0xFFFFFFFF)
+ * Populates the physical blocks of all requests one after the other into the
+ * page buffer. The buffer is programmed with a single write request whenever
+ * the next block starts a new flash page, hence at most one write request per
+ * page is needed. The cache entries are updated after the last write.
  *
  * Parameters:
- * State - Marker State
+ * handle_ptr - Pointer to the handle of the instance
+ * data_ptr - State of the region the request operates on
+ * req_ptr   - Pointer to the array of write/invalidate requests
+ * req_count - Number of requests in the array
  *
  * Return:
- * void
+ * uint32_t - Flash NVM_STATUS register value
  *
  *******************************************************************************/
-static void E_EEPROM_XMC1_lSetMarkerPageBuffer(uint32_t state)
+static uint32_t E_EEPROM_XMC1_lHandleWriteMultiReq(E_EEPROM_XMC1_t *const handle_ptr,
+        E_EEPROM_XMC1_DATA_t *const data_ptr, const E_EEPROM_XMC1_WRITE_REQ_t *const req_ptr,
+        uint32_t req_count)
 {
     uint32_t indx;
-    uint32_t bit_mask;
-    uint32_t word_data;
-    uint32_t *array_ptr;
-    E_EEPROM_XMC1_DATA_t *data_ptr;
-
-    data_ptr = (E_EEPROM_XMC1_DATA_t*)(void*)(e_eeprom_xmc1_handle->data_ptr);
+    uint32_t status;
+    uint32_t block_size;
+    uint32_t page_blocks;
+    uint32_t written_end_addr;
+    E_EEPROM_XMC1_BLOCK_t *block_ptr;
 
-    array_ptr = (uint32_t*)(void*)data_ptr->page_write_buffer;
-    /*
-     * Depending upon the state received check the bit positions where a state marker has to be updated to
-     * get the actual state. Fill the first four blocks of the page with the state marker information.
-     */
+    status = 0U;
+    page_blocks = 0U;
+    data_ptr->written_block_counter = 0U;
 
-    /* Fill the first rest 4 blocks of the page with marker data  */
-    for (bit_mask = 0U;bit_mask < E_EEPROM_XMC1_MARKER_MAX_SHIFT;bit_mask++)
+    for (indx = 0U; (indx < req_count) && (status == 0U); indx++)
     {
-        if ( (state & (E_EEPROM_XMC1_MARKER_POSITION >> bit_mask )) == 0U )
+        if (req_ptr[indx].invalidate == 1U)
         {
-            word_data = E_EEPROM_XMC1_ALL_ZEROS;
+            E_EEPROM_XMC1_lPopulateInvalidBlock(data_ptr, req_ptr[indx].block_number);
+            status = E_EEPROM_XMC1_lBufferMultiBlock(data_ptr, &page_blocks);
         }
         else
         {
-            word_data = E_EEPROM_XMC1_ALL_ONES;
-        }
-        for ( indx = 0U; indx< E_EEPROM_XMC1_MAX_WORDS_IN_BLOCK ; indx++ )
-        {
-            *array_ptr = word_data;
-            array_ptr++;
-        }
+            block_ptr = handle_ptr->block_config_ptr +
+                    E_EEPROM_XMC1_lGetUsrBlockIndex(handle_ptr, req_ptr[indx].block_number);
+            block_size = block_ptr->size;
+            data_ptr->user_write_bytes_count = 0U;
 
+            E_EEPROM_XMC1_lPopulateFirstBlock(handle_ptr, data_ptr, req_ptr[indx].block_number,
+                    req_ptr[indx].data_buffer_ptr, block_size);
+            do
+            {
+                status = E_EEPROM_XMC1_lBufferMultiBlock(data_ptr, &page_blocks);
+                if (data_ptr->user_write_state == E_EEPROM_XMC1_LAST_BLOCK_WRITE)
+                {
+                    data_ptr->user_write_state = E_EEPROM_XMC1_BLOCK_WRITE_IDLE;
+                }
+                else
+                {
+                    E_EEPROM_XMC1_lPopulateNextBlock(data_ptr, req_ptr[indx].block_number,
+                            req_ptr[indx].data_buffer_ptr,
+                            block_size);
+                }
+            } while ((status == 0U) && (data_ptr->user_write_state != E_EEPROM_XMC1_BLOCK_WRITE_IDLE));
+        }
     }
-    /* Fill the first rest 12 blocks of the page with all ones*/
-    for (indx = 0U; indx < E_EEPROM_XMC1_PAGE1_EXTRA_WORDS; indx++)
+
+    /* Program the blocks of the last page */
+    if ((status == 0U) && (page_blocks != 0U))
     {
-        *array_ptr = E_EEPROM_XMC1_ALL_ONES;
-        array_ptr++;
+        status = E_EEPROM_XMC1_lFlushMultiBlocks(data_ptr, &page_blocks);
     }
 
+    /* On failure the blocks of the failed write request are skipped, page_blocks holds their count */
+    written_end_addr = data_ptr->next_free_block_addr +
+            (data_ptr->written_block_counter * E_EEPROM_XMC1_FLASH_BLOCK_SIZE);
+    E_EEPROM_XMC1_lUpdateCacheMulti(handle_ptr, data_ptr, req_ptr, req_count, written_end_addr,
+            written_end_addr + (page_blocks * E_EEPROM_XMC1_FLASH_BLOCK_SIZE));
+
+    return (status);
 }
 
 /*******************************************************************************
- * Function Name: E_EEPROM_XMC1_lEraseBank
+ * Function Name: E_EEPROM_XMC1_lBufferMultiBlock
  ********************************************************************************
  * Summary:
- * Erases the particular bank
+ * Appends the populated block of the read/write buffer to the page buffer. If
+ * the following block starts a new flash page, the page buffer is programmed.
  *
  * Parameters:
- * page_address - Bank end address
+ * data_ptr - State of the region the request operates on
+ * page_blocks_ptr - Number of blocks in the page buffer
  *
  * Return:
  * uint32_t - Flash NVM_STATUS register value
  *
  *******************************************************************************/
-static uint32_t E_EEPROM_XMC1_lEraseBank(uint32_t page_address)
+static uint32_t E_EEPROM_XMC1_lBufferMultiBlock(E_EEPROM_XMC1_DATA_t *const data_ptr, uint32_t *const page_blocks_ptr)
 {
     uint32_t indx;
     uint32_t status;
-    /* Clear all error status flags before flash operation*/
-    page_address = ((page_address) - E_EEPROM_XMC1_FLASH_PAGE_SIZE );
-    page_address += 1U;
-    indx = 0U;
+    uint32_t next_block_addr;
+    uint32_t *page_buffer_ptr;
 
-    do
+    status = 0U;
+    page_buffer_ptr = (uint32_t*)(void*)data_ptr->page_write_buffer +
+            (*page_blocks_ptr * E_EEPROM_XMC1_MAX_WORDS_IN_BLOCK);
+    for (indx = 0U; indx < E_EEPROM_XMC1_MAX_WORDS_IN_BLOCK; indx++)
     {
-        /* Clear all error status flags before flash operation*/
-        XMC_FLASH_ClearStatus();
-
-        E_EEPROM_XMC1_lEraseSinglePage(page_address);
-
-        status = E_EEPROM_XMC1_lGetFlashStatus();
-
-        page_address = page_address - (E_EEPROM_XMC1_FLASH_PAGE_SIZE );
-        indx++;
-    } while ((indx <E_EEPROM_XMC1_BANK_PAGES) && (status == 0U));
+        page_buffer_ptr[indx] = ((uint32_t*)(void*)data_ptr->read_write_buffer)[indx];
+    }
+    (*page_blocks_ptr)++;
 
+    next_block_addr = data_ptr->next_free_block_addr +
+            ((data_ptr->written_block_counter + *page_blocks_ptr) * E_EEPROM_XMC1_FLASH_BLOCK_SIZE);
+    if ((next_block_addr & (E_EEPROM_XMC1_FLASH_PAGE_SIZE - 1U)) == 0U)
+    {
+        status = E_EEPROM_XMC1_lFlushMultiBlocks(data_ptr, page_blocks_ptr);
+    }
     return (status);
 }
 
 /*******************************************************************************
- * Function Name: E_EEPROM_XMC1_lGCWrite
+ * Function Name: E_EEPROM_XMC1_lFlushMultiBlocks
  ********************************************************************************
  * Summary:
- * Local function to write data into specified location during GC operation
+ * Programs the blocks of the page buffer behind the blocks already written by
+ * the current request.
  *
  * Parameters:
- * block_address  - flash address
+ * data_ptr - State of the region the request operates on
+ * page_blocks_ptr - Number of blocks in the page buffer, cleared on success
  *
  * Return:
  * uint32_t - Flash NVM_STATUS register value
  *
  *******************************************************************************/
-static uint32_t E_EEPROM_XMC1_lGCWrite(uint32_t block_address)
+static uint32_t E_EEPROM_XMC1_lFlushMultiBlocks(E_EEPROM_XMC1_DATA_t *const data_ptr, uint32_t *const page_blocks_ptr)
 {
     uint32_t status;
-    E_EEPROM_XMC1_DATA_t *data_ptr;
 
-    data_ptr = (E_EEPROM_XMC1_DATA_t*)(void*)(e_eeprom_xmc1_handle->data_ptr);
-
-    /* Clear all error status flags before flash operation*/
-    XMC_FLASH_ClearStatus();
-
-    /* Write a single block into flash*/
-    E_EEPROM_XMC1_lWriteSingleBlock(block_address, (uint32_t*)(void*)data_ptr->read_write_buffer);
-    status = E_EEPROM_XMC1_lGetFlashStatus();
+    status = E_EEPROM_XMC1_lGCWriteBlocks(data_ptr, data_ptr->next_free_block_addr +
+            (data_ptr->written_block_counter * E_EEPROM_XMC1_FLASH_BLOCK_SIZE), *page_blocks_ptr);
+    if (status == 0U)
+    {
+        data_ptr->written_block_counter += *page_blocks_ptr;
+        *page_blocks_ptr = 0U;
+    }
     return (status);
 }
 
 /*******************************************************************************
- * Function Name: E_EEPROM_XMC1_lLocalWrite
+ * Function Name: E_EEPROM_XMC1_lUpdateCacheMulti
  ********************************************************************************
  * Summary:
- * Common local write function to do write block function or invalidate block.
+ * Updates the cache entries of a list of write/invalidate requests and the next
+ * free block address. Requests completely written are updated as after a
+ * single write/invalidate, requests touched by a failed write request are marked
+ * inconsistent and requests behind are not modified.
  *
  * Parameters:
- * block_number   - User block number / ID
- * data_buffer_ptr - Data buffer address
- * invalidate    - (0 = normal write / 1 = invalidate block)
+ * handle_ptr - Pointer to the handle of the instance
+ * data_ptr - State of the region the request operates on
+ * req_ptr   - Pointer to the array of write/invalidate requests
+ * req_count - Number of requests in the array
+ * written_end_addr - End address of the successfully written blocks
+ * failed_end_addr  - End address of the failed write request, else written_end_addr
  *
  * Return:
- * uint32_t - Flash NVM_STATUS register value
+ * void
  *
  *******************************************************************************/
-static uint32_t E_EEPROM_XMC1_lLocalWrite( uint8_t block_number,
-        uint8_t* data_buffer_ptr,
-        uint32_t invalidate)
+static void E_EEPROM_XMC1_lUpdateCacheMulti(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr,
+        const E_EEPROM_XMC1_WRITE_REQ_t *const req_ptr, uint32_t req_count,
+        uint32_t written_end_addr, uint32_t failed_end_addr)
 {
-    uint32_t status;
-    uint32_t flash_blocks;
-    uint32_t perform_write;
-    uint32_t user_block_index;
-    uint32_t remaining_blocks;
-    E_EEPROM_XMC1_DATA_t *data_ptr;
-    E_EEPROM_XMC1_BLOCK_t *block_ptr;
-
-    data_ptr = (E_EEPROM_XMC1_DATA_t*)(void*)(e_eeprom_xmc1_handle->data_ptr);
-
-    status = 0U;
-    perform_write = 0U;
-    user_block_index = E_EEPROM_XMC1_lGetUsrBlockIndex(block_number);
-    block_ptr = e_eeprom_xmc1_handle->block_config_ptr + user_block_index;
-
-    flash_blocks = E_EEPROM_XMC1_lGetDFLASHPhysicalBlocks(block_ptr->size);
-    remaining_blocks = E_EEPROM_XMC1_lGetFreeDFLASHBlocks();
+    uint32_t indx;
+    uint32_t block_addr;
+    uint32_t block_index;
+    uint32_t block_end_addr;
+    E_EEPROM_XMC1_CACHE_t *cache_ptr;
 
-    if (remaining_blocks < flash_blocks)
+    block_addr = data_ptr->next_free_block_addr;
+    for (indx = 0U; (indx < req_count) && (block_addr < failed_end_addr); indx++)
     {
-        /* Doesn't do Garbage collection if, GUI option garbage collection is disabled*/
-        if (e_eeprom_xmc1_handle->garbage_collection == 1U)
-        {
-            /* Request for Garbage Collection and continue */
-            data_ptr->gc_state = E_EEPROM_XMC1_GC_REQUESTED;
-            E_EEPROM_XMC1_lGarbageCollection();
+        block_index = E_EEPROM_XMC1_lGetUsrBlockIndex(handle_ptr, req_ptr[indx].block_number);
+        cache_ptr = &data_ptr->block_info[block_index];
+        block_end_addr = block_addr +
+                (E_EEPROM_XMC1_lGetReqPhysicalBlocks(handle_ptr, &req_ptr[indx]) * E_EEPROM_XMC1_FLASH_BLOCK_SIZE);
 
-            /*Check the size of the GC requested block to check if space is available in the new bank or not.*/
-            flash_blocks = E_EEPROM_XMC1_lGetDFLASHPhysicalBlocks(block_ptr->size);
-            remaining_blocks = E_EEPROM_XMC1_lGetFreeDFLASHBlocks();
+        data_ptr->live_flash_blocks -= E_EEPROM_XMC1_lGetEntryLiveBlocks(handle_ptr, data_ptr, block_index);
 
-            /* Check for GC overflows the complete space in the new bank, hence cant write the GC triggered block*/
-            if ((remaining_blocks >= flash_blocks)&&(data_ptr->gc_state == E_EEPROM_XMC1_GC_IDLE))
+        if (block_end_addr <= written_end_addr)
+        {
+            cache_ptr->address = block_addr;
+            cache_ptr->status.consistent = 1U;
+            if (req_ptr[indx].invalidate == 1U)
             {
-                perform_write = 1U;
+                cache_ptr->status.valid = 0U;
             }
             else
             {
-                status = (uint32_t)E_EEPROM_XMC1_OPERATION_STATUS_NOT_ALLOWED;
+                cache_ptr->status.valid = 1U;
+                if (handle_ptr->data_block_crc == 1U)
+                {
+                    cache_ptr->status.crc = 1U;
+                }
+                else
+                {
+                    cache_ptr->status.crc = 0U;
+                }
             }
         }
         else
         {
-            status = (uint32_t)E_EEPROM_XMC1_OPERATION_STATUS_MEMORY_BANK_FULL;
-        }
-    }
-    else
-    {
-        perform_write = 1U;
-    }
-    /* Write operation Starts */
-    if (perform_write == 1U)
-    {
-        data_ptr->written_block_counter = 0U;
-        if (invalidate == 1U)
-        {
-            status = E_EEPROM_XMC1_lHandleInvalidReq(block_number, user_block_index);
-        }
-        else
-        {
-            status = E_EEPROM_XMC1_lHandleWriteReq(block_number, data_buffer_ptr);
-        }
-        if (status != 0U)
-        {
-            status = (uint32_t)E_EEPROM_XMC1_OPERATION_STATUS_FAILURE;
+            /* Mark the block as inconsistent */
+            cache_ptr->status.consistent = 0U;
+            if (req_ptr[indx].invalidate == 1U)
+            {
+                cache_ptr->status.valid = 0U;
+            }
+            else
+            {
+                cache_ptr->status.valid = 1U;
+            }
         }
+        data_ptr->live_flash_blocks += E_EEPROM_XMC1_lGetEntryLiveBlocks(handle_ptr, data_ptr, block_index);
+        block_addr = block_end_addr;
     }
-    return (status);
+
+    data_ptr->next_free_block_addr = failed_end_addr;
 }
 
 /*******************************************************************************
@@ -2820,6 +6823,8 @@ static uint32_t E_EEPROM_XMC1_lLocalWrite( uint8_t block_number,
  * Handle function to write one complete data block into flash.
  *
  * Parameters:
+ * handle_ptr - Pointer to the handle of the instance
+ * data_ptr - State of the region the request operates on
  * block_number   - User block number / ID
  * data_buffer_ptr - Data buffer address
  *
@@ -2827,20 +6832,18 @@ static uint32_t E_EEPROM_XMC1_lLocalWrite( uint8_t block_number,
  * uint32_t - Flash NVM_STATUS register value
  *
  *******************************************************************************/
-static uint32_t E_EEPROM_XMC1_lHandleWriteReq(uint8_t block_number, uint8_t* data_buffer_ptr)
+static uint32_t E_EEPROM_XMC1_lHandleWriteReq(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr,
+        uint8_t block_number, uint8_t* data_buffer_ptr)
 {
     uint32_t block_size;
     uint32_t user_block_index;
     uint32_t status;
-    E_EEPROM_XMC1_DATA_t *data_ptr;
     E_EEPROM_XMC1_BLOCK_t *block_ptr;
 
-    data_ptr = (E_EEPROM_XMC1_DATA_t*)(void*)(e_eeprom_xmc1_handle->data_ptr);
-
-
-    user_block_index = E_EEPROM_XMC1_lGetUsrBlockIndex(block_number);
-    block_ptr = e_eeprom_xmc1_handle->block_config_ptr + user_block_index;
+    user_block_index = E_EEPROM_XMC1_lGetUsrBlockIndex(handle_ptr, block_number);
+    block_ptr = handle_ptr->block_config_ptr + user_block_index;
     block_size = block_ptr->size;
+    data_ptr->live_flash_blocks -= E_EEPROM_XMC1_lGetEntryLiveBlocks(handle_ptr, data_ptr, user_block_index);
     data_ptr->user_write_bytes_count = 0U;
     data_ptr->user_write_state = E_EEPROM_XMC1_FIRST_BLOCK_WRITE;
     status = 0U;
@@ -2849,22 +6852,22 @@ static uint32_t E_EEPROM_XMC1_lHandleWriteReq(uint8_t block_number, uint8_t* dat
         switch (data_ptr->user_write_state)
         {
         case E_EEPROM_XMC1_NEXT_BLOCK_WRITE:
-            status = E_EEPROM_XMC1_lWriteDataBlock();
+            status = E_EEPROM_XMC1_lWriteDataBlock(data_ptr);
             if (status == (uint32_t)0U)
             {
-                E_EEPROM_XMC1_lPopulateNextBlock(block_number,data_buffer_ptr,block_size);
+                E_EEPROM_XMC1_lPopulateNextBlock(data_ptr, block_number,data_buffer_ptr,block_size);
             }
             break;
 
         case E_EEPROM_XMC1_LAST_BLOCK_WRITE:
-            status = E_EEPROM_XMC1_lWriteDataBlock();
+            status = E_EEPROM_XMC1_lWriteDataBlock(data_ptr);
             if (status == (uint32_t)0U)
             {
                 /* Mark the block as inconsistent */
                 data_ptr->block_info[user_block_index].address = data_ptr->next_free_block_addr;
                 data_ptr->block_info[user_block_index].status.valid = 1U;
                 data_ptr->block_info[user_block_index].status.consistent = 1U;
-                if (e_eeprom_xmc1_handle->data_block_crc ==1U)
+                if (handle_ptr->data_block_crc ==1U)
                 {
                     /* Updated Cache table Block Header status as CRC enabled block*/
                     data_ptr->block_info[user_block_index].status.crc = 1U;
@@ -2880,7 +6883,8 @@ static uint32_t E_EEPROM_XMC1_lHandleWriteReq(uint8_t block_number, uint8_t* dat
             break;
 
         default:
-            E_EEPROM_XMC1_lPopulateFirstBlock(block_number,data_buffer_ptr,block_size); /* E_EEPROM_XMC1_FIRST_BLOCK_WRITE*/
+            E_EEPROM_XMC1_lPopulateFirstBlock(handle_ptr, data_ptr,
+                    block_number,data_buffer_ptr,block_size); /* E_EEPROM_XMC1_FIRST_BLOCK_WRITE*/
             break;
         }
     } while ( (status == 0U) && (data_ptr->user_write_state != E_EEPROM_XMC1_BLOCK_WRITE_IDLE) );
@@ -2892,6 +6896,7 @@ static uint32_t E_EEPROM_XMC1_lHandleWriteReq(uint8_t block_number, uint8_t* dat
         data_ptr->block_info[user_block_index].status.valid = 1U;
         data_ptr->block_info[user_block_index].status.consistent = 0U;
     }
+    data_ptr->live_flash_blocks += E_EEPROM_XMC1_lGetEntryLiveBlocks(handle_ptr, data_ptr, user_block_index);
     return (status);
 }
 
@@ -2902,6 +6907,8 @@ static uint32_t E_EEPROM_XMC1_lHandleWriteReq(uint8_t block_number, uint8_t* dat
  * Write one block with all data element as 0xFF to invalidate a block.
  *
  * Parameters:
+ * handle_ptr - Pointer to the handle of the instance
+ * data_ptr - State of the region the request operates on
  * block_number - User block number / ID
  * user_block_index  - Index of the logical block
  *
@@ -2909,25 +6916,17 @@ static uint32_t E_EEPROM_XMC1_lHandleWriteReq(uint8_t block_number, uint8_t* dat
  * uint32_t - Flash NVM_STATUS register value
  *
  *******************************************************************************/
-static uint32_t E_EEPROM_XMC1_lHandleInvalidReq(uint8_t block_number, uint32_t  user_block_index)
+static uint32_t E_EEPROM_XMC1_lHandleInvalidReq(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr,
+        uint8_t block_number, uint32_t  user_block_index)
 {
     uint32_t status;
-    uint32_t data_byte_count;
-    uint8_t* read_write_buffer_ptr;
-    E_EEPROM_XMC1_DATA_t *data_ptr;
-
-    data_ptr = (E_EEPROM_XMC1_DATA_t*)(void*)(e_eeprom_xmc1_handle->data_ptr);
-    read_write_buffer_ptr = data_ptr->read_write_buffer;
-    *read_write_buffer_ptr = block_number;
-    *(read_write_buffer_ptr + 1U) = (E_EEPROM_XMC1_START_BIT);
 
+    E_EEPROM_XMC1_lPopulateInvalidBlock(data_ptr, block_number);
 
-    for (data_byte_count = E_EEPROM_XMC1_TWO_BYTES;data_byte_count < E_EEPROM_XMC1_FLASH_BLOCK_SIZE;data_byte_count++)
-    {
-        *((uint8_t *)(void *)(read_write_buffer_ptr + data_byte_count)) = E_EEPROM_XMC1_8BIT_ALL_ONE;
-    }
+    /* The block is not live after the invalidation, whether the write succeeds or not */
+    data_ptr->live_flash_blocks -= E_EEPROM_XMC1_lGetEntryLiveBlocks(handle_ptr, data_ptr, user_block_index);
 
-    status = E_EEPROM_XMC1_lWriteDataBlock();
+    status = E_EEPROM_XMC1_lWriteDataBlock(data_ptr);
 
     if (status == 0U)
     {
@@ -2945,6 +6944,36 @@ static uint32_t E_EEPROM_XMC1_lHandleInvalidReq(uint8_t block_number, uint32_t
     return (status);
 }
 
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lPopulateInvalidBlock
+ ********************************************************************************
+ * Summary:
+ * Populates the read/write buffer with the block which invalidates a user data
+ * block: header with start bit only, all data elements as 0xFF.
+ *
+ * Parameters:
+ * data_ptr - State of the region the request operates on
+ * block_number - User block number / ID
+ *
+ * Return:
+ * void
+ *
+ *******************************************************************************/
+static void E_EEPROM_XMC1_lPopulateInvalidBlock(E_EEPROM_XMC1_DATA_t *const data_ptr, uint8_t block_number)
+{
+    uint32_t data_byte_count;
+    uint8_t* read_write_buffer_ptr;
+
+    read_write_buffer_ptr = data_ptr->read_write_buffer;
+    *read_write_buffer_ptr = block_number;
+    *(read_write_buffer_ptr + 1U) = (E_EEPROM_XMC1_START_BIT);
+
+    for (data_byte_count = E_EEPROM_XMC1_TWO_BYTES;data_byte_count < E_EEPROM_XMC1_FLASH_BLOCK_SIZE;data_byte_count++)
+    {
+        *((uint8_t *)(void *)(read_write_buffer_ptr + data_byte_count)) = E_EEPROM_XMC1_8BIT_ALL_ONE;
+    }
+}
+
 /*******************************************************************************
  * Function Name: E_EEPROM_XMC1_lPopulateFirstBlock
  ********************************************************************************
@@ -2953,6 +6982,8 @@ static uint32_t E_EEPROM_XMC1_lHandleInvalidReq(uint8_t block_number, uint32_t
  * buffer address.
  *
  * Parameters:
+ * handle_ptr - Pointer to the handle of the instance
+ * data_ptr - State of the region the request operates on
  * block_number   - User block number / ID
  * data_buffer_ptr - Data buffer address
  * block_size - Length of data to be read
@@ -2961,7 +6992,8 @@ static uint32_t E_EEPROM_XMC1_lHandleInvalidReq(uint8_t block_number, uint32_t
  * void
  *
  *******************************************************************************/
-static void E_EEPROM_XMC1_lPopulateFirstBlock(uint8_t block_number,
+static void E_EEPROM_XMC1_lPopulateFirstBlock(E_EEPROM_XMC1_t *const handle_ptr, E_EEPROM_XMC1_DATA_t *const data_ptr,
+        uint8_t block_number,
         uint8_t* user_data_buffer_ptr,
         uint32_t block_size)
 {
@@ -2969,18 +7001,17 @@ static void E_EEPROM_XMC1_lPopulateFirstBlock(uint8_t block_number,
     uint32_t crc_buffer;
     uint32_t data_byte_count;
     uint8_t* read_write_buffer_ptr;
-    E_EEPROM_XMC1_DATA_t *data_ptr;
 
-    data_ptr = (E_EEPROM_XMC1_DATA_t*)(void*)(e_eeprom_xmc1_handle->data_ptr);
     read_write_buffer_ptr = data_ptr->read_write_buffer;
     data_ptr->user_write_state = E_EEPROM_XMC1_NEXT_BLOCK_WRITE;
 
 #ifdef E_EEPROM_XMC1_CRC_SW_ENABLED
     /* IF Block CRC is enabled then update the block Header with 16 bit CRC calculated from the data buffer*/
-    CRC_SW_CalculateCRC(e_eeprom_xmc1_handle->crc_handle_ptr,user_data_buffer_ptr,block_size);
-    crc_buffer = CRC_SW_GetCRCResult(e_eeprom_xmc1_handle->crc_handle_ptr);
+    CRC_SW_CalculateCRC(handle_ptr->crc_handle_ptr,user_data_buffer_ptr,block_size);
+    crc_buffer = CRC_SW_GetCRCResult(handle_ptr->crc_handle_ptr);
     crc_bit = E_EEPROM_XMC1_CRC_BIT;
 #else
+    (void)handle_ptr;
     crc_buffer = E_EEPROM_XMC1_DUMMY_CRC;
     crc_bit = 0U;
 #endif
@@ -3021,6 +7052,7 @@ static void E_EEPROM_XMC1_lPopulateFirstBlock(uint8_t block_number,
  * buffer address.
  *
  * Parameters:
+ * data_ptr - State of the region the request operates on
  * block_number   - User block number / ID
  * data_buffer_ptr - Data buffer address
  * block_size - Length of data to be read
@@ -3029,14 +7061,12 @@ static void E_EEPROM_XMC1_lPopulateFirstBlock(uint8_t block_number,
  * void
  *
  *******************************************************************************/
-static void E_EEPROM_XMC1_lPopulateNextBlock( uint8_t block_number ,
+static void E_EEPROM_XMC1_lPopulateNextBlock(E_EEPROM_XMC1_DATA_t *const data_ptr, uint8_t block_number ,
         uint8_t*  const user_data_buffer_ptr ,
         uint32_t block_size)
 {
     uint32_t  data_byte_count;
     uint8_t*  read_write_buffer_ptr;
-    E_EEPROM_XMC1_DATA_t *data_ptr;
-    data_ptr = (E_EEPROM_XMC1_DATA_t*)(void*)(e_eeprom_xmc1_handle->data_ptr);
 
     read_write_buffer_ptr = data_ptr->read_write_buffer;
     *(read_write_buffer_ptr) = block_number;
@@ -3073,19 +7103,16 @@ static void E_EEPROM_XMC1_lPopulateNextBlock( uint8_t block_number ,
  * Writes single data block into flash
  *
  * Parameters:
- * void
+ * data_ptr - State of the region the request operates on
  *
  * Return:
  * uint32_t - NVM_STATUS register value after read operation
  *
  *******************************************************************************/
-static uint32_t E_EEPROM_XMC1_lWriteDataBlock(void)
+static uint32_t E_EEPROM_XMC1_lWriteDataBlock(E_EEPROM_XMC1_DATA_t *const data_ptr)
 {
     uint32_t status;
     uint32_t src_addr;
-    E_EEPROM_XMC1_DATA_t *data_ptr;
-
-    data_ptr = (E_EEPROM_XMC1_DATA_t*)(void*)(e_eeprom_xmc1_handle->data_ptr);
 
     src_addr = (uint32_t)(data_ptr->next_free_block_addr +
             (data_ptr->written_block_counter * E_EEPROM_XMC1_FLASH_BLOCK_SIZE));
@@ -3106,6 +7133,7 @@ static uint32_t E_EEPROM_XMC1_lWriteDataBlock(void)
  * Read number of bytes as specified in the length parameter.
  *
  * Parameters:
+ * data_ptr - State of the region the request operates on
  * data_buffer_ptr - Data buffer address
  * length - Length of data to be read
  * offset - Offset from which the read shall start
@@ -3114,21 +7142,20 @@ static uint32_t E_EEPROM_XMC1_lWriteDataBlock(void)
  * E_EEPROM_XMC1_STATUS_t
  *
  *******************************************************************************/
-static uint32_t E_EEPROM_XMC1_lReadBlockContents(uint8_t *const data_buffer_ptr, uint32_t length, uint32_t offset)
+static uint32_t E_EEPROM_XMC1_lReadBlockContents(E_EEPROM_XMC1_DATA_t *const data_ptr, uint8_t *const data_buffer_ptr,
+        uint32_t length, uint32_t offset)
 {
     uint32_t indx;
     uint32_t status;
     uint32_t block_count;
     uint32_t flash_address;
     uint32_t block_start_address;
-    E_EEPROM_XMC1_DATA_t *data_ptr;
     uint32_t remaining_bytes_in_curr_block;
 
     indx = 0U;
     status = 0U;
     block_count = 0U;
 
-    data_ptr = (E_EEPROM_XMC1_DATA_t*)(void*)(e_eeprom_xmc1_handle->data_ptr);
     block_start_address = data_ptr->read_start_address;
 
     if (offset >= E_EEPROM_XMC1_BLOCK1_DATA_SIZE)  /* Check if the offset does'nt fit in the first data block.  */
@@ -3203,6 +7230,8 @@ static uint32_t E_EEPROM_XMC1_lReadBlockContents(uint8_t *const data_buffer_ptr,
  * value.
  *
  * Parameters:
+ * handle_ptr - Pointer to the handle of the instance
+ * data_ptr - State of the region the request operates on
  * block_number   - User block number / ID
  * data_buffer_ptr - Data buffer address
  * block_size    - size in bytes of logical block
@@ -3212,20 +7241,19 @@ static uint32_t E_EEPROM_XMC1_lReadBlockContents(uint8_t *const data_buffer_ptr,
  * E_EEPROM_XMC1_OPERATION_STATUS_CRC_FAILED : CRC verification failed
  *
  *******************************************************************************/
-static E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_lReadBlockCrcStatus( uint8_t block_number,
+static E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_lReadBlockCrcStatus(E_EEPROM_XMC1_t *const handle_ptr,
+        E_EEPROM_XMC1_DATA_t *const data_ptr, uint8_t block_number,
         uint8_t *const data_buffer_ptr,
         uint32_t block_size)
 {
     uint32_t crc_buffer;
     uint32_t block_index;
     uint32_t crc_read_from_flash;
-    E_EEPROM_XMC1_DATA_t *data_ptr;
     E_EEPROM_XMC1_OPERATION_STATUS_t status;
 
-    data_ptr = (E_EEPROM_XMC1_DATA_t*)(void*)(e_eeprom_xmc1_handle->data_ptr);
     crc_buffer = E_EEPROM_XMC1_DUMMY_CRC;
     status = E_EEPROM_XMC1_OPERATION_STATUS_SUCCESS;
-    block_index = E_EEPROM_XMC1_lGetUsrBlockIndex(block_number);
+    block_index = E_EEPROM_XMC1_lGetUsrBlockIndex(handle_ptr, block_number);
 
     /* Clear all error status flags before flash operation*/
     XMC_FLASH_ClearStatus();
@@ -3237,8 +7265,8 @@ static E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_lReadBlockCrcStatus( uint8
     if (data_ptr->block_info[block_index].status.crc == 1U)
     {
         /* IF Block CRC is enabled then update the block Header with 16 bit CRC calculated from the data buffer*/
-        CRC_SW_CalculateCRC(e_eeprom_xmc1_handle->crc_handle_ptr,data_buffer_ptr,block_size);
-        crc_buffer = CRC_SW_GetCRCResult(e_eeprom_xmc1_handle->crc_handle_ptr);
+        CRC_SW_CalculateCRC(handle_ptr->crc_handle_ptr,data_buffer_ptr,block_size);
+        crc_buffer = CRC_SW_GetCRCResult(handle_ptr->crc_handle_ptr);
         /* Check the validity of CRC for the particular block */
         if (crc_buffer != (crc_read_from_flash >> E_EEPROM_XMC1_CRC_SHIFT))
         {
@@ -3311,6 +7339,75 @@ static void E_EEPROM_XMC1_lReadSingleBlock(uint32_t const address, uint32_t *con
     }
 }
 
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lWriteBlocks
+ ********************************************************************************
+ * Summary:
+ * Performs flash write operation of consecutive blocks(16 bytes each) within
+ * one page
+ *
+ * Parameters:
+ * address  - Flash address
+ * data    - Pointer to Data buffer address
+ * num_blocks - Number of blocks to be written
+ *
+ * Return:
+ * void
+ *
+ *******************************************************************************/
+static void E_EEPROM_XMC1_lWriteBlocks(uint32_t const address, const uint32_t *const data, uint32_t num_blocks)
+{
+#ifdef E_EEPROM_XMC1_TEST_HOOK_ENABLE
+    uint32_t indx;
+    if (e_eeprom_xmc1_test_hook_writeblock == 1U)
+    {
+        for (indx = 0U; indx < num_blocks; indx++)
+        {
+            E_EEPROM_XMC1_TEST_HOOK_WriteSingleBlock(address + (indx * E_EEPROM_XMC1_FLASH_BLOCK_SIZE),
+                    data + (indx * E_EEPROM_XMC1_MAX_WORDS_IN_BLOCK));
+        }
+    }
+    else
+#endif
+    {
+        XMC_FLASH_WriteBlocks( (uint32_t*)address, (uint32_t*)data , num_blocks , 1U);
+    }
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC1_lReadBlocks
+ ********************************************************************************
+ * Summary:
+ * Performs flash read operation of consecutive blocks(16 bytes each)
+ *
+ * Parameters:
+ * address  - Flash address
+ * data    - Pointer to Data buffer address
+ * num_blocks - Number of blocks to be read
+ *
+ * Return:
+ * void
+ *
+ *******************************************************************************/
+static void E_EEPROM_XMC1_lReadBlocks(uint32_t const address, uint32_t *const data, uint32_t num_blocks)
+{
+#ifdef E_EEPROM_XMC1_TEST_HOOK_ENABLE
+    uint32_t indx;
+    if (e_eeprom_xmc1_test_hook_readblock == 1U)
+    {
+        for (indx = 0U; indx < num_blocks; indx++)
+        {
+            E_EEPROM_XMC1_TEST_HOOK_ReadSingleBlock(address + (indx * E_EEPROM_XMC1_FLASH_BLOCK_SIZE),
+                    data + (indx * E_EEPROM_XMC1_MAX_WORDS_IN_BLOCK));
+        }
+    }
+    else
+#endif
+    {
+        XMC_FLASH_ReadBlocks( (uint32_t*)address , (uint32_t*)data , num_blocks);
+    }
+}
+
 /*******************************************************************************
  * Function Name: E_EEPROM_XMC1_lWriteSinglePage
  ********************************************************************************
@@ -58,6 +58,45 @@
 *
 * 2022-03-02:
 *     - Adapted for use with mtb-xmc-emeeprom asset
+*
+* 2026-10-16:
+*     - Added E_EEPROM_XMC1_GcStep API to execute the garbage collection in
+*     steps with a bounded number of flash operations
+*     - Added erase_ahead configuration to defer the erase of the previous bank
+*     after garbage collection
+*     - Garbage collection copies the data blocks with one flash write per
+*     destination page
+*     - Garbage collection writes a checkpoint index of the copied blocks into
+*     the marker page, initialization scans only the blocks written after it
+*     - Initialization locates the end of the written blocks with a binary search
+*     - Added lazy_mount configuration and E_EEPROM_XMC1_MountStep API to
+*     update the cache entries on the first access to each block
+*     - Added E_EEPROM_XMC1_WARM_RESET_ENABLED option to reuse the run time
+*     state kept in no-init RAM after a warm reset
+*     - Added E_EEPROM_XMC1_WriteMulti API to write/invalidate several blocks
+*     with one space reservation and page wise programming
+*     - Added skip_unchanged configuration to skip writes of unchanged data
+*     - Added bank0_base and bank_size configuration to place the banks of an
+*     instance, added E_EEPROM_XMC1_<API>Ex variants taking the handle to use
+*     several independent instances
+*     - The APIs without handle operate on the instance of the last
+*     E_EEPROM_XMC1_Init(), the Ex APIs use only the state of their handle
+*     - Added bank_count configuration to organize an instance as a rotating log
+*     of 3 or more segments, garbage collection reclaims a single segment,
+*     initialization fails if a block does not fit into one segment
+*     - Added a temperature class per block and cold_data_ptr/cold_bank_size
+*     configuration to keep cold blocks in a region with its own banks and
+*     garbage collection
+*     - Garbage collection drops the invalidated blocks, such a block then reads
+*     as never written
+*     - Added a running count of the live flash blocks and E_EEPROM_XMC1_GetSpaceInfo
+*     API to report the free, live, dead and expected free space after a garbage
+*     collection
+*     - Added gc_low_watermark, gc_high_watermark and gc_emergency_level
+*     configuration and E_EEPROM_XMC1_Idle API to collect garbage in idle time
+*     - Added emergency_reserve_size configuration and E_EEPROM_XMC1_EmergencyWrite
+*     API to write a block into a reserve of each bank without garbage collection,
+*     initialization fails if the reserve exceeds the capacity of a region
 *****************************************************************************/
 
 #ifndef E_EEPROM_XMC1_H
@@ -262,6 +301,22 @@
 * 
 *   const uint8_t  garbage_collection; // **< Enables garbage collection when no space available for new write*
 * 
+*   const uint8_t  erase_ahead; // **< Defers the erase of the previous bank after garbage collection *
+* 
+*   const uint8_t  lazy_mount; // **< Updates the cache entry of a block on its first access *
+* 
+*   const uint8_t  skip_unchanged; // **< Skips writes of unchanged data *
+* 
+*   const uint32_t bank0_base; // **< Start address of bank 0, 0 selects the end of flash *
+* 
+*   const uint32_t bank_size; // **< Size of one bank, 0 selects E_EEPROM_XMC1_FLASH_BANK_SIZE *
+* 
+*   const uint8_t  bank_count; // **< Number of banks, 0 or 2 selects two banks, 3 or more a rotating log *
+* 
+*   E_EEPROM_XMC1_DATA_t *const cold_data_ptr; // **< State of the cold region, NULL keeps all blocks in one region *
+* 
+*   const uint32_t cold_bank_size; // **< Size of one bank of the cold region, 0 selects the size of the banks *
+* 
 * } E_EEPROM_XMC1_t;
 * 
 * The application should decide the number of blocks that are needed
@@ -270,7 +325,7 @@
 * block_count supported is 10.
 *
 * The first array block_config_ptr[block_count] is the configuration information
-* of "block number" and "size" for each block in EEPROM. Note the Size of EEPROM
+* of "block number", "size" and "temperature" for each block in EEPROM. Note the Size of EEPROM
 * (E_EEPROM_XMC1_FLASH_EEPROM_SIZE) provided by Personality/Define via Makefile
 * should definitely be much larger than the sum of All the block sizes defined
 * in this configuration data structure. Giving a much larger value will
@@ -298,12 +353,155 @@
 * collection, then they have to explicitly check in run time code, whether
 * garbage collection is needed and explicitly call it.
 * 
+* The garbage collection copies the latest copy of each valid block only.
+* Blocks which were not written properly are left behind, invalidated blocks
+* are dropped and read as never written afterwards.
+* 
+* The configuration parameter: erase_ahead, when set to 1, completes the
+* garbage collection as soon as the new bank is marked valid. The previous bank
+* is then erased one page per successful write/invalidate request or per
+* operation of E_EEPROM_XMC1_GcStep(). This spreads the bank erase time over
+* several requests instead of a single one. After a reset the erase continues
+* with the pages which are not yet erased. The next garbage collection first
+* completes a pending erase.
+* 
+* The configuration parameter: lazy_mount, when set to 1, shortens the
+* initialization after a normal reset to the search of the free space in the
+* valid bank. The latest copy of a block is searched in flash on the first
+* Read/Write/Invalidate/GetPreviousData/VerifyBlockCrcStatus request for that
+* block, which is then slower by this search. E_EEPROM_XMC1_MountStep() can be
+* called in idle time to search the remaining blocks. A garbage collection
+* searches all remaining blocks before the copy. If the initialization has to
+* recover an interrupted garbage collection, all blocks are searched as usual.
+* 
+* The configuration parameter: skip_unchanged, when set to 1, makes
+* E_EEPROM_XMC1_Write() compare the data with the latest copy in flash first.
+* If it is equal, nothing is programmed and
+* E_EEPROM_XMC1_OPERATION_STATUS_UNCHANGED is returned. For blocks with CRC, a
+* different CRC detects a change without reading the data. The skipped writes
+* are counted in elided_write_count and elided_flash_blocks of
+* E_EEPROM_XMC1_DATA_t. E_EEPROM_XMC1_WriteMulti() always writes.
+* 
+* Warm reset: if E_EEPROM_XMC1_WARM_RESET_ENABLED is defined via Makefile, the
+* run time state is sealed with a generation counter and a checksum after each
+* completed request. The E_EEPROM_XMC1_DATA_t variable and the cache table must
+* then be placed in no-init RAM, e.g.
+* E_EEPROM_XMC1_CACHE_t cache[N] E_EEPROM_XMC1_NOINIT;
+* E_EEPROM_XMC1_DATA_t data E_EEPROM_XMC1_NOINIT;
+* and data.block_info is assigned before E_EEPROM_XMC1_Init() is called.
+* After a watchdog or software reset the initialization checks the seal and
+* takes the state as it is, without reading the flash. If the seal does not
+* match, e.g. after power on, a reset during a flash operation, a paused garbage
+* collection or a changed configuration, the flash is evaluated as usual. The
+* option must not be used if the emulation area is modified by other means
+* without a power on reset.
+* 
+* The configuration parameters: bank0_base and bank_size, place the two banks
+* of the instance. Bank 1 directly follows bank 0, both have bank_size bytes
+* including the marker page. bank_size must be a multiple of the flash page size
+* and at least two pages; bank0_base must be page aligned. If bank_size is 0,
+* E_EEPROM_XMC1_FLASH_BANK_SIZE is used. If bank0_base is 0, the banks are
+* placed at the very end of flash. Both 0 gives the same layout as before.
+* 
+* The configuration parameter: bank_count, when set to 3 up to
+* E_EEPROM_XMC1_MAX_BANK_COUNT, organizes the instance as a rotating log of
+* bank_count segments of bank_size bytes each, placed one after the other from
+* bank0_base (bank0_base 0 places them at the very end of flash). The blocks are
+* written into the newest segment. When it is full, the next erased segment is
+* opened and one erased segment is always kept in reserve. If the reserve is
+* used, the garbage collection reclaims one older segment: only the latest
+* copies of the blocks residing in it are copied into the new segment, then the
+* segment is erased. The other segments stay untouched, hence the time of a
+* garbage collection depends on the segment size and not on the total size.
+* The segment to be reclaimed is selected with a cost-benefit policy: the free
+* space gained, weighted by the age of the segment, against the copy cost.
+* Segments holding rarely updated blocks are therefore seldom copied. The
+* erase_ahead, lazy_mount options and the checkpoint index apply to two banks
+* only and are not used with a rotating log. E_EEPROM_XMC1_GetPreviousData()
+* searches the segment of the latest copy only. The flash layout differs from
+* the two-bank layout, changing bank_count requires an erased emulation area.
+* 
+* Temperature classes: each block has a temperature, E_EEPROM_XMC1_BLOCK_HOT
+* (0, the default) or E_EEPROM_XMC1_BLOCK_COLD. If the configuration parameter
+* cold_data_ptr points to a second E_EEPROM_XMC1_DATA_t with its own cache table
+* of block_count entries, the cold blocks are kept in a separate region of two
+* banks of cold_bank_size bytes (0 selects the bank size of the hot region),
+* placed directly below the banks of the hot blocks. Each region has its own
+* free space and garbage collection: the garbage collection triggered by
+* frequently written hot blocks never copies the cold blocks again. The hot
+* region is configured by bank0_base, bank_size and bank_count as before, the
+* cold region always uses two banks. E_EEPROM_XMC1_StartGarbageCollection() and
+* E_EEPROM_XMC1_GcStep() operate on the hot region, except that a deferred erase
+* of the cold region (erase_ahead) is completed first. All requests of one
+* E_EEPROM_XMC1_WriteMulti() call must belong to the same class. The flash
+* reserved for the instance grows by the cold region; changing the class of a
+* block or cold_data_ptr requires an erased emulation area. With cold_data_ptr
+* NULL the temperature is ignored.
+*
+* Idle time garbage collection: the configuration parameters gc_low_watermark,
+* gc_high_watermark and gc_emergency_level are percentages of the data blocks
+* of one bank (segment). E_EEPROM_XMC1_Idle(max_operations) is called in idle
+* windows of the application. If the free space of a region is below
+* gc_low_watermark and a garbage collection lifts it to gc_low_watermark or
+* above, a garbage collection is started. Further garbage collections follow
+* while the free space is below gc_high_watermark and each one gains space. A
+* pending deferred erase (erase_ahead) is continued as well. At most
+* max_operations flash program/erase operations are executed per call, a
+* garbage collection not completed is continued by the next call. A write,
+* invalidate or E_EEPROM_XMC1_StartGarbageCollection() request of the region
+* completes it first, hence requests are never rejected because of it, and
+* E_EEPROM_XMC1_GcStep() takes it over. With garbage_collection enabled, a
+* write request below gc_emergency_level executes a garbage collection before
+* the write even if the block still fits, 0 keeps the garbage collection for
+* the case the block does not fit. gc_low_watermark 0 disables
+* E_EEPROM_XMC1_Idle().
+*
+* Emergency reserve: with emergency_reserve_size configured, the physical
+* blocks of a user block of that size are kept free at the end of the current
+* bank (segment) of each region. Write, invalidate and multi write requests
+* reserve their blocks in addition and collect garbage, or return
+* E_EEPROM_XMC1_OPERATION_STATUS_MEMORY_BANK_FULL, before they would take the
+* reserve. E_EEPROM_XMC1_EmergencyWrite() may use the reserve, e.g. to save a
+* state block on a supply drop: it never executes a garbage collection or erase
+* and programs only the physical blocks of the block. It is accepted while a
+* garbage collection is paused by E_EEPROM_XMC1_GcStep() or E_EEPROM_XMC1_Idle()
+* before or after its block copy, and rejected with
+* E_EEPROM_XMC1_OPERATION_STATUS_NOT_ALLOWED while paused in the block copy
+* (reported in phase E_EEPROM_XMC1_GC_PHASE_COPY or
+* E_EEPROM_XMC1_GC_PHASE_SWITCH). The step budget of these APIs is kept, so an
+* application that has to save a block in a brownout window must complete the
+* copy before, by calling E_EEPROM_XMC1_GcStep() until the phase is
+* E_EEPROM_XMC1_GC_PHASE_ERASE or E_EEPROM_XMC1_GC_PHASE_IDLE. The next
+* garbage collection replenishes the reserve. The reserve reduces the capacity of each region:
+* E_EEPROM_XMC1_Init() fails unless the latest copies of all blocks of a
+* region, one more copy of the largest block and the reserve fit into the
+* banks (segments) not kept free for the garbage collection, and unless each
+* block fits into one bank (segment) together with the reserve.
+*
+* Multiple instances: each instance has its own handle, E_EEPROM_XMC1_DATA_t,
+* cache table, block table and banks, e.g. a small bank pair for frequently
+* updated blocks and a large one for calibration blocks. A garbage collection of
+* one instance then never copies the blocks of the other one. The banks of the
+* instances must not overlap. Each instance is initialized with
+* E_EEPROM_XMC1_Init() and accessed with the E_EEPROM_XMC1_<API>Ex() variants
+* taking the handle as first parameter. The APIs without handle operate on the
+* instance of the last E_EEPROM_XMC1_Init(). The Ex APIs keep no state outside
+* the handle, so calls on one instance do not affect the other instances. The
+* APIs of different instances which modify the flash must still not interrupt
+* each other, e.g. from an interrupt and the main loop, as they share the flash
+* controller.
 *
 * Typical EEPROM asset API sequence can be: E_EEPROM_XMC1_Init(&E_EEPROM_XMC1_handle);
 * and then read/write APIs:
 * E_EEPROM_XMC1_Write(blockNum, data_wbuffer);
 * E_EEPROM_XMC1_Read(blockNum, 0U, data_rbuffer, block_size);
 * 
+* With two instances:
+* E_EEPROM_XMC1_Init(&hot_handle);
+* E_EEPROM_XMC1_Init(&cold_handle);
+* E_EEPROM_XMC1_WriteEx(&hot_handle, counterBlockNum, counter_buffer);
+* E_EEPROM_XMC1_ReadEx(&cold_handle, calibBlockNum, 0U, calib_buffer, calib_size);
+* 
 * 
 * 
 ********************************************************************************
@@ -388,6 +586,21 @@
 #define E_EEPROM_XMC1_FLASH_BLOCK_SIZE  (16U)
 #define E_EEPROM_XMC1_FLASH_PAGE_SIZE   (256U)
 
+/** Temperature classes of a user data block (temperature configuration) */
+#define E_EEPROM_XMC1_BLOCK_HOT         (0U)
+#define E_EEPROM_XMC1_BLOCK_COLD        (1U)
+
+/** Maximum number of segments of an instance organized as a rotating log (bank_count configuration) */
+#define E_EEPROM_XMC1_MAX_BANK_COUNT    (8U)
+
+/**
+ * Places a variable into RAM not initialized by the startup code. Used for the E_EEPROM_XMC1_DATA_t and cache
+ * table variables with E_EEPROM_XMC1_WARM_RESET_ENABLED. The section must be a NOLOAD section of the linker script.
+ */
+#ifndef E_EEPROM_XMC1_NOINIT
+#define E_EEPROM_XMC1_NOINIT __attribute__((section(".no_init")))
+#endif
+
 /*
  *  These are global variables used only for internal testing purpose.
  *  Application code shall not use these variables by enabling E_EEPROM_XMC1_TEST_HOOK_ENABLE macro definition.
@@ -434,9 +647,23 @@ typedef enum E_EEPROM_XMC1_OPERATION_STATUS
   E_EEPROM_XMC1_OPERATION_STATUS_NOT_ALLOWED        = 5U, /**< Operation not allowed to continue*/
   E_EEPROM_XMC1_OPERATION_STATUS_MEMORY_BANK_FULL   = 6U, /**< Write/Invalidate operation failed when bank has no space.
                                                              Call E_EEPROM_XMC1_StartGarbageCollection API to proceed */
-  E_EEPROM_XMC1_OPERATION_STATUS_NO_CRC_WRITTEN     = 7U  /**< Written block does not have CRC checksum enabled.*/
+  E_EEPROM_XMC1_OPERATION_STATUS_NO_CRC_WRITTEN     = 7U, /**< Written block does not have CRC checksum enabled.*/
+  E_EEPROM_XMC1_OPERATION_STATUS_UNCHANGED          = 8U  /**< Write skipped, the latest copy has the same data
+                                                             (skip_unchanged) */
 } E_EEPROM_XMC1_OPERATION_STATUS_t;
 
+/**
+ * Defines the phases of the garbage collection reported by E_EEPROM_XMC1_GcStep() API.
+ */
+typedef enum E_EEPROM_XMC1_GC_PHASE
+{
+  E_EEPROM_XMC1_GC_PHASE_IDLE   = 0U, /**< No garbage collection is pending */
+  E_EEPROM_XMC1_GC_PHASE_COPY   = 1U, /**< Latest copies of the data blocks are copied to the free bank */
+  E_EEPROM_XMC1_GC_PHASE_SWITCH = 2U, /**< Bank markers are updated to make the new bank active */
+  E_EEPROM_XMC1_GC_PHASE_ERASE  = 3U, /**< Previous bank is erased page by page */
+  E_EEPROM_XMC1_GC_PHASE_FAILED = 4U  /**< Garbage collection stopped due to internal flash errors */
+} E_EEPROM_XMC1_GC_PHASE_t;
+
 /**
  * @}
  */
@@ -456,9 +683,24 @@ typedef struct E_EEPROM_XMC1_BLOCK
 
   uint32_t size; /**< Size of the logical block */
 
+  uint8_t temperature; /**< E_EEPROM_XMC1_BLOCK_HOT or E_EEPROM_XMC1_BLOCK_COLD, selects the region of the block if
+                            cold_data_ptr is configured */
+
 } E_EEPROM_XMC1_BLOCK_t;
 
 
+/** Data structure to describe one request of E_EEPROM_XMC1_WriteMulti() */
+typedef struct E_EEPROM_XMC1_WRITE_REQ
+{
+  uint8_t block_number; /**< Logical block number (Block ID) */
+
+  uint8_t invalidate; /**< 1: the block is invalidated, data_buffer_ptr is not used. 0: the block is written */
+
+  uint8_t *data_buffer_ptr; /**< Pointer to the user data, the size of the logical block is written */
+
+} E_EEPROM_XMC1_WRITE_REQ_t;
+
+
 /** Data structure to hold the header information about a particular user data block */
 typedef struct E_EEPROM_XMC1_BLOCK_HEADER
 {
@@ -481,7 +723,9 @@ typedef struct E_EEPROM_XMC1_CACHE_STATUS
 
   uint32_t crc        : 1; /**< Indicates if the block is enabled with a valid 16 bit CRC */
 
-  uint32_t unused     : 28; /**< unused */
+  uint32_t resolved   : 1; /**< Indicates the cache entry is evaluated from flash (lazy mount) */
+
+  uint32_t unused     : 27; /**< unused */
 
 } E_EEPROM_XMC1_CACHE_STATUS_t;
 /*lint -e46 */
@@ -516,6 +760,17 @@ typedef struct E_EEPROM_XMC1_DATA
 
   uint32_t  current_bank;  /**< Stores the current Bank on which blocks write operation will be done */
 
+  uint32_t  bank0_base; /**< Start address of bank 0 of the instance, bank 1 follows it */
+
+  uint32_t  bank_size; /**< Size of one bank of the instance including the marker page */
+
+  uint32_t  bank_count; /**< Number of banks of the instance, 2 or the number of segments of the rotating log */
+
+  uint32_t  bank_seq[E_EEPROM_XMC1_MAX_BANK_COUNT]; /**< Sequence number of each segment of the rotating log, 0 if
+                                                        the segment is erased */
+
+  uint32_t  gc_victim_bank; /**< Segment of the rotating log reclaimed by the garbage collection */
+
   uint32_t  gc_dest_addr; /**< Destination address for copying data during GC */
 
   uint32_t  gc_src_addr; /**< Source address from which data needs to be copied during GC */
@@ -528,7 +783,8 @@ typedef struct E_EEPROM_XMC1_DATA
 
   uint32_t  curr_bank_src_addr; /**< Used for cache update and later stores the current Bank base address */
 
-  uint32_t  gc_block_counter; /**< Tracks number of flash blocks read/written during GC process */
+  uint32_t  gc_block_counter; /**< Tracks number of flash blocks read/written during GC process and number of
+                                    pages erased during the erase of the previous bank */
 
   uint32_t  written_block_counter; /**< Keeps track of the number of flash blocks written for an user data block */
 
@@ -538,6 +794,8 @@ typedef struct E_EEPROM_XMC1_DATA
 
   uint8_t   page_write_buffer[E_EEPROM_XMC1_FLASH_PAGE_SIZE]; /**< Internal buffer to load and store single page */
 
+  uint32_t  gc_copy_blocks; /**< Number of flash blocks held in the page buffer during GC copy process */
+
   uint32_t  user_write_bytes_count; /**< Keeps track of the number of bytes written */
 
   uint32_t  gc_state; /**< State variable to keep track of the current state of the garbage collection procedure */
@@ -554,6 +812,28 @@ typedef struct E_EEPROM_XMC1_DATA
 
   uint32_t  read_start_address; /**< Current flash starting address to read the data */
 
+  uint32_t  pending_erase_pages; /**< Number of pages of the previous bank to be erased in erase_ahead mode, plus one
+                                       for the formatted state marker. 0 if no erase is pending */
+
+  uint32_t  checkpoint_addr; /**< Flash address of the checkpoint of the valid bank after a lazy mount, 0 if no
+                                   checkpoint index is found */
+
+  uint32_t  elided_write_count; /**< Number of writes skipped since initialization because the data was unchanged */
+
+  uint32_t  elided_flash_blocks; /**< Number of physical flash blocks not programmed due to the skipped writes */
+
+  uint32_t  live_flash_blocks; /**< Number of physical flash blocks of the latest copies of the consistent and valid
+                                     blocks of the region, updated on each write, invalidate and garbage collection */
+
+  uint32_t  idle_gc_active; /**< 1 while E_EEPROM_XMC1_Idle() collects the region, from the low watermark up to the
+                                  high watermark. A paused garbage collection is then completed by the next write */
+
+#ifdef E_EEPROM_XMC1_WARM_RESET_ENABLED
+  uint32_t  warm_generation; /**< Incremented before each flash modification, invalidates the seal of the state */
+
+  uint32_t  warm_checksum; /**< Seal of the run time state, checked by the initialization after a warm reset */
+#endif
+
 } E_EEPROM_XMC1_DATA_t;
 
 
@@ -578,10 +858,79 @@ typedef struct E_EEPROM_XMC1
 
   const uint8_t  garbage_collection; /**< Enables garbage collection when no space available for new write*/
 
+  const uint8_t  erase_ahead; /**< Defers the erase of the previous bank after garbage collection. One page is erased
+                                   per write request or E_EEPROM_XMC1_GcStep() operation */
+
+  const uint8_t  lazy_mount; /**< Initialization finds only the free space, the cache entry of a block is updated on
+                                  its first access or by E_EEPROM_XMC1_MountStep() */
+
+  const uint8_t  skip_unchanged; /**< E_EEPROM_XMC1_Write() compares the data with the latest copy and skips the
+                                      write if it is unchanged */
+
+  const uint32_t bank0_base; /**< Page aligned start address of bank 0, bank 1 follows it. 0 places the banks at the
+                                  end of flash */
+
+  const uint32_t bank_size; /**< Size of one bank in bytes including the marker page, multiple of the page size.
+                                 0 selects E_EEPROM_XMC1_FLASH_BANK_SIZE */
+
+  const uint8_t  bank_count; /**< Number of banks. 0 or 2 selects the two-bank scheme, 3 up to
+                                  E_EEPROM_XMC1_MAX_BANK_COUNT a rotating log of segments of bank_size bytes */
+
+  E_EEPROM_XMC1_DATA_t *const cold_data_ptr; /**< State variable data structure of the region of the cold blocks.
+                                                  NULL keeps all blocks in one region */
+
+  const uint32_t cold_bank_size; /**< Size of one bank of the cold region in bytes including the marker page,
+                                      multiple of the page size. 0 selects the bank size of the hot region */
+
+  const uint8_t  gc_low_watermark; /**< Free space of a region in percent of the data blocks of a bank below which
+                                        E_EEPROM_XMC1_Idle() starts a garbage collection. 0 disables the policy */
+
+  const uint8_t  gc_high_watermark; /**< Free space in percent up to which E_EEPROM_XMC1_Idle() continues with
+                                         further garbage collections, not below gc_low_watermark */
+
+  const uint8_t  gc_emergency_level; /**< Free space in percent below which a write request executes a garbage
+                                          collection before the write. 0: only if the block does not fit */
+
+  const uint16_t emergency_reserve_size; /**< Size in bytes of a user block that E_EEPROM_XMC1_EmergencyWrite() can
+                                              always write, its flash blocks are kept free in each bank and reduce
+                                              the capacity of each region. 0: none */
+
 } E_EEPROM_XMC1_t;
 
 typedef E_EEPROM_XMC1_t* E_EEPROM_XMC1_HANDLE_PTR_t; /**< Defines a pointer to APP Handle*/
 
+/** Data structure to report the progress of a garbage collection executed with E_EEPROM_XMC1_GcStep() API */
+typedef struct E_EEPROM_XMC1_GC_PROGRESS
+{
+  E_EEPROM_XMC1_GC_PHASE_t phase; /**< Current phase of the garbage collection */
+
+  uint32_t copied_blocks; /**< Number of configured user data blocks handled by the copy phase */
+
+  uint32_t total_blocks; /**< Number of configured user data blocks */
+
+  uint32_t erased_pages; /**< Number of pages of the previous bank already erased */
+
+  uint32_t total_pages; /**< Number of pages per bank */
+
+} E_EEPROM_XMC1_GC_PROGRESS_t;
+
+/**
+ * Data structure to report the use of the flash space of a region by E_EEPROM_XMC1_GetSpaceInfo() API. All values
+ * are numbers of physical flash blocks of E_EEPROM_XMC1_FLASH_BLOCK_SIZE bytes.
+ */
+typedef struct E_EEPROM_XMC1_SPACE_INFO
+{
+  uint32_t free_blocks; /**< Blocks which can be written before a garbage collection is needed */
+
+  uint32_t live_blocks; /**< Blocks of the latest copies of the consistent and valid user data blocks */
+
+  uint32_t dead_blocks; /**< Written blocks which are not live: older copies, invalidated and inconsistent blocks and,
+                             in a rotating log, the unused end of the full segments */
+
+  uint32_t gc_free_blocks; /**< Expected free blocks after a garbage collection started now */
+
+} E_EEPROM_XMC1_SPACE_INFO_t;
+
 /**
  *@}
  */
@@ -624,6 +973,13 @@ extern "C"  {
  * </OL>
  * <b>IMPORTANT : </b> This API must be successfully called before calling any other E_EEPROM_XMC1 API.<BR>
  *
+ * <b>NOTE :</b><BR> The initialization fails if bank0_base/bank_size/bank_count of the handle, and cold_bank_size
+ *            with cold_data_ptr configured, do not describe banks inside the flash, or if a block does not fit into
+ *            one bank (segment) of its region together with the emergency reserve, or if the blocks of a region
+ *            with one more copy of the largest block and the reserve exceed the capacity of its banks (segments).
+ *            Several instances with separate banks can be initialized one after the other. The APIs without
+ *            handle then operate on the last initialized instance.
+ *
  */
  E_EEPROM_XMC1_STATUS_t E_EEPROM_XMC1_Init(E_EEPROM_XMC1_t *const handle_ptr);
 
@@ -638,6 +994,7 @@ extern "C"  {
  *    E_EEPROM_XMC1_OPERATION_STATUS_NOT_ALLOWED, if APP initialization is not completed or flash is busy<BR>
  *    E_EEPROM_XMC1_OPERATION_STATUS_MEMORY_BANK_FULL, if no space available in flash bank to write the block<BR>
  *    E_EEPROM_XMC1_OPERATION_STATUS_FAILURE, if write failed due to internal flash errors<BR>
+ *    E_EEPROM_XMC1_OPERATION_STATUS_UNCHANGED, if skip_unchanged is enabled and the latest copy has the same data<BR>
  *
  * \par<b>Description:</b><br>
  *  The requested data block is written into the flash immediately, only when free space is available in flash bank.
@@ -678,7 +1035,8 @@ extern "C"  {
  *
  * <b>IMPORTANT : </b> This API do not perform any CRC verification for the read data.
  *
- * <b>NOTE :</b><BR> If the flash is in busy state, the read will not be accepted.
+ * <b>NOTE :</b><BR> If the flash is in busy state, the read will not be accepted. Reads are accepted between the
+ *            steps of a garbage collection executed with E_EEPROM_XMC1_GcStep() API.
  *
  */
  E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_Read(uint8_t block_number,
@@ -703,6 +1061,53 @@ extern "C"  {
  */
  E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_StartGarbageCollection(void);
 
+ /**
+ * @brief Executes garbage collection in steps with a bounded number of flash operations.
+ * @param max_operations : Maximum number of flash program/erase operations executed by this call. Range [1 - ...]
+ * @param progress_ptr : Pointer to the structure updated with the progress of the garbage collection. Can be NULL.
+ * @return <BR>
+ *     E_EEPROM_XMC1_OPERATION_STATUS_SUCCESS, if the steps were executed successfully<BR>
+ *     E_EEPROM_XMC1_OPERATION_STATUS_NOT_ALLOWED, if APP initialization is not completed<BR>
+ *     E_EEPROM_XMC1_OPERATION_STATUS_FAILURE, if garbage collection failed due to internal flash errors<BR>
+ *
+ * \par<b>Description:</b><br>
+ *  Starts a garbage collection if none is pending, else continues the pending one. The state machine is advanced
+ *  until \a max_operations flash program/erase operations are executed or the garbage collection is completed.
+ *  One operation is a write of up to one page of blocks or a single page erase, a page erase being the longest
+ *  one. Flash reads are not counted. Hence the worst case execution time of a call is bounded and the garbage
+ *  collection can be spread over several idle slots of the application. The previous bank is erased page by page.
+ *  The garbage collection is completed when the phase reported in \a progress_ptr is E_EEPROM_XMC1_GC_PHASE_IDLE
+ *  or E_EEPROM_XMC1_GetStatus() returns E_EEPROM_XMC1_STATUS_IDLE.
+ *  If erase_ahead is enabled and an erase of the previous bank is pending, the call continues that erase instead
+ *  of starting a new garbage collection. The phase is reported as E_EEPROM_XMC1_GC_PHASE_ERASE while write
+ *  requests are already accepted.
+ *
+ * <b>NOTE :</b><BR> Until the garbage collection is completed, write and invalidate requests are not allowed.
+ *            E_EEPROM_XMC1_Read() API is accepted between the steps.
+ *            It is advised to start a garbage collection only if E_EEPROM_XMC1_IsGarbageCollectionNeeded() API
+ *            returns true.
+ *
+ */
+ E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_GcStep(uint32_t max_operations,
+                                                      E_EEPROM_XMC1_GC_PROGRESS_t *const progress_ptr);
+
+ /**
+ * @brief Searches the blocks not yet evaluated after a lazy initialization.
+ * @param max_blocks : Maximum number of blocks searched by this call. Range [0 - block_count]
+ * @param pending_ptr : Pointer to the number of blocks still to be searched after this call. Can be NULL.
+ * @return <BR>
+ *     E_EEPROM_XMC1_OPERATION_STATUS_SUCCESS, if the blocks were searched<BR>
+ *     E_EEPROM_XMC1_OPERATION_STATUS_NOT_ALLOWED, if APP initialization is not completed or flash is busy<BR>
+ *
+ * \par<b>Description:</b><br>
+ *  With lazy_mount enabled, E_EEPROM_XMC1_Init() does not search the latest copy of each block. The search is done
+ *  on the first access to the block. This API executes the search for up to \a max_blocks blocks not accessed yet,
+ *  hence the first access to these blocks is not delayed. Only flash reads are executed. The initialization is
+ *  complete when the value returned in \a pending_ptr is 0. Without lazy_mount the value is always 0.
+ *
+ */
+ E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_MountStep(uint32_t max_blocks, uint32_t *const pending_ptr);
+
  /**
  * @brief Invalidate the user defined data block that was written into the flash.
  * @param block_number : Block ID Name/Number configured in the block table
@@ -716,6 +1121,10 @@ extern "C"  {
  * \par<b>Description:</b><br>
  *  The invalidated block is written into the flash immediately, only when free space is available in flash bank.
  *  On non availability of space in active flash bank, the invalidate write gets delayed due to Garbage Collection.
+ *  The invalidated block is not copied by the next Garbage Collection (in a rotating log, once the oldest segment
+ *  holding the block is reclaimed), from then on the block reads as never written and
+ *  E_EEPROM_XMC1_Read() returns E_EEPROM_XMC1_OPERATION_STATUS_INCONSISTENT_BLOCK instead of
+ *  E_EEPROM_XMC1_OPERATION_STATUS_INVALID_BLOCK.
  * <b>IMPORTANT : </b> This API shall be called only after the successful completion of E_EEPROM_XMC1_Init() API.<BR>
  *              While flash programming operation is in progress, the flash array will be busy and no access to
  *              flash is possible. Hence all other critical functionalities shall be done prior to the execution
@@ -729,6 +1138,75 @@ extern "C"  {
  */
  E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_InvalidateBlock(uint8_t block_number);
 
+ /**
+ * @brief Writes and/or invalidates several user data blocks with one request.
+ * @param req_ptr : Pointer to an array of requests, each naming a block configured in the block table and either
+ *                  the data to be written or the invalidation of the block
+ * @param req_count : Number of requests in the array
+ *
+ * @return <BR>
+ *    E_EEPROM_XMC1_OPERATION_STATUS_SUCCESS, if all requests are written successfully<BR>
+ *    E_EEPROM_XMC1_OPERATION_STATUS_NOT_ALLOWED, if APP initialization is not completed, flash is busy or the
+ *    requests belong to different temperature classes<BR>
+ *    E_EEPROM_XMC1_OPERATION_STATUS_MEMORY_BANK_FULL, if no space available in flash bank to write the blocks<BR>
+ *    E_EEPROM_XMC1_OPERATION_STATUS_FAILURE, if write failed due to internal flash errors<BR>
+ *
+ * \par<b>Description:</b><br>
+ *  Has the same effect as calling E_EEPROM_XMC1_Write() or E_EEPROM_XMC1_InvalidateBlock() for each request in the
+ *  order of the array. The flash space of all requests is reserved first. If it is not available, at most one
+ *  garbage collection is executed, before the first block is written. The physical blocks of all requests are then
+ *  programmed one after the other with one flash write request per flash page, and the RAM look up table is updated
+ *  at the end.
+ *  If a flash error occurs, the blocks touched by the failed flash write request become inconsistent, the blocks
+ *  written before keep the new data and the blocks behind keep their previous data.
+ *  A reset during the programming leaves the same flash contents as a reset during a sequence of single writes.
+ *  If the requests do not fit into the bank even after one garbage collection, or garbage collection is disabled,
+ *  E_EEPROM_XMC1_OPERATION_STATUS_MEMORY_BANK_FULL is returned and no block is written. The requests can then be
+ *  split into several calls.
+ *
+ * <b>IMPORTANT : </b> This API shall be called only after the successful completion of E_EEPROM_XMC1_Init() API.<BR>
+ *              While flash programming operation is in progress, the flash array will be busy and no access to
+ *              flash is possible.
+ *
+ * <b>Related APIs : </b><BR>  E_EEPROM_XMC1_Write(), E_EEPROM_XMC1_InvalidateBlock()\n\n
+ *
+ */
+ E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_WriteMulti(const E_EEPROM_XMC1_WRITE_REQ_t *const req_ptr,
+                                                          uint32_t req_count);
+
+ /**
+ * @brief Programs a user defined data block into the flash using the emergency reserve, in bounded time.
+ * @param block_number : Block ID Name/Number configured in the block table. Use the names defined in
+ *                @ref E_EEPROM_XMC1_BLOCK_t configuration structure array.
+ * @param data_buffer_ptr : Pointer to the user data buffer which need to be stored in flash
+ *
+ * @return <BR>
+ *    E_EEPROM_XMC1_OPERATION_STATUS_SUCCESS, if the write operation is successful<BR>
+ *    E_EEPROM_XMC1_OPERATION_STATUS_NOT_ALLOWED, if APP initialization is not completed or a garbage collection of
+ *    the region is paused while copying the blocks<BR>
+ *    E_EEPROM_XMC1_OPERATION_STATUS_MEMORY_BANK_FULL, if the block does not fit into the current bank<BR>
+ *    E_EEPROM_XMC1_OPERATION_STATUS_FAILURE, if write failed due to internal flash errors<BR>
+ *
+ * \par<b>Description:</b><br>
+ *  Writes the block like E_EEPROM_XMC1_Write() into the free space of the current bank, including the emergency
+ *  reserve configured by emergency_reserve_size. A garbage collection, a deferred erase step or a comparison with
+ *  the latest copy is never executed. The flash operations are limited to the programming of the physical blocks of
+ *  the block, one 16 byte flash block each. A block not larger than emergency_reserve_size always fits after any
+ *  other write request returned successfully.
+ *
+ * <b>IMPORTANT : </b> This API shall be called only after the successful completion of E_EEPROM_XMC1_Init() API.<BR>
+ *
+ * <b>NOTE :</b><BR> A garbage collection paused by E_EEPROM_XMC1_GcStep() or E_EEPROM_XMC1_Idle() is not completed.
+ *            Before and after its block copy the block is written into the reserve of the current bank. While it
+ *            is paused in the block copy the request is rejected, the application has to call
+ *            E_EEPROM_XMC1_GcStep() until the phase is E_EEPROM_XMC1_GC_PHASE_ERASE or E_EEPROM_XMC1_GC_PHASE_IDLE
+ *            before a supply drop can occur.\n\n
+ *
+ * <b>Related APIs : </b><BR>  E_EEPROM_XMC1_Write()\n\n
+ *
+ */
+ E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_EmergencyWrite(uint8_t block_number, uint8_t *data_buffer_ptr);
+
 /**
  * @brief Checks the status of APP.
  * @param :
@@ -765,6 +1243,59 @@ extern "C"  {
  */
  bool E_EEPROM_XMC1_IsGarbageCollectionNeeded(uint8_t block_number);
 
+/**
+ * @brief Reports the free, live and dead flash space of the region of a data block.
+ * @param block_number : Block ID Name/Number configured in the block table. Selects the region of the block if
+ *                cold_data_ptr is configured.
+ * @param info_ptr : Pointer to the structure which receives the space information
+ *
+ * @return <BR>
+ *     E_EEPROM_XMC1_OPERATION_STATUS_SUCCESS, if the space information is reported<BR>
+ *     E_EEPROM_XMC1_OPERATION_STATUS_NOT_ALLOWED, if APP initialization is not completed or a garbage collection
+ *     of the region is in progress<BR>
+ *
+ * \par<b>Description:</b><br>
+ *  The number of live flash blocks is counted at run time, the free and dead blocks follow from the next free block
+ *  location, hence the API does not read the flash. With lazy_mount the blocks not yet searched are searched first.
+ *  With two banks a garbage collection copies the live blocks into the other bank, the expected free space is the
+ *  bank size less the live blocks. In a rotating log a garbage collection opens the next segment and, if it is the
+ *  last erased one, copies the live blocks of the segment selected for reclaim into it. The invalidated blocks of
+ *  that segment are counted as copied, hence the expected free space may be slightly below the actual one. A garbage
+ *  collection pays off if gc_free_blocks is clearly above free_blocks.
+ *
+ * <b>IMPORTANT : </b> This API shall be called only after the successful completion of E_EEPROM_XMC1_Init() API.<BR>
+ *
+ * <b>Related APIs : </b><BR>  E_EEPROM_XMC1_IsGarbageCollectionNeeded(), E_EEPROM_XMC1_StartGarbageCollection()\n\n
+ *
+ */
+ E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_GetSpaceInfo(uint8_t block_number,
+                                                             E_EEPROM_XMC1_SPACE_INFO_t *const info_ptr);
+
+/**
+ * @brief Executes the idle time garbage collection policy in a bounded number of flash operations.
+ * @param max_operations : Maximum number of flash program/erase operations, must not be 0
+ *
+ * @return <BR>
+ *     E_EEPROM_XMC1_OPERATION_STATUS_SUCCESS, if the policy is executed or nothing is to be done<BR>
+ *     E_EEPROM_XMC1_OPERATION_STATUS_FAILURE, if a garbage collection failed due to internal flash errors<BR>
+ *     E_EEPROM_XMC1_OPERATION_STATUS_NOT_ALLOWED, if APP initialization is not completed or gc_low_watermark is 0<BR>
+ *
+ * \par<b>Description:</b><br>
+ *  Continues a pending deferred erase or garbage collection, then starts a garbage collection of a region whose free
+ *  space is below gc_low_watermark, see the usage section. The region of the hot blocks is served first, the
+ *  remaining operations go to the region of the cold blocks. The time of a call is bounded by max_operations flash
+ *  operations, a block erase counts as one operation. Returns immediately if no region is below its watermark.
+ *
+ * <b>IMPORTANT : </b> This API shall be called only after the successful completion of E_EEPROM_XMC1_Init() API.<BR>
+ *
+ * <b>NOTE :</b><BR> Until a garbage collection started by this API is completed, E_EEPROM_XMC1_GetStatus()
+ *            returns E_EEPROM_XMC1_STATUS_BUSY. The next write request of the region completes it.\n\n
+ *
+ * <b>Related APIs : </b><BR>  E_EEPROM_XMC1_GcStep(), E_EEPROM_XMC1_GetSpaceInfo()\n\n
+ *
+ */
+ E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_Idle(uint32_t max_operations);
+
 #ifdef E_EEPROM_XMC1_CRC_SW_ENABLED
 
  /**
@@ -826,6 +1357,227 @@ extern "C"  {
                                                                uint8_t *data_buffer_ptr,
                                                                uint32_t length );
 
+ /**
+ * @brief Programs the user defined data block into the flash of the given instance.
+ * @param handle_ptr : Pointer to the handler of the instance for which this API is called
+ * @param block_number : Block ID Name/Number configured in the block table of the instance
+ * @param data_buffer_ptr : Pointer to the user data buffer which need to be stored in flash
+ *
+ * @return <BR> See E_EEPROM_XMC1_Write()
+ *
+ * \par<b>Description:</b><br>
+ *  Same as E_EEPROM_XMC1_Write() for the instance \a handle_ptr.
+ *
+ */
+ E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_WriteEx(E_EEPROM_XMC1_t *const handle_ptr,
+                                                       uint8_t block_number,
+                                                       uint8_t *data_buffer_ptr);
+
+ /**
+ * @brief Reads the data block contents from flash of the given instance.
+ * @param handle_ptr : Pointer to the handler of the instance for which this API is called
+ * @param block_number : Block ID Name/Number configured in the block table of the instance
+ * @param block_offset : Offset position to start the read operation
+ * @param data_buffer_ptr : Pointer to the data buffer where data has to be stored after read
+ * @param length : Number of the data block elements to be read from the FLASH
+ *
+ * @return <BR> See E_EEPROM_XMC1_Read()
+ *
+ * \par<b>Description:</b><br>
+ *  Same as E_EEPROM_XMC1_Read() for the instance \a handle_ptr.
+ *
+ */
+ E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_ReadEx(E_EEPROM_XMC1_t *const handle_ptr,
+                                                      uint8_t block_number,
+                                                      uint32_t block_offset,
+                                                      uint8_t *data_buffer_ptr,
+                                                      uint32_t length);
+
+ /**
+ * @brief Executes garbage collection of the given instance.
+ * @param handle_ptr : Pointer to the handler of the instance for which this API is called
+ *
+ * @return <BR> See E_EEPROM_XMC1_StartGarbageCollection()
+ *
+ * \par<b>Description:</b><br>
+ *  Same as E_EEPROM_XMC1_StartGarbageCollection() for the instance \a handle_ptr. Only the banks of this
+ *  instance are copied and erased.
+ *
+ */
+ E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_StartGarbageCollectionEx(E_EEPROM_XMC1_t *const handle_ptr);
+
+ /**
+ * @brief Executes garbage collection of the given instance in steps.
+ * @param handle_ptr : Pointer to the handler of the instance for which this API is called
+ * @param max_operations : Maximum number of flash program/erase operations executed by this call
+ * @param progress_ptr : Pointer to the structure updated with the progress of the garbage collection. Can be NULL.
+ *
+ * @return <BR> See E_EEPROM_XMC1_GcStep()
+ *
+ * \par<b>Description:</b><br>
+ *  Same as E_EEPROM_XMC1_GcStep() for the instance \a handle_ptr.
+ *
+ */
+ E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_GcStepEx(E_EEPROM_XMC1_t *const handle_ptr,
+                                                        uint32_t max_operations,
+                                                        E_EEPROM_XMC1_GC_PROGRESS_t *const progress_ptr);
+
+ /**
+ * @brief Searches the blocks of the given instance not yet evaluated after a lazy initialization.
+ * @param handle_ptr : Pointer to the handler of the instance for which this API is called
+ * @param max_blocks : Maximum number of blocks searched by this call
+ * @param pending_ptr : Pointer to the number of blocks still to be searched after this call. Can be NULL.
+ *
+ * @return <BR> See E_EEPROM_XMC1_MountStep()
+ *
+ * \par<b>Description:</b><br>
+ *  Same as E_EEPROM_XMC1_MountStep() for the instance \a handle_ptr.
+ *
+ */
+ E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_MountStepEx(E_EEPROM_XMC1_t *const handle_ptr,
+                                                           uint32_t max_blocks,
+                                                           uint32_t *const pending_ptr);
+
+ /**
+ * @brief Invalidates a user defined data block of the given instance.
+ * @param handle_ptr : Pointer to the handler of the instance for which this API is called
+ * @param block_number : Block ID Name/Number configured in the block table of the instance
+ *
+ * @return <BR> See E_EEPROM_XMC1_InvalidateBlock()
+ *
+ * \par<b>Description:</b><br>
+ *  Same as E_EEPROM_XMC1_InvalidateBlock() for the instance \a handle_ptr.
+ *
+ */
+ E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_InvalidateBlockEx(E_EEPROM_XMC1_t *const handle_ptr,
+                                                                 uint8_t block_number);
+
+ /**
+ * @brief Writes and/or invalidates several user data blocks of the given instance with one request.
+ * @param handle_ptr : Pointer to the handler of the instance for which this API is called
+ * @param req_ptr : Pointer to an array of requests for blocks of the instance
+ * @param req_count : Number of requests in the array
+ *
+ * @return <BR> See E_EEPROM_XMC1_WriteMulti()
+ *
+ * \par<b>Description:</b><br>
+ *  Same as E_EEPROM_XMC1_WriteMulti() for the instance \a handle_ptr.
+ *
+ */
+ E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_WriteMultiEx(E_EEPROM_XMC1_t *const handle_ptr,
+                                                            const E_EEPROM_XMC1_WRITE_REQ_t *const req_ptr,
+                                                            uint32_t req_count);
+
+ /**
+ * @brief Programs a user defined data block into the flash of the given instance using the emergency reserve.
+ * @param handle_ptr : Pointer to the handler of the instance for which this API is called
+ * @param block_number : Block ID Name/Number configured in the block table of the instance
+ * @param data_buffer_ptr : Pointer to the user data buffer which need to be stored in flash
+ *
+ * @return <BR> See E_EEPROM_XMC1_EmergencyWrite()
+ *
+ * \par<b>Description:</b><br>
+ *  Same as E_EEPROM_XMC1_EmergencyWrite() for the instance \a handle_ptr.
+ *
+ */
+ E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_EmergencyWriteEx(E_EEPROM_XMC1_t *const handle_ptr,
+                                                                uint8_t block_number,
+                                                                uint8_t *data_buffer_ptr);
+
+ /**
+ * @brief Checks the status of the given instance.
+ * @param handle_ptr : Pointer to the handler of the instance for which this API is called
+ *
+ * @return <BR> See E_EEPROM_XMC1_GetStatus()
+ *
+ * \par<b>Description:</b><br>
+ *  Same as E_EEPROM_XMC1_GetStatus() for the instance \a handle_ptr.
+ *
+ */
+ E_EEPROM_XMC1_STATUS_t E_EEPROM_XMC1_GetStatusEx(E_EEPROM_XMC1_t *const handle_ptr);
+
+ /**
+ * @brief Checks the availability of space in the flash bank of the given instance to write the data block.
+ * @param handle_ptr : Pointer to the handler of the instance for which this API is called
+ * @param block_number : Block ID Name/Number configured in the block table of the instance
+ *
+ * @return <BR> See E_EEPROM_XMC1_IsGarbageCollectionNeeded()
+ *
+ * \par<b>Description:</b><br>
+ *  Same as E_EEPROM_XMC1_IsGarbageCollectionNeeded() for the instance \a handle_ptr.
+ *
+ */
+ bool E_EEPROM_XMC1_IsGarbageCollectionNeededEx(E_EEPROM_XMC1_t *const handle_ptr, uint8_t block_number);
+
+ /**
+ * @brief Reports the free, live and dead flash space of the region of a data block of the given instance.
+ * @param handle_ptr : Pointer to the handler of the instance for which this API is called
+ * @param block_number : Block ID Name/Number configured in the block table of the instance
+ * @param info_ptr : Pointer to the structure which receives the space information
+ *
+ * @return <BR> See E_EEPROM_XMC1_GetSpaceInfo()
+ *
+ * \par<b>Description:</b><br>
+ *  Same as E_EEPROM_XMC1_GetSpaceInfo() for the instance \a handle_ptr.
+ *
+ */
+ E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_GetSpaceInfoEx(E_EEPROM_XMC1_t *const handle_ptr,
+                                                               uint8_t block_number,
+                                                               E_EEPROM_XMC1_SPACE_INFO_t *const info_ptr);
+
+ /**
+ * @brief Executes the idle time garbage collection policy of the given instance.
+ * @param handle_ptr : Pointer to the handler of the instance for which this API is called
+ * @param max_operations : Maximum number of flash program/erase operations, must not be 0
+ *
+ * @return <BR> See E_EEPROM_XMC1_Idle()
+ *
+ * \par<b>Description:</b><br>
+ *  Same as E_EEPROM_XMC1_Idle() for the instance \a handle_ptr.
+ *
+ */
+ E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_IdleEx(E_EEPROM_XMC1_t *const handle_ptr, uint32_t max_operations);
+
+#ifdef E_EEPROM_XMC1_CRC_SW_ENABLED
+
+ /**
+ * @brief Reads a complete data block of the given instance and verifies it using the CRC checksum.
+ * @param handle_ptr : Pointer to the handler of the instance for which this API is called
+ * @param block_number : Block ID Name/Number configured in the block table of the instance
+ * @param data_buffer_ptr : Pointer to the data buffer where data has to be stored after read
+ *
+ * @return <BR> See E_EEPROM_XMC1_VerifyBlockCrcStatus()
+ *
+ * \par<b>Description:</b><br>
+ *  Same as E_EEPROM_XMC1_VerifyBlockCrcStatus() for the instance \a handle_ptr.
+ *
+ */
+ E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_VerifyBlockCrcStatusEx(E_EEPROM_XMC1_t *const handle_ptr,
+                                                                      uint8_t block_number,
+                                                                      uint8_t *data_buffer_ptr);
+
+#endif
+
+ /**
+ * @brief Reads the just previous copy of a block of the given instance.
+ * @param handle_ptr : Pointer to the handler of the instance for which this API is called
+ * @param block_number : Block ID Name/Number configured in the block table of the instance
+ * @param block_offset : Offset position to start the read operation
+ * @param data_buffer_ptr : Pointer to the data buffer where data has to be stored after read
+ * @param length : Number of the data block elements to be read from the FLASH
+ *
+ * @return <BR> See E_EEPROM_XMC1_GetPreviousData()
+ *
+ * \par<b>Description:</b><br>
+ *  Same as E_EEPROM_XMC1_GetPreviousData() for the instance \a handle_ptr.
+ *
+ */
+ E_EEPROM_XMC1_OPERATION_STATUS_t E_EEPROM_XMC1_GetPreviousDataEx(E_EEPROM_XMC1_t *const handle_ptr,
+                                                                 uint8_t block_number,
+                                                                 uint32_t block_offset,
+                                                                 uint8_t *data_buffer_ptr,
+                                                                 uint32_t length);
+
 /**
  *@}
  */
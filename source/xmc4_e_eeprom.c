@@ -47,12 +47,10 @@
  * MACROS
  *****************************************************************************/
 
-/* EEPROM SECTOR numbers definitions */
-#define E_EEPROM_XMC4_SECTOR_0    ((uint32_t)0U)
-#define E_EEPROM_XMC4_SECTOR_1    ((uint32_t)1U)
-#define E_EEPROM_XMC4_SECTOR_2    ((uint32_t)2U)
-#define E_EEPROM_XMC4_SECTOR_3    ((uint32_t)3U)
-#define E_EEPROM_XMC4_MAX_SECTORS ((uint32_t)4U)
+/* EEPROM SECTOR numbers definitions, the default sectors are listed in E_EEPROM_XMC4_SECTORS */
+#define E_EEPROM_XMC4_SECTOR_0              ((uint32_t)0U)
+#define E_EEPROM_XMC4_DEFAULT_SECTOR_COUNT  ((uint32_t)(sizeof(e_eeprom_xmc4_sectors) / \
+                                                        sizeof(e_eeprom_xmc4_sectors[0])))
 
 /* Offset positions for CRC and user DATA definitions*/
 #define E_EEPROM_XMC4_BCC_OFFSET  ((uint8_t)1U)
@@ -60,72 +58,58 @@
 
 #if (UC_FLASH < 128UL)
 #error "EEPROM NOT SUPPORTED FOR SMALL SIZE FLASH DEVICES"
-#else
-/* All four logical sector starting addresses defined */
-#define E_EEPROM_XMC4_SECTOR0_START_ADDR   (XMC_FLASH_UNCACHED_BASE + 0x10000U)
-#define E_EEPROM_XMC4_SECTOR1_START_ADDR   (XMC_FLASH_UNCACHED_BASE + 0x14000U)
-#define E_EEPROM_XMC4_SECTOR2_START_ADDR   (XMC_FLASH_UNCACHED_BASE + 0x18000U)
-#define E_EEPROM_XMC4_SECTOR3_START_ADDR   (XMC_FLASH_UNCACHED_BASE + 0x1C000U)
-#define E_EEPROM_XMC4_SECTOR4_START_ADDR   (XMC_FLASH_UNCACHED_BASE + 0x20000U)
+#endif
+
+#if defined(E_EEPROM_XMC4_FLASH_READ_ENABLED) && defined(E_EEPROM_XMC4_WARM_RESET_ENABLED)
+#error "E_EEPROM_XMC4_FLASH_READ_ENABLED CANNOT BE COMBINED WITH E_EEPROM_XMC4_WARM_RESET_ENABLED"
 #endif
 
 /* Local definitions for internal usage*/
 #define E_EEPROM_XMC4_EMPTY                   ((uint32_t)0x0U)
-#define E_EEPROM_XMC4_ALL_SECTORS_FILLED      ((uint8_t)0x0FU)
-#define E_EEPROM_XMC4_MIN_WORDS_PER_PAGE      ((uint32_t)64U)
-#define E_EEPROM_XMC4_SECTOR_SIZE             ((uint32_t)0x00004000U)
-#define E_EEPROM_XMC4_SECTOR_POSITION_MASK    ((uint32_t)0x0000C000U)
-#define E_EEPROM_XMC4_SECTOR_POSITION         ((uint32_t)14U)
-
-#define E_EEPROM_XMC4_DATA_BLOCK_SIZE         (e_eeprom_xmc4_data_buffer.len)
-#define E_EEPROM_XMC4_ACTUAL_FLASH_BLOCK_SIZE (8192)
 
-#define E_EEPROM_XMC4_WORKING_BUFFER_SIZE     (E_EEPROM_XMC4_ACTUAL_FLASH_BLOCK_SIZE - (uint32_t)(8U))
-#define E_EEPROM_XMC4_DATA_SIZE_FOR_CRC       (E_EEPROM_XMC4_ACTUAL_FLASH_BLOCK_SIZE - (uint32_t)(4U))
-#define E_EEPROM_XMC4_MAX_PAGES               (E_EEPROM_XMC4_ACTUAL_FLASH_BLOCK_SIZE >> (uint32_t)(8U))
-#define E_EEPROM_XMC4_MAX_WORDS               (E_EEPROM_XMC4_ACTUAL_FLASH_BLOCK_SIZE >> (uint32_t)(2U))
+/* Size of the emulated EEPROM of the instance of the handle */
+#define E_EEPROM_XMC4_DATA_BLOCK_SIZE         (handle->data_ptr->data_buffer.len)
+
+/* Flash sectors used by the instance of the handle, taken by E_EEPROM_XMC4_Init() */
+#define E_EEPROM_XMC4_SECTOR_LIST             (handle->data_ptr->sector_ptr)
+#define E_EEPROM_XMC4_SECTOR_COUNT            (handle->data_ptr->sector_count)
+
+/* Size of a data block on flash (CRC + BCC + DATA), the size of the emulated EEPROM rounded up to full pages */
+#define E_EEPROM_XMC4_PAGE_SIZE               ((uint32_t)256U)
+#define E_EEPROM_XMC4_PAGE_POSITION           ((uint32_t)8U)
+#define E_EEPROM_XMC4_HEADER_SIZE             ((uint32_t)8U)
+#define E_EEPROM_XMC4_FLASH_SLOT_SIZE         (((E_EEPROM_XMC4_DATA_BLOCK_SIZE + E_EEPROM_XMC4_HEADER_SIZE + \
+                                                 (E_EEPROM_XMC4_PAGE_SIZE - 1U)) >> E_EEPROM_XMC4_PAGE_POSITION) << \
+                                                 E_EEPROM_XMC4_PAGE_POSITION)
+
+/* The block cycle count word holds the number of pages of the record in the upper byte. Blocks written before the
+ * block size was recorded hold 0 and have the size E_EEPROM_XMC4_ACTUAL_FLASH_BLOCK_SIZE. Delta records are marked
+ * with E_EEPROM_XMC4_BCC_DELTA_RECORD.
+ */
+#define E_EEPROM_XMC4_BCC_COUNT_MASK          ((uint32_t)0x007FFFFFU)
+#define E_EEPROM_XMC4_BCC_DELTA_RECORD        ((uint32_t)0x00800000U)
+#define E_EEPROM_XMC4_BCC_PAGES_POSITION      ((uint32_t)24U)
+
+/* A delta record holds a header page (CRC + BCC + PAGE BITMAP + BASE BLOCK ADDRESS) followed by the pages of the data
+ * block which changed since the last record. A full data block is written after E_EEPROM_XMC4_MAX_DELTA_RECORDS delta
+ * records and when a new sector is started.
+ */
+#define E_EEPROM_XMC4_DELTA_BITMAP_OFFSET     ((uint8_t)2U)
+#define E_EEPROM_XMC4_DELTA_BASE_OFFSET       ((uint8_t)3U)
+#define E_EEPROM_XMC4_MAX_DELTA_RECORDS       ((uint32_t)16U)
 
 #define E_EEPROM_XMC4_FCE_KERNEL_BASE (FCE_KE0_BASE)  /**< FCE kernel number used for CRC calculation*/
 
+/* Seed of the checksum of the run time state kept over a warm reset */
+#define E_EEPROM_XMC4_WARM_MAGIC              ((uint32_t)0x4D524157U)
+
 /*****************************************************************************
  * Data structure Configurations
  ****************************************************************************/
-/** Data structure to hold the complete state data information of sector*/
-typedef struct E_EEPROM_XMC4_SECTOR_INFO
-{
-    uint32_t next_free_start_addr;
-
-    uint32_t flash_data_addr;
-
-    uint32_t  current_sector;
-
-    uint32_t  erase_state;
-
-} E_EEPROM_XMC4_SECTOR_INFO_t;
-
-/* Data structure to hold the User Data block information (BCC + CRC + DATA)*/
-typedef struct E_EEPROM_XMC4_RAM_BUFFER
-{
-    uint32_t crc;
-
-    uint32_t block_cycle_count;
-
-    uint8_t  eeprom_data[E_EEPROM_XMC4_WORKING_BUFFER_SIZE];
-
-    uint32_t len;
-
-} E_EEPROM_XMC4_RAM_BUFFER_t;
-
-/* RAM data buffer structure definition */
-static E_EEPROM_XMC4_RAM_BUFFER_t e_eeprom_xmc4_data_buffer;
-
-/* Sector info data structure definition */
-static E_EEPROM_XMC4_SECTOR_INFO_t  e_eeprom_xmc4_sector_info  =
+/* Flash sectors in the order they are written, used by the instances without own sectors */
+static const E_EEPROM_XMC4_SECTOR_t e_eeprom_xmc4_sectors[] =
 {
-        .next_free_start_addr = 0U,
-        .flash_data_addr      = 0U,
-        .current_sector       = 0xFFFFFFFFU,
-        .erase_state          = 0U
+        E_EEPROM_XMC4_SECTORS
 };
 
 /* FCE configuration data structure definition */
@@ -140,18 +124,84 @@ static const XMC_FCE_t e_eeprom_xmc4_fce =
         .seedvalue      = 0U
 };
 
+#ifdef E_EEPROM_XMC4_FLASH_READ_ENABLED
+/* Content of the pages beyond the data block on flash */
+static const uint32_t e_eeprom_xmc4_zero_page[E_EEPROM_XMC4_MIN_WORDS_PER_PAGE] = {0U};
+#endif
+
 /*****************************************************************************
  *  * Local Function Prototypes
  ****************************************************************************/
-static E_EEPROM_XMC4_STATUS_t E_EEPROM_XMC4_lWriteToFlash(void);
+static void E_EEPROM_XMC4_lPrepareRecord(E_EEPROM_XMC4_t *const handle, uint32_t page_bitmap);
+
+static void E_EEPROM_XMC4_lCopyCommitPage(E_EEPROM_XMC4_t *const handle, uint32_t page_index);
+
+static void E_EEPROM_XMC4_lFinishCommit(E_EEPROM_XMC4_t *const handle, E_EEPROM_XMC4_STATUS_t status);
+
+static void E_EEPROM_XMC4_lProtectPage(E_EEPROM_XMC4_t *const handle, uint32_t page_index);
+
+static void E_EEPROM_XMC4_lFreeShadowPages(E_EEPROM_XMC4_t *const handle);
+
+static void E_EEPROM_XMC4_lCopyFlashToRam(E_EEPROM_XMC4_t *const handle);
+
+static uint32_t E_EEPROM_XMC4_lInitFindRecord(E_EEPROM_XMC4_t *const handle, uint32_t below_count, uint32_t below_addr);
+
+static bool E_EEPROM_XMC4_lInitApplyRecords(E_EEPROM_XMC4_t *const handle, uint32_t latest_addr);
+
+static bool E_EEPROM_XMC4_lIsRecordValid(E_EEPROM_XMC4_t *const handle, uint32_t record_addr);
+
+static E_EEPROM_XMC4_STATUS_t E_EEPROM_XMC4_lEraseSector(E_EEPROM_XMC4_t *const handle, uint32_t sector);
+
+static uint32_t E_EEPROM_XMC4_lGetStaleSectors(E_EEPROM_XMC4_t *const handle);
 
-static void E_EEPROM_XMC4_lCopyFlashToRam(void);
+static uint32_t E_EEPROM_XMC4_lCalculateCRC(const uint32_t *data_start_addr, uint32_t record_size);
 
-static void E_EEPROM_XMC4_lInitReadSectorInfo(uint32_t sector);
+static uint32_t E_EEPROM_XMC4_lGetRecordSize(uint32_t block_cycle_count);
 
-static E_EEPROM_XMC4_STATUS_t E_EEPROM_XMC4_lInitEraseStateMachine(void);
+static uint32_t E_EEPROM_XMC4_lGetSector(E_EEPROM_XMC4_t *const handle, uint32_t addr);
 
-static uint32_t E_EEPROM_XMC4_lCalculateCRC(const uint32_t *data_start_addr);
+static uint32_t E_EEPROM_XMC4_lGetSectorEndAddr(E_EEPROM_XMC4_t *const handle, uint32_t addr);
+
+static uint32_t E_EEPROM_XMC4_lGetNextSectorAddr(E_EEPROM_XMC4_t *const handle, uint32_t sector);
+
+static void E_EEPROM_XMC4_lAlignNextFreeAddr(E_EEPROM_XMC4_t *const handle, uint32_t record_size);
+
+static uint32_t E_EEPROM_XMC4_lGetPageCount(uint32_t page_bitmap);
+
+static uint32_t E_EEPROM_XMC4_lGetChangedPages(E_EEPROM_XMC4_t *const handle);
+
+static const uint32_t *E_EEPROM_XMC4_lGetPageData(E_EEPROM_XMC4_t *const handle, uint32_t page_index);
+
+static const uint8_t *E_EEPROM_XMC4_lGetDataAddr(E_EEPROM_XMC4_t *const handle, uint32_t offset_address);
+
+static uint8_t *E_EEPROM_XMC4_lGetWritableAddr(E_EEPROM_XMC4_t *const handle, uint32_t offset_address);
+
+static bool E_EEPROM_XMC4_lCanWritePages(E_EEPROM_XMC4_t *const handle, uint32_t offset_address,
+        const uint8_t *const data, uint32_t length);
+
+static void E_EEPROM_XMC4_lClearDirtyPages(E_EEPROM_XMC4_t *const handle);
+
+static void E_EEPROM_XMC4_lApplyRecord(uint32_t *const page_addr, uint32_t record_addr);
+
+static void E_EEPROM_XMC4_lMarkDirty(E_EEPROM_XMC4_t *const handle, uint32_t offset_address);
+
+static void E_EEPROM_XMC4_lApplyFlushPolicy(E_EEPROM_XMC4_t *const handle);
+
+static void E_EEPROM_XMC4_lSealWarmState(E_EEPROM_XMC4_t *const handle);
+
+static void E_EEPROM_XMC4_lUnsealWarmState(E_EEPROM_XMC4_t *const handle);
+
+static bool E_EEPROM_XMC4_lIsWarmSealed(E_EEPROM_XMC4_t *const handle);
+
+static void E_EEPROM_XMC4_lResealSectorInfo(E_EEPROM_XMC4_t *const handle);
+
+#ifdef E_EEPROM_XMC4_WARM_RESET_ENABLED
+static bool E_EEPROM_XMC4_lIsWarmStateValid(E_EEPROM_XMC4_t *const handle, uint32_t len);
+
+static uint32_t E_EEPROM_XMC4_lGetWarmChecksum(E_EEPROM_XMC4_t *const handle);
+
+static uint32_t E_EEPROM_XMC4_lCalculateRamCRC(E_EEPROM_XMC4_t *const handle);
+#endif
 
 /*****************************************************************************
  * API IMPLEMENTATION
@@ -171,6 +221,10 @@ static uint32_t E_EEPROM_XMC4_lCalculateCRC(const uint32_t *data_start_addr);
  * process will copy the latest block into new free sector and erase the old sector.
  * If the copy process results in flash write errors or when all sectors filled up,
  * it returns the status E_EEPROM_XMC4_STATUS_WRITE_ERROR.
+ * The records are ordered by their block cycle count and only the newest are
+ * verified by their CRC, down to the first valid one.
+ * With E_EEPROM_XMC4_WARM_RESET_ENABLED a sealed RAM buffer kept over a warm
+ * reset is used without reading the flash.
  *
  * Parameters:
  * handle - e_eeprom handle
@@ -182,11 +236,14 @@ static uint32_t E_EEPROM_XMC4_lCalculateCRC(const uint32_t *data_start_addr);
  *******************************************************************************/
 E_EEPROM_XMC4_STATUS_t E_EEPROM_XMC4_Init(E_EEPROM_XMC4_t *const handle, uint32_t len)
 {
-    uint32_t sector_count;
+    uint32_t latest_block_addr;
     E_EEPROM_XMC4_STATUS_t status ;
+    E_EEPROM_XMC4_DATA_t *data_ptr;
 
     XMC_ASSERT("E_EEPROM_XMC4_Init:Invalid handle Pointer", (handle != NULL))
+    XMC_ASSERT("E_EEPROM_XMC4_Init:Invalid data Pointer", (handle->data_ptr != NULL))
 
+    data_ptr = handle->data_ptr;
     status = E_EEPROM_XMC4_STATUS_OK;
 
     if (handle->initialized == (bool)false)
@@ -195,69 +252,134 @@ E_EEPROM_XMC4_STATUS_t E_EEPROM_XMC4_Init(E_EEPROM_XMC4_t *const handle, uint32_
         {
             return E_EEPROM_XMC4_STATUS_ERROR_PARAM;
         }
-        e_eeprom_xmc4_data_buffer.block_cycle_count = 0U;
-        e_eeprom_xmc4_sector_info.flash_data_addr = E_EEPROM_XMC4_EMPTY;
-        e_eeprom_xmc4_data_buffer.len = len;
 
-        XMC_FLASH_SetMargin(XMC_FLASH_MARGIN_TIGHT0);
-        XMC_FLASH_DisableDoubleBitErrorTrap();
+#ifndef E_EEPROM_XMC4_FLASH_READ_ENABLED
+        /* The RAM copy of the data block is supplied by the application, sized for len */
+        if (handle->ram_ptr == NULL)
+        {
+            return E_EEPROM_XMC4_STATUS_ERROR_PARAM;
+        }
+#endif
+
+        /* An instance without own sectors uses the default sectors, the handle is not changed */
+        if (handle->sector_ptr == NULL)
+        {
+            data_ptr->sector_ptr = e_eeprom_xmc4_sectors;
+            data_ptr->sector_count = E_EEPROM_XMC4_DEFAULT_SECTOR_COUNT;
+        }
+        else
+        {
+            data_ptr->sector_ptr = handle->sector_ptr;
+            data_ptr->sector_count = handle->sector_count;
+        }
+
+        XMC_ASSERT("E_EEPROM_XMC4_Init:Invalid number of sectors", ((data_ptr->sector_count >= 2U) &&
+                (data_ptr->sector_count <= 32U)))
 
         XMC_FCE_Enable();
 
         /* Initialize FCE module for Hardware calculations */
         (void)XMC_FCE_Init(&e_eeprom_xmc4_fce);
 
-        /* Iterate all 4 sectors to find out which is the active sector having the latest data block*/
-        for (sector_count = 0U; sector_count < E_EEPROM_XMC4_MAX_SECTORS ; sector_count++)
+        data_ptr->flush_state.policy = handle->flush_policy;
+        data_ptr->flush_state.dirty_bytes_limit = handle->flush_dirty_bytes;
+        data_ptr->flush_state.quiet_time = handle->flush_quiet_time;
+        data_ptr->flush_state.quiet_elapsed = 0U;
+        E_EEPROM_XMC4_lClearDirtyPages(handle);
+        data_ptr->flush_state.last_status = E_EEPROM_XMC4_STATUS_OK;
+
+        data_ptr->commit_state.busy = false;
+        data_ptr->commit_state.pending_pages = 0U;
+        E_EEPROM_XMC4_lFreeShadowPages(handle);
+
+        (void)memset(&data_ptr->init_info, 0, sizeof(data_ptr->init_info));
+
+#ifdef E_EEPROM_XMC4_WARM_RESET_ENABLED
+        /* After a warm reset the RAM buffer sealed before the reset is used, the flash is not read */
+        if (E_EEPROM_XMC4_lIsWarmStateValid(handle, len) == (bool)true)
+        {
+            handle->initialized = (bool)true;
+            return (status);
+        }
+#endif
+
+        data_ptr->data_buffer.block_cycle_count = 0U;
+        data_ptr->sector_info.flash_data_addr = E_EEPROM_XMC4_EMPTY;
+        data_ptr->sector_info.current_sector = 0xFFFFFFFFU;
+        data_ptr->sector_info.erase_state = 0U;
+        data_ptr->sector_info.base_addr = E_EEPROM_XMC4_EMPTY;
+        data_ptr->sector_info.delta_count = 0U;
+        data_ptr->sector_info.page_count = 0U;
+        (void)memset(data_ptr->sector_info.page_addr, 0, sizeof(data_ptr->sector_info.page_addr));
+        data_ptr->data_buffer.len = len;
+
+        XMC_FLASH_SetMargin(XMC_FLASH_MARGIN_TIGHT0);
+        XMC_FLASH_DisableDoubleBitErrorTrap();
+
+        /* Only the block cycle counts are read to find the newest record. The records are verified from the newest
+         * down until one is valid, the older records are not checked.
+         */
+        latest_block_addr = E_EEPROM_XMC4_lInitFindRecord(handle, 0xFFFFFFFFU, 0U);
+
+        while ((latest_block_addr != E_EEPROM_XMC4_EMPTY) &&
+                (E_EEPROM_XMC4_lInitApplyRecords(handle, latest_block_addr) == (bool)false))
         {
-            E_EEPROM_XMC4_lInitReadSectorInfo(sector_count);
+            latest_block_addr = E_EEPROM_XMC4_lInitFindRecord(handle,
+                    *((uint32_t*)latest_block_addr + E_EEPROM_XMC4_BCC_OFFSET) & E_EEPROM_XMC4_BCC_COUNT_MASK,
+                    latest_block_addr);
         }
 
         XMC_FLASH_SetMargin(XMC_FLASH_MARGIN_DEFAULT);
 
         /* Implement the OVER ERASE CHECK code here and return the status*/
 
-        /* If Read was successful*/
+        /* The sectors apart from the one having the latest valid block stay marked in the erase state. They are
+         * erased by E_EEPROM_XMC4_EraseStep() or, at the latest, before the next record is written into them.
+         */
         if (status == E_EEPROM_XMC4_STATUS_OK)
         {
-            /* Execute erase state machine to free up the unwanted sectors and keep
-             * only the sector which has latest valid block. If no valid block found then all sectors are emptied.
+            /* If a valid latest block were not detected, we shall assume that all sectors may be empty.
+             * Then make Sector-0 as current sector and next free address as Sector0 start address
              */
-            status = E_EEPROM_XMC4_lInitEraseStateMachine();
-
-            /* If erase operations were successful, continue block data updates to RAM buffer */
-            if (status == E_EEPROM_XMC4_STATUS_OK)
+            if (data_ptr->sector_info.flash_data_addr == E_EEPROM_XMC4_EMPTY)
+            {
+                data_ptr->sector_info.current_sector = E_EEPROM_XMC4_SECTOR_0;
+                data_ptr->sector_info.next_free_start_addr =
+                    E_EEPROM_XMC4_SECTOR_LIST[E_EEPROM_XMC4_SECTOR_0].start_addr;
+#ifdef E_EEPROM_XMC4_WARM_RESET_ENABLED
+                /* The RAM buffer is not cleared by the startup code */
+                (void)memset(handle->ram_ptr, 0, E_EEPROM_XMC4_FLASH_SLOT_SIZE);
+#endif
+            }
+            else
             {
+                /* If a valid latest block was detected, copy the valid block from flash to RAM. */
+                E_EEPROM_XMC4_lCopyFlashToRam(handle);
 
-                /* If a valid latest block were not detected, we shall assume that all sectors may be empty.
-                 * Then make Sector-0 as current sector and next free address as Sector0 start address
-                 */
-                if (e_eeprom_xmc4_sector_info.flash_data_addr == E_EEPROM_XMC4_EMPTY)
+                /* If the latest valid record is not the last record written in its sector, a newer record is corrupted */
+                if ((data_ptr->sector_info.next_free_start_addr - data_ptr->sector_info.flash_data_addr) !=
+                        E_EEPROM_XMC4_lGetRecordSize(data_ptr->data_buffer.block_cycle_count))
                 {
-                    e_eeprom_xmc4_sector_info.current_sector = E_EEPROM_XMC4_SECTOR_0;
-                    e_eeprom_xmc4_sector_info.next_free_start_addr =  E_EEPROM_XMC4_SECTOR0_START_ADDR;
+                    status = E_EEPROM_XMC4_STATUS_ERROR_OLD_DATA;
                 }
-                else
-                {
-                    /* If a valid latest block was detected, copy the valid block from flash to RAM. */
-                    E_EEPROM_XMC4_lCopyFlashToRam();
-
-                    if ((e_eeprom_xmc4_sector_info.next_free_start_addr - e_eeprom_xmc4_sector_info.flash_data_addr) != (e_eeprom_xmc4_data_buffer.len * 2))
-                    {
-                        status = E_EEPROM_XMC4_STATUS_ERROR_OLD_DATA;
-                    }
-
-                    if (e_eeprom_xmc4_sector_info.next_free_start_addr >= E_EEPROM_XMC4_SECTOR4_START_ADDR)
-                    {
-                        e_eeprom_xmc4_sector_info.next_free_start_addr =  E_EEPROM_XMC4_SECTOR0_START_ADDR;
-                    }
 
+                /* If the sector is full, the next record is written to the next sector */
+                if (data_ptr->sector_info.next_free_start_addr ==
+                        E_EEPROM_XMC4_lGetSectorEndAddr(handle, data_ptr->sector_info.flash_data_addr))
+                {
+                    data_ptr->sector_info.next_free_start_addr =
+                            E_EEPROM_XMC4_lGetNextSectorAddr(handle, data_ptr->sector_info.current_sector);
                 }
             }
         }
 
         XMC_FLASH_EnableDoubleBitErrorTrap();
 
+        if (status == E_EEPROM_XMC4_STATUS_OK)
+        {
+            E_EEPROM_XMC4_lSealWarmState(handle);
+        }
+
         handle->initialized = (bool)true;
     }
 
@@ -271,6 +393,7 @@ E_EEPROM_XMC4_STATUS_t E_EEPROM_XMC4_Init(E_EEPROM_XMC4_t *const handle, uint32_
  * Update a particular byte in the RAM copy of data block.
  *
  * Parameters:
+ * handle - e_eeprom handle
  * offset_address - Address offset
  * value - Data to write
  *
@@ -278,16 +401,28 @@ E_EEPROM_XMC4_STATUS_t E_EEPROM_XMC4_Init(E_EEPROM_XMC4_t *const handle, uint32_
  * E_EEPROM_XMC4_WriteByte
  *
  *******************************************************************************/
-bool E_EEPROM_XMC4_WriteByte(const uint16_t offset_address, const uint8_t value)
+bool E_EEPROM_XMC4_WriteByte(E_EEPROM_XMC4_t *const handle, const uint16_t offset_address, const uint8_t value)
 {
     uint8_t *address_ptr;
     bool status;
 
     XMC_ASSERT("E_EEPROM_XMC4_WriteByte: Wrong offset address", (offset_address  < E_EEPROM_XMC4_DATA_BLOCK_SIZE))
-    address_ptr = (uint8_t*)(void*)(&e_eeprom_xmc4_data_buffer.eeprom_data) + (uint32_t)offset_address;
-    status = (*address_ptr != value);
+    status = false;
+
+    if ((*E_EEPROM_XMC4_lGetDataAddr(handle, (uint32_t)offset_address) != value) &&
+            (E_EEPROM_XMC4_lCanWritePages(handle, (uint32_t)offset_address, &value, 1U) == (bool)true))
+    {
+        address_ptr = E_EEPROM_XMC4_lGetWritableAddr(handle, (uint32_t)offset_address);
+
+        if (address_ptr != NULL)
+        {
+            *address_ptr = value;
+            status = true;
 
-    *address_ptr = value;
+            E_EEPROM_XMC4_lMarkDirty(handle, (uint32_t)offset_address);
+            E_EEPROM_XMC4_lApplyFlushPolicy(handle);
+        }
+    }
 
     return status;
 }
@@ -299,6 +434,7 @@ bool E_EEPROM_XMC4_WriteByte(const uint16_t offset_address, const uint8_t value)
  * Update a set of bytes in the RAM copy of data block.
  *
  * Parameters:
+ * handle - e_eeprom handle
  * offset_address - offset address
  * data - data to write
  * length - length of data
@@ -307,7 +443,8 @@ bool E_EEPROM_XMC4_WriteByte(const uint16_t offset_address, const uint8_t value)
  * uint32_t
  *
  *******************************************************************************/
-bool E_EEPROM_XMC4_WriteArray(const uint16_t offset_address, const uint8_t *const data, const uint16_t length)
+bool E_EEPROM_XMC4_WriteArray(E_EEPROM_XMC4_t *const handle, const uint16_t offset_address,
+                              const uint8_t *const data, const uint16_t length)
 {
     uint16_t i;
     uint8_t  *address_ptr;
@@ -317,12 +454,32 @@ bool E_EEPROM_XMC4_WriteArray(const uint16_t offset_address, const uint8_t *cons
     XMC_ASSERT("E_EEPROM_XMC4_WriteArray: Wrong length",
             ((offset_address + length)  < E_EEPROM_XMC4_DATA_BLOCK_SIZE))
 
-            address_ptr = (uint8_t*)(void*)(&e_eeprom_xmc4_data_buffer.eeprom_data) + (uint32_t)offset_address;
-    status = (memcmp(address_ptr, data, length) != 0);
+    status = false;
+
+    /* The array is written completely or not at all */
+    if (E_EEPROM_XMC4_lCanWritePages(handle, (uint32_t)offset_address, data, (uint32_t)length) == (bool)false)
+    {
+        return status;
+    }
 
     for (i = 0U; i < length; i++)
     {
-        *(address_ptr + i) = *(data + i);
+        if (*E_EEPROM_XMC4_lGetDataAddr(handle, (uint32_t)offset_address + i) != *(data + i))
+        {
+            address_ptr = E_EEPROM_XMC4_lGetWritableAddr(handle, (uint32_t)offset_address + i);
+
+            if (address_ptr != NULL)
+            {
+                *address_ptr = *(data + i);
+                E_EEPROM_XMC4_lMarkDirty(handle, (uint32_t)offset_address + i);
+                status = true;
+            }
+        }
+    }
+
+    if (status == (bool)true)
+    {
+        E_EEPROM_XMC4_lApplyFlushPolicy(handle);
     }
 
     return status;
@@ -335,6 +492,7 @@ bool E_EEPROM_XMC4_WriteArray(const uint16_t offset_address, const uint8_t *cons
  * Reads a particular byte from the RAM copy of data block.
  *
  * Parameters:
+ * handle - e_eeprom handle
  * offset_address - offset address
  * value - variable to store read data
  *
@@ -342,13 +500,11 @@ bool E_EEPROM_XMC4_WriteArray(const uint16_t offset_address, const uint8_t *cons
  * void
  *
  *******************************************************************************/
-void E_EEPROM_XMC4_ReadByte(const uint16_t offset_address, uint8_t *const value)
+void E_EEPROM_XMC4_ReadByte(E_EEPROM_XMC4_t *const handle, const uint16_t offset_address, uint8_t *const value)
 {
-    uint8_t *address_ptr;
     XMC_ASSERT("E_EEPROM_XMC4_ReadByte: Wrong offset address", (offset_address  < E_EEPROM_XMC4_DATA_BLOCK_SIZE))
-    address_ptr = (uint8_t*)(void*)(&e_eeprom_xmc4_data_buffer.eeprom_data) + (uint32_t)offset_address;
 
-    *value = *address_ptr;
+    *value = *E_EEPROM_XMC4_lGetDataAddr(handle, (uint32_t)offset_address);
 }
 
 /*******************************************************************************
@@ -358,6 +514,7 @@ void E_EEPROM_XMC4_ReadByte(const uint16_t offset_address, uint8_t *const value)
  * Reads a set of bytes from the RAM copy of data block.
  *
  * Parameters:
+ * handle - e_eeprom handle
  * offset_address - offset address
  * data - data to write
  * length - length of data
@@ -366,18 +523,27 @@ void E_EEPROM_XMC4_ReadByte(const uint16_t offset_address, uint8_t *const value)
  * uint32_t
  *
  *******************************************************************************/
-void E_EEPROM_XMC4_ReadArray(const uint16_t offset_address, uint8_t *const data, const uint16_t length)
+void E_EEPROM_XMC4_ReadArray(E_EEPROM_XMC4_t *const handle, const uint16_t offset_address,
+                             uint8_t *const data, const uint16_t length)
 {
-    uint16_t i;
-    uint8_t  *address_ptr;
+    uint32_t i;
+    uint32_t read_length;
+    uint32_t offset;
     XMC_ASSERT("E_EEPROM_XMC4_ReadArray: Wrong offset address", (offset_address  < E_EEPROM_XMC4_DATA_BLOCK_SIZE))
     XMC_ASSERT("E_EEPROM_XMC4_ReadArray: Wrong length",
             ((offset_address + length)  < E_EEPROM_XMC4_DATA_BLOCK_SIZE))
-            address_ptr = (uint8_t*)(void*)(&e_eeprom_xmc4_data_buffer.eeprom_data) + (uint32_t)offset_address;
 
-    for (i = 0U; i<length; i++)
+    /* The data is read page by page, the pages may be held at different places */
+    for (i = 0U; i < length; i += read_length)
     {
-        *(data + i) = *(address_ptr + i);
+        offset = (uint32_t)offset_address + i;
+        read_length = E_EEPROM_XMC4_PAGE_SIZE - ((offset + E_EEPROM_XMC4_HEADER_SIZE) & (E_EEPROM_XMC4_PAGE_SIZE - 1U));
+        if (read_length > (length - i))
+        {
+            read_length = length - i;
+        }
+
+        (void)memcpy(data + i, E_EEPROM_XMC4_lGetDataAddr(handle, offset), read_length);
     }
 }
 
@@ -388,316 +554,1872 @@ void E_EEPROM_XMC4_ReadArray(const uint16_t offset_address, uint8_t *const data,
  * Programs the RAM buffer into emulated area of the FLASH. On successful
  * completion of this API, the data block gets saved in the flash. Hence data
  * retention is possible over reset cycles. Call this API only in the POWER DOWN
- * cycle to ensure the flash endurance.
+ * cycle to ensure the flash endurance. Only the changed pages are programmed as
+ * a delta record, unless a full data block is due. A commit in progress is
+ * completed first.
  *
  * Parameters:
- * void
+ * handle - e_eeprom handle
  *
  * Return:
  * E_EEPROM_XMC4_STATUS_t
  *
  *******************************************************************************/
-E_EEPROM_XMC4_STATUS_t E_EEPROM_XMC4_UpdateFlashContents(void)
+E_EEPROM_XMC4_STATUS_t E_EEPROM_XMC4_UpdateFlashContents(E_EEPROM_XMC4_t *const handle)
 {
     E_EEPROM_XMC4_STATUS_t status;
-    uint32_t sector_start_addr;
-
-    status = E_EEPROM_XMC4_STATUS_OK;
-
-    /* Calculate the starting address of the active sector from where the first write started for the current cycle*/
-    sector_start_addr = E_EEPROM_XMC4_SECTOR0_START_ADDR +
-            (E_EEPROM_XMC4_SECTOR_SIZE * e_eeprom_xmc4_sector_info.current_sector);
 
-    /* If the next free address crosses current active sector starting address, then all the sectors are fully written*/
-    if ((e_eeprom_xmc4_sector_info.next_free_start_addr == sector_start_addr) &&
-            (e_eeprom_xmc4_data_buffer.block_cycle_count != 0U))
+    /* The commit in progress holds an older snapshot of the RAM buffer */
+    do
     {
-        /* Update the current sector to the latest sector on which the last write was executed. */
-        e_eeprom_xmc4_sector_info.current_sector =  ((e_eeprom_xmc4_sector_info.flash_data_addr &
-                E_EEPROM_XMC4_SECTOR_POSITION_MASK) >>
-                E_EEPROM_XMC4_SECTOR_POSITION);
-
-        /* Mark all the sectors as filled with data */
-        e_eeprom_xmc4_sector_info.erase_state = E_EEPROM_XMC4_ALL_SECTORS_FILLED ;
+        status = E_EEPROM_XMC4_CommitPoll(handle);
+    } while (status == E_EEPROM_XMC4_STATUS_BUSY);
 
-        /* Execute erase state machine to free up the unwanted sectors and keep only the sector which has latest block*/
-        status = E_EEPROM_XMC4_lInitEraseStateMachine();
-    }
+    status = E_EEPROM_XMC4_CommitBegin(handle);
 
-    if (status ==  E_EEPROM_XMC4_STATUS_OK)
+    if (status == E_EEPROM_XMC4_STATUS_OK)
     {
-        e_eeprom_xmc4_data_buffer.block_cycle_count++;
-
-        status = E_EEPROM_XMC4_lWriteToFlash();
-
-        /* If the flash write succeeds, update the latest flash data location in RAM for reference */
-        if (status == E_EEPROM_XMC4_STATUS_OK)
-        {
-            e_eeprom_xmc4_sector_info.flash_data_addr = e_eeprom_xmc4_sector_info.next_free_start_addr;
-        }
-
-        /* Update the next free address to write the new data block*/
-        e_eeprom_xmc4_sector_info.next_free_start_addr += E_EEPROM_XMC4_ACTUAL_FLASH_BLOCK_SIZE;
-
-        /* If the next free address crosses 3rd sector end address relocate the address to 0th sector starting address*/
-        if (e_eeprom_xmc4_sector_info.next_free_start_addr >= E_EEPROM_XMC4_SECTOR4_START_ADDR)
+        do
         {
-            e_eeprom_xmc4_sector_info.next_free_start_addr = E_EEPROM_XMC4_SECTOR0_START_ADDR;
-        }
+            status = E_EEPROM_XMC4_CommitPoll(handle);
+        } while (status == E_EEPROM_XMC4_STATUS_BUSY);
     }
 
     return (status);
 }
 
 /*******************************************************************************
- * Function Name: E_EEPROM_XMC4_IsFlashEmpty
+ * Function Name: E_EEPROM_XMC4_CommitBegin
  ********************************************************************************
  * Summary:
- * Check at least one data block is available in the flash emulated EEPROM.
+ * Starts programming a snapshot of the RAM buffer into the emulated area of the
+ * FLASH. The record is selected and its CRC calculated as by
+ * E_EEPROM_XMC4_UpdateFlashContents(), the pages are programmed by
+ * E_EEPROM_XMC4_CommitPoll().
  *
  * Parameters:
- * void
+ * handle - e_eeprom handle
  *
  * Return:
- * bool
+ * E_EEPROM_XMC4_STATUS_t
  *
  *******************************************************************************/
-bool E_EEPROM_XMC4_IsFlashEmpty(void)
+E_EEPROM_XMC4_STATUS_t E_EEPROM_XMC4_CommitBegin(E_EEPROM_XMC4_t *const handle)
 {
-    bool status = false;
+    E_EEPROM_XMC4_DATA_t *const data_ptr = handle->data_ptr;
+    E_EEPROM_XMC4_STATUS_t status;
+    uint32_t sector;
+    uint32_t page_bitmap;
+    uint32_t page_count;
+    uint32_t record_size;
 
-    /* If data available flash_data_addr will have a valid address*/
-    if (e_eeprom_xmc4_sector_info.flash_data_addr == 0U)
+    if (data_ptr->commit_state.busy == (bool)true)
     {
-        status = true;
+        return (E_EEPROM_XMC4_STATUS_BUSY);
+    }
+
+    status = E_EEPROM_XMC4_STATUS_OK;
+    page_count = E_EEPROM_XMC4_FLASH_SLOT_SIZE >> E_EEPROM_XMC4_PAGE_POSITION;
+
+    /* Find the dirty pages which differ from the flash */
+    page_bitmap = E_EEPROM_XMC4_lGetChangedPages(handle);
+
+    /* Nothing to write if the flash already holds the RAM buffer */
+    if ((page_bitmap == 0U) && (data_ptr->sector_info.flash_data_addr != E_EEPROM_XMC4_EMPTY))
+    {
+        E_EEPROM_XMC4_lClearDirtyPages(handle);
+        data_ptr->flush_state.last_status = status;
+        return (status);
+    }
+
+    /* The flash gets modified, the state is sealed again after a successful update */
+    E_EEPROM_XMC4_lUnsealWarmState(handle);
+
+    /* Write a delta record if it is smaller than the data block and fits into the sector of its full data block,
+     * else write the full data block.
+     */
+    record_size = (E_EEPROM_XMC4_lGetPageCount(page_bitmap) + 1U) << E_EEPROM_XMC4_PAGE_POSITION;
+
+    if ((data_ptr->sector_info.flash_data_addr == E_EEPROM_XMC4_EMPTY) ||
+            (data_ptr->sector_info.page_count != page_count) ||
+            (data_ptr->sector_info.delta_count >= E_EEPROM_XMC4_MAX_DELTA_RECORDS) ||
+            (record_size >= E_EEPROM_XMC4_FLASH_SLOT_SIZE) ||
+            (data_ptr->sector_info.next_free_start_addr <= data_ptr->sector_info.base_addr) ||
+            ((data_ptr->sector_info.next_free_start_addr + record_size) >
+                    E_EEPROM_XMC4_lGetSectorEndAddr(handle, data_ptr->sector_info.base_addr)))
+    {
+        page_bitmap = 0U;
+        record_size = E_EEPROM_XMC4_FLASH_SLOT_SIZE;
+
+        /* Start the next sector if the full data block does not fit into the current one */
+        E_EEPROM_XMC4_lAlignNextFreeAddr(handle, record_size);
+    }
+
+    /* Sector to which the record is written */
+    sector = E_EEPROM_XMC4_lGetSector(handle, data_ptr->sector_info.next_free_start_addr);
+
+    /* A record starting a sector which was not erased by E_EEPROM_XMC4_EraseStep() has to wait for the erase */
+    if ((data_ptr->sector_info.next_free_start_addr == E_EEPROM_XMC4_SECTOR_LIST[sector].start_addr) &&
+            (((data_ptr->sector_info.erase_state >> sector) & 1U) != 0U))
+    {
+        status = E_EEPROM_XMC4_lEraseSector(handle, sector);
     }
+
+    if (status ==  E_EEPROM_XMC4_STATUS_OK)
+    {
+        /* Increment the block cycle count and record the number of pages of the record */
+        data_ptr->data_buffer.block_cycle_count = ((data_ptr->data_buffer.block_cycle_count + 1U) &
+                E_EEPROM_XMC4_BCC_COUNT_MASK) |
+                ((record_size >> E_EEPROM_XMC4_PAGE_POSITION) << E_EEPROM_XMC4_BCC_PAGES_POSITION);
+
+        data_ptr->commit_state.record_addr = data_ptr->sector_info.next_free_start_addr;
+
+        /* The sector has to be erased before it is used again, even if the record is not completely programmed */
+        data_ptr->sector_info.erase_state |= ((uint32_t)1U << sector);
+
+        if (page_bitmap != 0U)
+        {
+            data_ptr->data_buffer.block_cycle_count |= E_EEPROM_XMC4_BCC_DELTA_RECORD;
+        }
+
+        E_EEPROM_XMC4_lPrepareRecord(handle, page_bitmap);
+
+        /* The space of the record is taken, even if the record is not completely programmed */
+        data_ptr->sector_info.next_free_start_addr += record_size;
+
+        /* If the record filled the sector, the next record is written to the next sector */
+        if (data_ptr->sector_info.next_free_start_addr ==
+                E_EEPROM_XMC4_lGetSectorEndAddr(handle, data_ptr->commit_state.record_addr))
+        {
+            data_ptr->sector_info.next_free_start_addr = E_EEPROM_XMC4_lGetNextSectorAddr(handle, sector);
+        }
+
+        data_ptr->commit_state.dirty_bytes = data_ptr->flush_state.dirty_bytes;
+        data_ptr->commit_state.busy = true;
+
+#ifndef E_EEPROM_XMC4_FLASH_READ_ENABLED
+        /* Changes of the RAM buffer from now on are programmed by the next commit */
+        E_EEPROM_XMC4_lClearDirtyPages(handle);
+#endif
+    }
+    else
+    {
+        data_ptr->flush_state.last_status = status;
+    }
+
     return (status);
 }
 
 /*******************************************************************************
- * Function Name: E_EEPROM_XMC4_lWriteToFlash
+ * Function Name: E_EEPROM_XMC4_CommitPoll
  ********************************************************************************
  * Summary:
- * Local function to program data blocks from RAM into FLASH
+ * Programs the next page of the commit started by E_EEPROM_XMC4_CommitBegin(),
+ * the header page first. The record is valid once its last page is programmed.
  *
  * Parameters:
- * void
+ * handle - e_eeprom handle
  *
  * Return:
  * E_EEPROM_XMC4_STATUS_t
  *
  *******************************************************************************/
-static E_EEPROM_XMC4_STATUS_t E_EEPROM_XMC4_lWriteToFlash(void)
+E_EEPROM_XMC4_STATUS_t E_EEPROM_XMC4_CommitPoll(E_EEPROM_XMC4_t *const handle)
 {
-    uint32_t *flash_addr_ptr;
-    uint32_t *ram_addr_ptr;
-    uint32_t  page_index;
+    E_EEPROM_XMC4_DATA_t *const data_ptr = handle->data_ptr;
     E_EEPROM_XMC4_STATUS_t status;
+    uint32_t page_index;
 
     status = E_EEPROM_XMC4_STATUS_OK;
-    flash_addr_ptr = (uint32_t*)e_eeprom_xmc4_sector_info.next_free_start_addr;
-    ram_addr_ptr   = (uint32_t*)(void*)&e_eeprom_xmc4_data_buffer;
 
-    e_eeprom_xmc4_data_buffer.crc = E_EEPROM_XMC4_lCalculateCRC((uint32_t*)(void*)
-            (&(e_eeprom_xmc4_data_buffer.block_cycle_count)));
-
-    for (page_index = 0U ; page_index < E_EEPROM_XMC4_MAX_PAGES; page_index++)
+    if (data_ptr->commit_state.busy == (bool)true)
     {
+        /* The page buffer holds the header page, the other pages follow in ascending order */
+        if (data_ptr->commit_state.header_pending == (bool)true)
+        {
+            data_ptr->commit_state.header_pending = false;
+        }
+        else
+        {
+            page_index = 0U;
+            while (((data_ptr->commit_state.pending_pages >> page_index) & 1U) == 0U)
+            {
+                page_index++;
+            }
+            data_ptr->commit_state.pending_pages &= ~((uint32_t)1U << page_index);
+
+            E_EEPROM_XMC4_lCopyCommitPage(handle, page_index);
+        }
+
         XMC_FLASH_ClearStatus();
 
-        XMC_FLASH_ProgramPage(flash_addr_ptr,ram_addr_ptr);
+        XMC_FLASH_ProgramPage((uint32_t*)data_ptr->commit_state.flash_addr, data_ptr->page_buffer);
 
         if (XMC_FLASH_GetStatus() == (uint32_t)XMC_FLASH_STATUS_VERIFY_ERROR)
         {
             status = E_EEPROM_XMC4_STATUS_WRITE_ERROR;
-            break;
         }
-        ram_addr_ptr   += E_EEPROM_XMC4_MIN_WORDS_PER_PAGE ;
-        flash_addr_ptr += E_EEPROM_XMC4_MIN_WORDS_PER_PAGE ;
+        data_ptr->commit_state.flash_addr += E_EEPROM_XMC4_PAGE_SIZE;
+
+        if ((status != E_EEPROM_XMC4_STATUS_OK) || (data_ptr->commit_state.pending_pages == 0U))
+        {
+            E_EEPROM_XMC4_lFinishCommit(handle, status);
+        }
+        else
+        {
+            status = E_EEPROM_XMC4_STATUS_BUSY;
+        }
     }
 
     return (status);
 }
 
 /*******************************************************************************
- * Function Name: E_EEPROM_XMC4_lInitReadSectorInfo
+ * Function Name: E_EEPROM_XMC4_IsFlashEmpty
  ********************************************************************************
  * Summary:
- * Read sector info
+ * Check at least one data block is available in the flash emulated EEPROM.
  *
  * Parameters:
- * sector
+ * handle - e_eeprom handle
  *
  * Return:
- * void
+ * bool
  *
  *******************************************************************************/
-static void E_EEPROM_XMC4_lInitReadSectorInfo(const uint32_t sector)
+bool E_EEPROM_XMC4_IsFlashEmpty(E_EEPROM_XMC4_t *const handle)
 {
-    uint32_t block_read_addr;
-    uint32_t sector_start_addr;
-    uint32_t free_block_addr;
-    uint32_t *data_ptr;
-    uint32_t block_cycle_count;
-    uint32_t written_crc;
-    uint32_t calculated_crc;
-
-    /* Initialize starting address and last block address of the sector. */
-    sector_start_addr = E_EEPROM_XMC4_SECTOR0_START_ADDR + (E_EEPROM_XMC4_SECTOR_SIZE * (uint32_t)sector);
-    block_read_addr = (sector_start_addr + E_EEPROM_XMC4_SECTOR_SIZE) - E_EEPROM_XMC4_ACTUAL_FLASH_BLOCK_SIZE;
-    free_block_addr = E_EEPROM_XMC4_EMPTY;
+    E_EEPROM_XMC4_DATA_t *const data_ptr = handle->data_ptr;
+    bool status = false;
 
-    do
+    /* If data available flash_data_addr will have a valid address*/
+    if (data_ptr->sector_info.flash_data_addr == 0U)
     {
-        /* Read first 32 bit data from the block which indicates the block cycle counter. */
-        data_ptr = (uint32_t*)block_read_addr;
-        block_cycle_count = *(data_ptr + E_EEPROM_XMC4_BCC_OFFSET);
-
-        /* Check if block cycle count is a non zero value*/
-        if (block_cycle_count != E_EEPROM_XMC4_EMPTY)
-        {
-            /* Mark sector as non-empty sector*/
-            e_eeprom_xmc4_sector_info.erase_state |= ((uint32_t)1U << sector);
-
-            /* If this is the first non empty block identified, then store the address as next free address */
-            if (free_block_addr == E_EEPROM_XMC4_EMPTY)
-            {
-                free_block_addr = block_read_addr + E_EEPROM_XMC4_ACTUAL_FLASH_BLOCK_SIZE;
-            }
-
-            /* Read the second 32bit data which indicates the CRC */
-            written_crc = *data_ptr;
-            /* Calculate the CRC for the written data in flash (3rd word to the last word)*/
-            calculated_crc = E_EEPROM_XMC4_lCalculateCRC(data_ptr + E_EEPROM_XMC4_BCC_OFFSET);
-
-            if (calculated_crc == written_crc)
-            {
-                /* If both CRC matches and the current block cycle counter is greater than the previous recorded value,
-                 * Update the Data structure with the current block as the "latest" one and the current sector as "active".
-                 * Exit from the function.
-                 */
-                if (block_cycle_count > e_eeprom_xmc4_data_buffer.block_cycle_count)
-                {
-                    e_eeprom_xmc4_data_buffer.block_cycle_count = block_cycle_count;
-                    e_eeprom_xmc4_sector_info.current_sector = sector;
-                    e_eeprom_xmc4_sector_info.flash_data_addr = block_read_addr;
-                    e_eeprom_xmc4_sector_info.next_free_start_addr = free_block_addr;
-                    break;
-                }
-            }
-        }
-        /* Move the block read address to one block size up starting from the bottom of sector */
-        block_read_addr -= E_EEPROM_XMC4_ACTUAL_FLASH_BLOCK_SIZE;
-
-        /* Iterate the read process until the block read address crosses sector start address or a
-         * latest valid block is identified.
-         */
-    } while ( block_read_addr >= sector_start_addr );
-
+        status = true;
+    }
+    return (status);
 }
 
 /*******************************************************************************
- * Function Name: E_EEPROM_XMC4_lInitEraseStateMachine
+ * Function Name: E_EEPROM_XMC4_Tick
  ********************************************************************************
  * Summary:
- * Init erase state machine
+ * Advances the time of the E_EEPROM_XMC4_FLUSH_QUIESCENCE flush policy and
+ * programs the dirty pages once no data was changed for the configured time.
  *
  * Parameters:
- * void
+ * handle - e_eeprom handle
+ * elapsed_ms - Time in ms since the last call
  *
  * Return:
  * E_EEPROM_XMC4_STATUS_t
  *
  *******************************************************************************/
-static E_EEPROM_XMC4_STATUS_t E_EEPROM_XMC4_lInitEraseStateMachine(void)
+E_EEPROM_XMC4_STATUS_t E_EEPROM_XMC4_Tick(E_EEPROM_XMC4_t *const handle, uint32_t elapsed_ms)
 {
-    uint32_t sector_count;
-    uint32_t sector_start_addr;
-    E_EEPROM_XMC4_STATUS_t status ;
+    E_EEPROM_XMC4_DATA_t *const data_ptr = handle->data_ptr;
+    E_EEPROM_XMC4_STATUS_t status;
 
     status = E_EEPROM_XMC4_STATUS_OK;
-    sector_count = 0U;
 
-    do
+    if ((data_ptr->flush_state.policy == E_EEPROM_XMC4_FLUSH_QUIESCENCE) &&
+            (data_ptr->flush_state.dirty_pages != 0U))
     {
-        /* If the non empty sector is the current active sector, then do not erase it*/
-        if (e_eeprom_xmc4_sector_info.current_sector != sector_count)
-        {
-            /* Check if the sector was previously identified as non-empty. i.e It is having old data or corrupted data
-             * If so erase the sector and mark it as erase attempted.
-             */
-            if ((e_eeprom_xmc4_sector_info.erase_state >> sector_count) & ((uint32_t)1U))
-            {
-                sector_start_addr = E_EEPROM_XMC4_SECTOR0_START_ADDR + (E_EEPROM_XMC4_SECTOR_SIZE * (uint32_t)sector_count);
+        data_ptr->flush_state.quiet_elapsed += elapsed_ms;
 
-                XMC_FLASH_ClearStatus();
-                XMC_FLASH_EraseSector((uint32_t*)sector_start_addr);
+        if (data_ptr->flush_state.quiet_elapsed >= data_ptr->flush_state.quiet_time)
+        {
+            /* A failed update is retried after another quiet time */
+            data_ptr->flush_state.quiet_elapsed = 0U;
 
-                if (XMC_FLASH_GetStatus() != (uint32_t)XMC_FLASH_STATUS_ERASE_STATE)
-                {
-                    status = E_EEPROM_XMC4_STATUS_ERASE_ERROR;
-                    break;
-                }
-                e_eeprom_xmc4_sector_info.erase_state &= ~(((uint32_t)1U << sector_count));
-            }
+            status = E_EEPROM_XMC4_UpdateFlashContents(handle);
         }
-        sector_count++;
-        /* Iterate the erase loop until all 4 sectors are checked. Break and return failure on any sector erase errors.*/
-    } while ( sector_count < E_EEPROM_XMC4_MAX_SECTORS );
+    }
 
     return (status);
 }
 
 /*******************************************************************************
- * Function Name: E_EEPROM_XMC4_lCalculateCRC
+ * Function Name: E_EEPROM_XMC4_GetFlushInfo
  ********************************************************************************
  * Summary:
- * Local function to CRC
+ * Reads the dirty state and the block cycle count of the last update.
  *
  * Parameters:
- * data_start_addr - Data start address
+ * handle - e_eeprom handle
+ * info - Structure receiving the information
  *
  * Return:
- * uint32_t
+ * void
  *
  *******************************************************************************/
-static uint32_t E_EEPROM_XMC4_lCalculateCRC(const uint32_t *data_start_addr)
+void E_EEPROM_XMC4_GetFlushInfo(E_EEPROM_XMC4_t *const handle, E_EEPROM_XMC4_FLUSH_INFO_t *const info)
 {
-    uint32_t result;
-
-    /* Reset the CRC result register before new CRC calculation */
-    XMC_FCE_InitializeSeedValue(&e_eeprom_xmc4_fce, 0U);
+    E_EEPROM_XMC4_DATA_t *const data_ptr = handle->data_ptr;
 
-    (void)XMC_FCE_CalculateCRC32(&e_eeprom_xmc4_fce, data_start_addr, E_EEPROM_XMC4_DATA_SIZE_FOR_CRC, &result);
+    XMC_ASSERT("E_EEPROM_XMC4_GetFlushInfo:Invalid info Pointer", (info != NULL))
 
-    return (result);
+    info->dirty_pages = data_ptr->flush_state.dirty_pages;
+    info->dirty_bytes = data_ptr->flush_state.dirty_bytes;
+    info->cycle_count = data_ptr->data_buffer.block_cycle_count & E_EEPROM_XMC4_BCC_COUNT_MASK;
+    info->last_status = data_ptr->flush_state.last_status;
 }
 
 /*******************************************************************************
- * Function Name: E_EEPROM_XMC4_lCopyFlashToRam
+ * Function Name: E_EEPROM_XMC4_GetInitInfo
  ********************************************************************************
  * Summary:
- * Local function to copy data blocks from FLASH to RAM
+ * Reads the cost of the search for the latest record by the last
+ * initialization.
  *
  * Parameters:
+ * handle - e_eeprom handle
+ * info - Structure receiving the information
+ *
+ * Return:
+ * void
+ *
+ *******************************************************************************/
+void E_EEPROM_XMC4_GetInitInfo(E_EEPROM_XMC4_t *const handle, E_EEPROM_XMC4_INIT_INFO_t *const info)
+{
+    E_EEPROM_XMC4_DATA_t *const data_ptr = handle->data_ptr;
+
+    XMC_ASSERT("E_EEPROM_XMC4_GetInitInfo:Invalid info Pointer", (info != NULL))
+
+    *info = data_ptr->init_info;
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC4_EraseStep
+ ********************************************************************************
+ * Summary:
+ * Erases one sector holding only old records, starting with the sector the next
+ * records are written to. Call it in idle time, so that the updates do not have
+ * to wait for a sector erase. Nothing is erased while a commit is in progress.
+ *
+ * Parameters:
+ * handle - e_eeprom handle
+ *
+ * Return:
+ * E_EEPROM_XMC4_STATUS_t
+ *
+ *******************************************************************************/
+E_EEPROM_XMC4_STATUS_t E_EEPROM_XMC4_EraseStep(E_EEPROM_XMC4_t *const handle)
+{
+    E_EEPROM_XMC4_DATA_t *const data_ptr = handle->data_ptr;
+    E_EEPROM_XMC4_STATUS_t status;
+    uint32_t stale_sectors;
+    uint32_t sector;
+    bool sealed;
+
+    status = E_EEPROM_XMC4_STATUS_OK;
+    stale_sectors = E_EEPROM_XMC4_lGetStaleSectors(handle);
+
+    /* The sector of the record being programmed is not yet the sector of the latest record */
+    if (data_ptr->commit_state.busy == (bool)true)
+    {
+        status = E_EEPROM_XMC4_STATUS_BUSY;
+    }
+    else if (stale_sectors != 0U)
+    {
+        /* Records are written in the order of the sectors, so the sector of the next free address is needed first */
+        sector = E_EEPROM_XMC4_lGetSector(handle, data_ptr->sector_info.next_free_start_addr);
+
+        while (((stale_sectors >> sector) & 1U) == 0U)
+        {
+            sector = (sector + 1U) % E_EEPROM_XMC4_SECTOR_COUNT;
+        }
+
+        /* The sealed state still marks the sector, hence a reset during the erase repeats it. The RAM buffer may
+         * hold changes not programmed yet, so only the seal of the sector info is renewed.
+         */
+        sealed = E_EEPROM_XMC4_lIsWarmSealed(handle);
+
+        status = E_EEPROM_XMC4_lEraseSector(handle, sector);
+
+        if ((status == E_EEPROM_XMC4_STATUS_OK) && (sealed == (bool)true))
+        {
+            E_EEPROM_XMC4_lResealSectorInfo(handle);
+        }
+    }
+
+    return (status);
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC4_IsErasePending
+ ********************************************************************************
+ * Summary:
+ * Check if a sector holding only old records is waiting for its erase.
+ *
+ * Parameters:
+ * handle - e_eeprom handle
+ *
+ * Return:
+ * bool
+ *
+ *******************************************************************************/
+bool E_EEPROM_XMC4_IsErasePending(E_EEPROM_XMC4_t *const handle)
+{
+    return (E_EEPROM_XMC4_lGetStaleSectors(handle) != 0U);
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC4_lMarkDirty
+ ********************************************************************************
+ * Summary:
+ * Local function to mark the page of a changed byte as dirty and restart the
+ * quiet time.
+ *
+ * Parameters:
+ * handle - e_eeprom handle
+ * offset_address - Offset of the changed byte in the data block
+ *
+ * Return:
+ * void
+ *
+ *******************************************************************************/
+static void E_EEPROM_XMC4_lMarkDirty(E_EEPROM_XMC4_t *const handle, uint32_t offset_address)
+{
+    E_EEPROM_XMC4_DATA_t *const data_ptr = handle->data_ptr;
+
+    data_ptr->flush_state.dirty_pages |= (uint32_t)1U << ((offset_address + E_EEPROM_XMC4_HEADER_SIZE) >>
+            E_EEPROM_XMC4_PAGE_POSITION);
+    data_ptr->flush_state.dirty_bytes++;
+    data_ptr->flush_state.quiet_elapsed = 0U;
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC4_lApplyFlushPolicy
+ ********************************************************************************
+ * Summary:
+ * Local function to program the dirty pages after a write, if the flush policy
+ * is E_EEPROM_XMC4_FLUSH_IMMEDIATE or the changed bytes reached the limit of
+ * E_EEPROM_XMC4_FLUSH_DIRTY_BYTES. The status is kept for
+ * E_EEPROM_XMC4_GetFlushInfo().
+ *
+ * Parameters:
+ * handle - e_eeprom handle
+ *
+ * Return:
+ * void
+ *
+ *******************************************************************************/
+static void E_EEPROM_XMC4_lApplyFlushPolicy(E_EEPROM_XMC4_t *const handle)
+{
+    E_EEPROM_XMC4_DATA_t *const data_ptr = handle->data_ptr;
+
+    if ((data_ptr->flush_state.policy == E_EEPROM_XMC4_FLUSH_IMMEDIATE) ||
+            ((data_ptr->flush_state.policy == E_EEPROM_XMC4_FLUSH_DIRTY_BYTES) &&
+            (data_ptr->flush_state.dirty_bytes >= data_ptr->flush_state.dirty_bytes_limit)))
+    {
+        (void)E_EEPROM_XMC4_UpdateFlashContents(handle);
+    }
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC4_lPrepareRecord
+ ********************************************************************************
+ * Summary:
+ * Local function to place the header page of the record into the page buffer
+ * and calculate the CRC of the record over the pages of the RAM buffer. A full
+ * data block starts with its first page, a delta record with a page holding the
+ * changed pages and the full data block they refer to.
+ *
+ * Parameters:
+ * handle - e_eeprom handle
+ * page_bitmap - One bit per changed page of the data block, 0 for a full data block
+ *
+ * Return:
+ * void
+ *
+ *******************************************************************************/
+static void E_EEPROM_XMC4_lPrepareRecord(E_EEPROM_XMC4_t *const handle, uint32_t page_bitmap)
+{
+    E_EEPROM_XMC4_DATA_t *const data_ptr = handle->data_ptr;
+    uint32_t page_index;
+    uint32_t page_count;
+    uint32_t crc;
+
+    data_ptr->commit_state.flash_addr = data_ptr->commit_state.record_addr;
+    data_ptr->commit_state.header_pending = true;
+
+    if (page_bitmap == 0U)
+    {
+        page_count = E_EEPROM_XMC4_FLASH_SLOT_SIZE >> E_EEPROM_XMC4_PAGE_POSITION;
+        data_ptr->commit_state.record_pages = ((uint32_t)0xFFFFFFFFU) >> (E_EEPROM_XMC4_MAX_PAGES - page_count);
+        data_ptr->commit_state.pending_pages = data_ptr->commit_state.record_pages & ~(uint32_t)1U;
+
+        /* The first page gets the header of the new data block */
+        (void)memcpy(data_ptr->page_buffer, E_EEPROM_XMC4_lGetPageData(handle, 0U), E_EEPROM_XMC4_PAGE_SIZE);
+        data_ptr->page_buffer[E_EEPROM_XMC4_BCC_OFFSET] = data_ptr->data_buffer.block_cycle_count;
+    }
+    else
+    {
+        data_ptr->commit_state.record_pages = page_bitmap;
+        data_ptr->commit_state.pending_pages = page_bitmap;
+
+        (void)memset(data_ptr->page_buffer, 0, sizeof(data_ptr->page_buffer));
+        data_ptr->page_buffer[E_EEPROM_XMC4_BCC_OFFSET] = data_ptr->data_buffer.block_cycle_count;
+        data_ptr->page_buffer[E_EEPROM_XMC4_DELTA_BITMAP_OFFSET] = page_bitmap;
+        data_ptr->page_buffer[E_EEPROM_XMC4_DELTA_BASE_OFFSET] = data_ptr->sector_info.base_addr;
+    }
+
+    /* The CRC covers the record as it is placed in flash, from the block cycle count to the last page */
+    XMC_FCE_InitializeSeedValue(&e_eeprom_xmc4_fce, 0U);
+    (void)XMC_FCE_CalculateCRC32(&e_eeprom_xmc4_fce, &data_ptr->page_buffer[E_EEPROM_XMC4_BCC_OFFSET],
+            E_EEPROM_XMC4_PAGE_SIZE - (uint32_t)4U, &crc);
+    for (page_index = 0U; page_index < E_EEPROM_XMC4_MAX_PAGES; page_index++)
+    {
+        if (((data_ptr->commit_state.pending_pages >> page_index) & 1U) != 0U)
+        {
+            (void)XMC_FCE_CalculateCRC32(&e_eeprom_xmc4_fce, E_EEPROM_XMC4_lGetPageData(handle, page_index),
+                    E_EEPROM_XMC4_PAGE_SIZE, &crc);
+        }
+    }
+    data_ptr->page_buffer[0] = crc;
+
+    if (page_bitmap == 0U)
+    {
+        data_ptr->data_buffer.crc = crc;
+    }
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC4_lCopyCommitPage
+ ********************************************************************************
+ * Summary:
+ * Local function to copy a page of the snapshot into the page buffer. A page
+ * changed after E_EEPROM_XMC4_CommitBegin() is taken from its shadow page,
+ * which is freed.
+ *
+ * Parameters:
+ * handle - e_eeprom handle
+ * page_index - Page of the data block
+ *
+ * Return:
+ * void
+ *
+ *******************************************************************************/
+static void E_EEPROM_XMC4_lCopyCommitPage(E_EEPROM_XMC4_t *const handle, uint32_t page_index)
+{
+    E_EEPROM_XMC4_DATA_t *const data_ptr = handle->data_ptr;
+    const uint32_t *page_ptr;
+#ifndef E_EEPROM_XMC4_FLASH_READ_ENABLED
+    uint32_t slot;
+#endif
+
+    page_ptr = E_EEPROM_XMC4_lGetPageData(handle, page_index);
+
+#ifndef E_EEPROM_XMC4_FLASH_READ_ENABLED
+    for (slot = 0U; slot < E_EEPROM_XMC4_SHADOW_PAGES; slot++)
+    {
+        if (data_ptr->commit_state.shadow_page[slot] == page_index)
+        {
+            page_ptr = data_ptr->commit_state.shadow[slot];
+            data_ptr->commit_state.shadow_page[slot] = E_EEPROM_XMC4_MAX_PAGES;
+        }
+    }
+#endif
+
+    (void)memcpy(data_ptr->page_buffer, page_ptr, E_EEPROM_XMC4_PAGE_SIZE);
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC4_lFinishCommit
+ ********************************************************************************
+ * Summary:
+ * Local function to end the commit. If the record is programmed, it becomes the
+ * latest record. Else the pages of the snapshot stay dirty for the next commit.
+ * The status is kept for E_EEPROM_XMC4_GetFlushInfo().
+ *
+ * Parameters:
+ * handle - e_eeprom handle
+ * status - Status of the commit
+ *
+ * Return:
+ * void
+ *
+ *******************************************************************************/
+static void E_EEPROM_XMC4_lFinishCommit(E_EEPROM_XMC4_t *const handle, E_EEPROM_XMC4_STATUS_t status)
+{
+    E_EEPROM_XMC4_DATA_t *const data_ptr = handle->data_ptr;
+    uint32_t record_addr;
+
+    record_addr = data_ptr->commit_state.record_addr;
+
+    data_ptr->commit_state.busy = false;
+    data_ptr->commit_state.pending_pages = 0U;
+    E_EEPROM_XMC4_lFreeShadowPages(handle);
+
+    /* If the flash write succeeds, update the latest flash data location in RAM for reference */
+    if (status == E_EEPROM_XMC4_STATUS_OK)
+    {
+        data_ptr->sector_info.flash_data_addr = record_addr;
+
+        if ((data_ptr->data_buffer.block_cycle_count & E_EEPROM_XMC4_BCC_DELTA_RECORD) == 0U)
+        {
+            data_ptr->sector_info.base_addr = record_addr;
+            data_ptr->sector_info.delta_count = 0U;
+            data_ptr->sector_info.page_count = E_EEPROM_XMC4_lGetPageCount(data_ptr->commit_state.record_pages);
+
+            /* The other sectors hold only older records from now on */
+            data_ptr->sector_info.current_sector = E_EEPROM_XMC4_lGetSector(handle, record_addr);
+        }
+        else
+        {
+            data_ptr->sector_info.delta_count++;
+        }
+
+        E_EEPROM_XMC4_lApplyRecord(data_ptr->sector_info.page_addr, record_addr);
+
+#ifdef E_EEPROM_XMC4_FLASH_READ_ENABLED
+        E_EEPROM_XMC4_lClearDirtyPages(handle);
+#endif
+
+        /* Changes made during the commit are not in the flash yet */
+        if (data_ptr->flush_state.dirty_pages == 0U)
+        {
+            E_EEPROM_XMC4_lSealWarmState(handle);
+        }
+    }
+    else
+    {
+        data_ptr->flush_state.dirty_pages |= data_ptr->commit_state.record_pages;
+        data_ptr->flush_state.dirty_bytes += data_ptr->commit_state.dirty_bytes;
+    }
+
+    data_ptr->flush_state.last_status = status;
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC4_lProtectPage
+ ********************************************************************************
+ * Summary:
+ * Local function to keep the snapshot of a commit in progress before a page of
+ * the data block gets changed. The page is saved in a shadow page if it is not
+ * programmed yet, E_EEPROM_XMC4_lCanWritePages() checked that one is free. If
+ * E_EEPROM_XMC4_FLASH_READ_ENABLED is defined, the staging pages hold the
+ * snapshot and no write is accepted during the commit, nothing is done.
+ *
+ * Parameters:
+ * handle - e_eeprom handle
+ * page_index - Page of the data block
+ *
+ * Return:
+ * void
+ *
+ *******************************************************************************/
+static void E_EEPROM_XMC4_lProtectPage(E_EEPROM_XMC4_t *const handle, uint32_t page_index)
+{
+#ifdef E_EEPROM_XMC4_FLASH_READ_ENABLED
+    (void)handle;
+    (void)page_index;
+#else
+    E_EEPROM_XMC4_DATA_t *const data_ptr = handle->data_ptr;
+    uint32_t slot;
+    uint32_t free_slot;
+
+    if (((data_ptr->commit_state.pending_pages >> page_index) & 1U) != 0U)
+    {
+        free_slot = E_EEPROM_XMC4_SHADOW_PAGES;
+
+        for (slot = 0U; slot < E_EEPROM_XMC4_SHADOW_PAGES; slot++)
+        {
+            if (data_ptr->commit_state.shadow_page[slot] == page_index)
+            {
+                break;
+            }
+            if (data_ptr->commit_state.shadow_page[slot] == E_EEPROM_XMC4_MAX_PAGES)
+            {
+                free_slot = slot;
+            }
+        }
+
+        if ((slot == E_EEPROM_XMC4_SHADOW_PAGES) && (free_slot != E_EEPROM_XMC4_SHADOW_PAGES))
+        {
+            (void)memcpy(data_ptr->commit_state.shadow[free_slot], E_EEPROM_XMC4_lGetPageData(handle, page_index),
+                    E_EEPROM_XMC4_PAGE_SIZE);
+            data_ptr->commit_state.shadow_page[free_slot] = page_index;
+        }
+    }
+#endif
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC4_lFreeShadowPages
+ ********************************************************************************
+ * Summary:
+ * Local function to free the shadow pages of the commit. Only done if
+ * E_EEPROM_XMC4_FLASH_READ_ENABLED is not defined.
+ *
+ * Parameters:
+ * handle - e_eeprom handle
+ *
+ * Return:
+ * void
+ *
+ *******************************************************************************/
+static void E_EEPROM_XMC4_lFreeShadowPages(E_EEPROM_XMC4_t *const handle)
+{
+#ifndef E_EEPROM_XMC4_FLASH_READ_ENABLED
+    E_EEPROM_XMC4_DATA_t *const data_ptr = handle->data_ptr;
+    uint32_t slot;
+
+    for (slot = 0U; slot < E_EEPROM_XMC4_SHADOW_PAGES; slot++)
+    {
+        data_ptr->commit_state.shadow_page[slot] = E_EEPROM_XMC4_MAX_PAGES;
+    }
+#else
+    (void)handle;
+#endif
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC4_lInitFindRecord
+ ********************************************************************************
+ * Summary:
+ * Local function to find the newest record below a given one, reading only the
+ * block cycle count of the records. Records are ordered by their block cycle
+ * count, records with the same count by their address. The sectors holding
+ * records are marked in the erase state.
+ *
+ * Parameters:
+ * handle - e_eeprom handle
+ * below_count - Block cycle count of the record to search below
+ * below_addr - Address of the record to search below
+ *
+ * Return:
+ * uint32_t - Address of the record, E_EEPROM_XMC4_EMPTY if there is none
+ *
+ *******************************************************************************/
+static uint32_t E_EEPROM_XMC4_lInitFindRecord(E_EEPROM_XMC4_t *const handle, uint32_t below_count, uint32_t below_addr)
+{
+    E_EEPROM_XMC4_DATA_t *const data_ptr = handle->data_ptr;
+    uint32_t sector;
+    uint32_t block_read_addr;
+    uint32_t sector_end_addr;
+    uint32_t block_cycle_count;
+    uint32_t record_size;
+    uint32_t found_addr;
+    uint32_t found_count;
+
+    found_addr = E_EEPROM_XMC4_EMPTY;
+    found_count = 0U;
+
+    for (sector = 0U; sector < E_EEPROM_XMC4_SECTOR_COUNT; sector++)
+    {
+        block_read_addr = E_EEPROM_XMC4_SECTOR_LIST[sector].start_addr;
+        sector_end_addr = block_read_addr + E_EEPROM_XMC4_SECTOR_LIST[sector].size;
+
+        /* Records are written one after the other from the start of the sector up to the first empty record */
+        while (block_read_addr < sector_end_addr)
+        {
+            block_cycle_count = *((uint32_t*)block_read_addr + E_EEPROM_XMC4_BCC_OFFSET);
+            data_ptr->init_info.headers_read++;
+
+            if (block_cycle_count == E_EEPROM_XMC4_EMPTY)
+            {
+                break;
+            }
+
+            /* Mark sector as non-empty sector*/
+            data_ptr->sector_info.erase_state |= ((uint32_t)1U << sector);
+
+            /* A corrupted header leaves the size of the record unknown, the rest of the sector is not used */
+            record_size = E_EEPROM_XMC4_lGetRecordSize(block_cycle_count);
+            if ((record_size == 0U) || ((block_read_addr + record_size) > sector_end_addr))
+            {
+                break;
+            }
+
+            block_cycle_count &= E_EEPROM_XMC4_BCC_COUNT_MASK;
+
+            if (((block_cycle_count < below_count) ||
+                    ((block_cycle_count == below_count) && (block_read_addr < below_addr))) &&
+                    ((found_addr == E_EEPROM_XMC4_EMPTY) || (block_cycle_count > found_count) ||
+                    ((block_cycle_count == found_count) && (block_read_addr > found_addr))))
+            {
+                found_addr = block_read_addr;
+                found_count = block_cycle_count;
+            }
+
+            block_read_addr += record_size;
+        }
+    }
+
+    return (found_addr);
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC4_lInitApplyRecords
+ ********************************************************************************
+ * Summary:
+ * Local function to verify a record found by E_EEPROM_XMC4_lInitFindRecord()
+ * and make it the latest record. A delta record is valid only on top of its
+ * full data block and is applied together with the valid delta records in
+ * between, no other valid full data block may be written in between. Only the
+ * records used are verified by their CRC.
+ *
+ * Parameters:
+ * handle - e_eeprom handle
+ * latest_addr - Address of the record
+ *
+ * Return:
+ * bool - true if the record is valid
+ *
+ *******************************************************************************/
+static bool E_EEPROM_XMC4_lInitApplyRecords(E_EEPROM_XMC4_t *const handle, uint32_t latest_addr)
+{
+    E_EEPROM_XMC4_DATA_t *const data_ptr = handle->data_ptr;
+    uint32_t sector;
+    uint32_t block_read_addr;
+    uint32_t sector_end_addr;
+    uint32_t block_cycle_count;
+    uint32_t record_size;
+    uint32_t base_addr;
+    uint32_t delta_count;
+    uint32_t page_count;
+    uint32_t page_addr[E_EEPROM_XMC4_MAX_PAGES];
+    bool valid;
+
+    sector = E_EEPROM_XMC4_lGetSector(handle, latest_addr);
+    block_read_addr = E_EEPROM_XMC4_SECTOR_LIST[sector].start_addr;
+    sector_end_addr = block_read_addr + E_EEPROM_XMC4_SECTOR_LIST[sector].size;
+    block_cycle_count = *((uint32_t*)latest_addr + E_EEPROM_XMC4_BCC_OFFSET);
+    delta_count = 0U;
+    page_count = 0U;
+
+    if ((block_cycle_count & E_EEPROM_XMC4_BCC_DELTA_RECORD) == 0U)
+    {
+        base_addr = latest_addr;
+    }
+    else
+    {
+        base_addr = *((uint32_t*)latest_addr + E_EEPROM_XMC4_DELTA_BASE_OFFSET);
+    }
+
+    valid = E_EEPROM_XMC4_lIsRecordValid(handle, latest_addr);
+
+    /* Walk through the records of the sector up to the first empty record, the end is the next free address */
+    while (block_read_addr < sector_end_addr)
+    {
+        block_cycle_count = *((uint32_t*)block_read_addr + E_EEPROM_XMC4_BCC_OFFSET);
+        data_ptr->init_info.headers_read++;
+
+        if (block_cycle_count == E_EEPROM_XMC4_EMPTY)
+        {
+            break;
+        }
+
+        record_size = E_EEPROM_XMC4_lGetRecordSize(block_cycle_count);
+        if ((record_size == 0U) || ((block_read_addr + record_size) > sector_end_addr))
+        {
+            block_read_addr = sector_end_addr;
+            break;
+        }
+
+        if ((valid == (bool)true) && (block_read_addr >= base_addr) && (block_read_addr <= latest_addr))
+        {
+            if (block_read_addr == base_addr)
+            {
+                /* The full data block the latest record refers to */
+                if (((block_cycle_count & E_EEPROM_XMC4_BCC_DELTA_RECORD) == 0U) &&
+                        ((block_read_addr == latest_addr) ||
+                        (E_EEPROM_XMC4_lIsRecordValid(handle, block_read_addr) == (bool)true)))
+                {
+                    E_EEPROM_XMC4_lApplyRecord(page_addr, block_read_addr);
+                    page_count = record_size >> E_EEPROM_XMC4_PAGE_POSITION;
+                }
+                else
+                {
+                    valid = false;
+                }
+            }
+            else if (block_read_addr == latest_addr)
+            {
+                E_EEPROM_XMC4_lApplyRecord(page_addr, block_read_addr);
+                delta_count++;
+            }
+            else if ((block_cycle_count & E_EEPROM_XMC4_BCC_DELTA_RECORD) == 0U)
+            {
+                /* A valid full data block in between would be the one the latest record refers to */
+                if (E_EEPROM_XMC4_lIsRecordValid(handle, block_read_addr) == (bool)true)
+                {
+                    valid = false;
+                }
+            }
+            else if ((*((uint32_t*)block_read_addr + E_EEPROM_XMC4_DELTA_BASE_OFFSET) == base_addr) &&
+                    (E_EEPROM_XMC4_lIsRecordValid(handle, block_read_addr) == (bool)true))
+            {
+                E_EEPROM_XMC4_lApplyRecord(page_addr, block_read_addr);
+                delta_count++;
+            }
+            else
+            {
+                /* Delta record not completely programmed */
+            }
+        }
+
+        /* Move the block read address to the next record */
+        block_read_addr += record_size;
+    }
+
+    /* The full data block has to be one of the records of the sector */
+    if (page_count == 0U)
+    {
+        valid = false;
+    }
+
+    /* Update the Data structure with the latest record and the current sector as "active" */
+    if (valid == (bool)true)
+    {
+        data_ptr->data_buffer.block_cycle_count = *((uint32_t*)latest_addr + E_EEPROM_XMC4_BCC_OFFSET);
+        data_ptr->sector_info.current_sector = sector;
+        data_ptr->sector_info.flash_data_addr = latest_addr;
+        data_ptr->sector_info.next_free_start_addr = block_read_addr;
+        data_ptr->sector_info.base_addr = base_addr;
+        data_ptr->sector_info.delta_count = delta_count;
+        data_ptr->sector_info.page_count = page_count;
+        (void)memcpy(data_ptr->sector_info.page_addr, page_addr, sizeof(page_addr));
+    }
+
+    return (valid);
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC4_lIsRecordValid
+ ********************************************************************************
+ * Summary:
+ * Local function to check the CRC of a record, calculated from the block cycle
+ * count to the last page of the record.
+ *
+ * Parameters:
+ * handle - e_eeprom handle
+ * record_addr - Start address of the record
+ *
+ * Return:
+ * bool - true if the CRC matches
+ *
+ *******************************************************************************/
+static bool E_EEPROM_XMC4_lIsRecordValid(E_EEPROM_XMC4_t *const handle, uint32_t record_addr)
+{
+    E_EEPROM_XMC4_DATA_t *const data_ptr = handle->data_ptr;
+    uint32_t *record_ptr;
+    uint32_t record_size;
+    bool valid;
+
+    valid = false;
+    record_ptr = (uint32_t*)record_addr;
+    record_size = E_EEPROM_XMC4_lGetRecordSize(*(record_ptr + E_EEPROM_XMC4_BCC_OFFSET));
+
+    data_ptr->init_info.records_checked++;
+    data_ptr->init_info.bytes_checked += record_size;
+
+    if (E_EEPROM_XMC4_lCalculateCRC(record_ptr + E_EEPROM_XMC4_BCC_OFFSET, record_size) == *record_ptr)
+    {
+        valid = true;
+    }
+
+    return (valid);
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC4_lEraseSector
+ ********************************************************************************
+ * Summary:
+ * Local function to erase a sector and clear it in the erase state. If the next
+ * free address lies in the sector, the next record is written from its start.
+ *
+ * Parameters:
+ * handle - e_eeprom handle
+ * sector - Sector to erase
+ *
+ * Return:
+ * E_EEPROM_XMC4_STATUS_t
+ *
+ *******************************************************************************/
+static E_EEPROM_XMC4_STATUS_t E_EEPROM_XMC4_lEraseSector(E_EEPROM_XMC4_t *const handle, uint32_t sector)
+{
+    E_EEPROM_XMC4_DATA_t *const data_ptr = handle->data_ptr;
+    uint32_t sector_start_addr;
+    E_EEPROM_XMC4_STATUS_t status;
+
+    status = E_EEPROM_XMC4_STATUS_OK;
+    sector_start_addr = E_EEPROM_XMC4_SECTOR_LIST[sector].start_addr;
+
+    XMC_FLASH_ClearStatus();
+    XMC_FLASH_EraseSector((uint32_t*)sector_start_addr);
+
+    if (XMC_FLASH_GetStatus() != (uint32_t)XMC_FLASH_STATUS_ERASE_STATE)
+    {
+        status = E_EEPROM_XMC4_STATUS_ERASE_ERROR;
+    }
+    else
+    {
+        data_ptr->sector_info.erase_state &= ~((uint32_t)1U << sector);
+
+        /* Records are found from the start of a sector only */
+        if ((data_ptr->sector_info.next_free_start_addr >= sector_start_addr) &&
+                (data_ptr->sector_info.next_free_start_addr <
+                        (sector_start_addr + E_EEPROM_XMC4_SECTOR_LIST[sector].size)))
+        {
+            data_ptr->sector_info.next_free_start_addr = sector_start_addr;
+        }
+    }
+
+    return (status);
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC4_lGetStaleSectors
+ ********************************************************************************
+ * Summary:
+ * Local function to find the sectors which hold only records older than the
+ * latest full data block and have to be erased before they are used again.
+ *
+ * Parameters:
+ * handle - e_eeprom handle
+ *
+ * Return:
+ * uint32_t - Bitmap of the sectors
+ *
+ *******************************************************************************/
+static uint32_t E_EEPROM_XMC4_lGetStaleSectors(E_EEPROM_XMC4_t *const handle)
+{
+    E_EEPROM_XMC4_DATA_t *const data_ptr = handle->data_ptr;
+    uint32_t stale_sectors;
+
+    stale_sectors = data_ptr->sector_info.erase_state;
+
+    /* The sector of the latest record is kept */
+    if (data_ptr->sector_info.flash_data_addr != E_EEPROM_XMC4_EMPTY)
+    {
+        stale_sectors &= ~((uint32_t)1U << E_EEPROM_XMC4_lGetSector(handle, data_ptr->sector_info.flash_data_addr));
+    }
+
+    return (stale_sectors);
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC4_lCalculateCRC
+ ********************************************************************************
+ * Summary:
+ * Local function to CRC
+ *
+ * Parameters:
+ * data_start_addr - Data start address
+ * record_size - Size of the record on flash
+ *
+ * Return:
+ * uint32_t
+ *
+ *******************************************************************************/
+static uint32_t E_EEPROM_XMC4_lCalculateCRC(const uint32_t *data_start_addr, uint32_t record_size)
+{
+    uint32_t result;
+
+    /* Reset the CRC result register before new CRC calculation */
+    XMC_FCE_InitializeSeedValue(&e_eeprom_xmc4_fce, 0U);
+
+    /* The CRC word itself is not covered */
+    (void)XMC_FCE_CalculateCRC32(&e_eeprom_xmc4_fce, data_start_addr, record_size - (uint32_t)4U, &result);
+
+    return (result);
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC4_lGetRecordSize
+ ********************************************************************************
+ * Summary:
+ * Local function to get the size of a record on flash from the number of pages
+ * recorded in its block cycle count word.
+ *
+ * Parameters:
+ * block_cycle_count - Block cycle count word of the record
+ *
+ * Return:
+ * uint32_t - Size of the record, 0 if the recorded size is invalid
+ *
+ *******************************************************************************/
+static uint32_t E_EEPROM_XMC4_lGetRecordSize(uint32_t block_cycle_count)
+{
+    uint32_t page_count;
+    uint32_t record_size;
+
+    page_count = block_cycle_count >> E_EEPROM_XMC4_BCC_PAGES_POSITION;
+
+    if ((page_count == 0U) && ((block_cycle_count & E_EEPROM_XMC4_BCC_DELTA_RECORD) == 0U))
+    {
+        record_size = E_EEPROM_XMC4_ACTUAL_FLASH_BLOCK_SIZE;
+    }
+    else if ((page_count != 0U) && (page_count <= E_EEPROM_XMC4_MAX_PAGES))
+    {
+        record_size = page_count << E_EEPROM_XMC4_PAGE_POSITION;
+    }
+    else
+    {
+        record_size = 0U;
+    }
+
+    return (record_size);
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC4_lGetSector
+ ********************************************************************************
+ * Summary:
+ * Local function to find the sector holding an address in E_EEPROM_XMC4_SECTORS.
+ *
+ * Parameters:
+ * handle - e_eeprom handle
+ * addr - Flash address within the emulated area
+ *
+ * Return:
+ * uint32_t - Index of the sector
+ *
+ *******************************************************************************/
+static uint32_t E_EEPROM_XMC4_lGetSector(E_EEPROM_XMC4_t *const handle, uint32_t addr)
+{
+    uint32_t sector;
+
+    /* The last sector is taken if no other sector holds the address */
+    for (sector = 0U; sector < (E_EEPROM_XMC4_SECTOR_COUNT - 1U); sector++)
+    {
+        if ((addr >= E_EEPROM_XMC4_SECTOR_LIST[sector].start_addr) &&
+                (addr < (E_EEPROM_XMC4_SECTOR_LIST[sector].start_addr + E_EEPROM_XMC4_SECTOR_LIST[sector].size)))
+        {
+            break;
+        }
+    }
+
+    return (sector);
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC4_lGetSectorEndAddr
+ ********************************************************************************
+ * Summary:
+ * Local function to get the end address of the sector holding an address.
+ *
+ * Parameters:
+ * handle - e_eeprom handle
+ * addr - Flash address within the emulated area
+ *
+ * Return:
+ * uint32_t
+ *
+ *******************************************************************************/
+static uint32_t E_EEPROM_XMC4_lGetSectorEndAddr(E_EEPROM_XMC4_t *const handle, uint32_t addr)
+{
+    uint32_t sector;
+
+    sector = E_EEPROM_XMC4_lGetSector(handle, addr);
+
+    return (E_EEPROM_XMC4_SECTOR_LIST[sector].start_addr + E_EEPROM_XMC4_SECTOR_LIST[sector].size);
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC4_lGetNextSectorAddr
+ ********************************************************************************
+ * Summary:
+ * Local function to get the start address of the sector written after a
+ * sector. The first sector follows the last one.
+ *
+ * Parameters:
+ * handle - e_eeprom handle
+ * sector - Index of the sector
+ *
+ * Return:
+ * uint32_t
+ *
+ *******************************************************************************/
+static uint32_t E_EEPROM_XMC4_lGetNextSectorAddr(E_EEPROM_XMC4_t *const handle, uint32_t sector)
+{
+    return (E_EEPROM_XMC4_SECTOR_LIST[(sector + 1U) % E_EEPROM_XMC4_SECTOR_COUNT].start_addr);
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC4_lAlignNextFreeAddr
+ ********************************************************************************
+ * Summary:
+ * Local function to move the next free address to the start of the next sector
+ * if the remaining space of the sector cannot hold a record.
+ *
+ * Parameters:
+ * handle - e_eeprom handle
+ * record_size - Size of the record on flash
+ *
+ * Return:
+ * void
+ *
+ *******************************************************************************/
+static void E_EEPROM_XMC4_lAlignNextFreeAddr(E_EEPROM_XMC4_t *const handle, uint32_t record_size)
+{
+    E_EEPROM_XMC4_DATA_t *const data_ptr = handle->data_ptr;
+
+    if ((data_ptr->sector_info.next_free_start_addr + record_size) >
+            E_EEPROM_XMC4_lGetSectorEndAddr(handle, data_ptr->sector_info.next_free_start_addr))
+    {
+        data_ptr->sector_info.next_free_start_addr = E_EEPROM_XMC4_lGetNextSectorAddr(handle, 
+                E_EEPROM_XMC4_lGetSector(handle, data_ptr->sector_info.next_free_start_addr));
+    }
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC4_lGetPageCount
+ ********************************************************************************
+ * Summary:
+ * Local function to count the pages marked in a page bitmap.
+ *
+ * Parameters:
+ * page_bitmap - One bit per page of the data block
+ *
+ * Return:
+ * uint32_t
+ *
+ *******************************************************************************/
+static uint32_t E_EEPROM_XMC4_lGetPageCount(uint32_t page_bitmap)
+{
+    uint32_t page_count;
+
+    page_count = 0U;
+    while (page_bitmap != 0U)
+    {
+        page_bitmap &= page_bitmap - 1U;
+        page_count++;
+    }
+
+    return (page_count);
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC4_lGetChangedPages
+ ********************************************************************************
+ * Summary:
+ * Local function to compare the dirty pages of the RAM buffer with their latest
+ * copy on flash. The CRC and the block cycle count are not compared. If the
+ * flash is empty or holds a data block of another size, all pages are marked.
+ *
+ * Parameters:
+ * handle - e_eeprom handle
+ *
+ * Return:
+ * uint32_t - One bit per changed page of the data block
+ *
+ *******************************************************************************/
+static uint32_t E_EEPROM_XMC4_lGetChangedPages(E_EEPROM_XMC4_t *const handle)
+{
+    E_EEPROM_XMC4_DATA_t *const data_ptr = handle->data_ptr;
+    uint32_t page_bitmap;
+    uint32_t page_index;
+    uint32_t page_count;
+    uint32_t offset;
+
+    page_bitmap = 0U;
+    page_count = E_EEPROM_XMC4_FLASH_SLOT_SIZE >> E_EEPROM_XMC4_PAGE_POSITION;
+
+    if ((data_ptr->sector_info.flash_data_addr == E_EEPROM_XMC4_EMPTY) ||
+            (data_ptr->sector_info.page_count != page_count))
+    {
+        page_bitmap = ((uint32_t)0xFFFFFFFFU) >> (E_EEPROM_XMC4_MAX_PAGES - page_count);
+    }
+    else
+    {
+        offset = E_EEPROM_XMC4_HEADER_SIZE;
+        for (page_index = 0U; page_index < page_count; page_index++)
+        {
+            if ((((data_ptr->flush_state.dirty_pages >> page_index) & 1U) != 0U) &&
+                    (memcmp((const uint8_t*)(const void*)E_EEPROM_XMC4_lGetPageData(handle, page_index) + offset,
+                    (const uint8_t*)data_ptr->sector_info.page_addr[page_index] + offset,
+                    E_EEPROM_XMC4_PAGE_SIZE - offset) != 0))
+            {
+                page_bitmap |= ((uint32_t)1U << page_index);
+            }
+            offset = 0U;
+        }
+    }
+
+    return (page_bitmap);
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC4_lApplyRecord
+ ********************************************************************************
+ * Summary:
+ * Local function to update the flash addresses of the latest copy of each page
+ * with a valid record. A full data block sets all pages, a delta record the
+ * pages it holds.
+ *
+ * Parameters:
+ * page_addr - Flash addresses of the pages of the data block
+ * record_addr - Start address of the record
+ *
+ * Return:
+ * void
+ *
+ *******************************************************************************/
+static void E_EEPROM_XMC4_lApplyRecord(uint32_t *const page_addr, uint32_t record_addr)
+{
+    uint32_t block_cycle_count;
+    uint32_t page_bitmap;
+    uint32_t page_count;
+    uint32_t page_index;
+    uint32_t data_addr;
+
+    block_cycle_count = *((uint32_t*)record_addr + E_EEPROM_XMC4_BCC_OFFSET);
+
+    if ((block_cycle_count & E_EEPROM_XMC4_BCC_DELTA_RECORD) == 0U)
+    {
+        page_count = E_EEPROM_XMC4_lGetRecordSize(block_cycle_count) >> E_EEPROM_XMC4_PAGE_POSITION;
+        for (page_index = 0U; page_index < E_EEPROM_XMC4_MAX_PAGES; page_index++)
+        {
+            if (page_index < page_count)
+            {
+                page_addr[page_index] = record_addr + (page_index << E_EEPROM_XMC4_PAGE_POSITION);
+            }
+            else
+            {
+                page_addr[page_index] = E_EEPROM_XMC4_EMPTY;
+            }
+        }
+    }
+    else
+    {
+        /* The pages follow the header page in ascending order */
+        page_bitmap = *((uint32_t*)record_addr + E_EEPROM_XMC4_DELTA_BITMAP_OFFSET);
+        data_addr = record_addr + E_EEPROM_XMC4_PAGE_SIZE;
+        for (page_index = 0U; page_index < E_EEPROM_XMC4_MAX_PAGES; page_index++)
+        {
+            if (((page_bitmap >> page_index) & 1U) != 0U)
+            {
+                page_addr[page_index] = data_addr;
+                data_addr += E_EEPROM_XMC4_PAGE_SIZE;
+            }
+        }
+    }
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC4_lGetPageData
+ ********************************************************************************
+ * Summary:
+ * Local function to get the latest content of a page of the data block. If
+ * E_EEPROM_XMC4_FLASH_READ_ENABLED is defined, a staged page is taken from RAM
+ * and the other pages from their latest copy on flash.
+ *
+ * Parameters:
+ * handle - e_eeprom handle
+ * page_index - Page of the data block
+ *
+ * Return:
+ * const uint32_t* - Address of the page
+ *
+ *******************************************************************************/
+static const uint32_t *E_EEPROM_XMC4_lGetPageData(E_EEPROM_XMC4_t *const handle, uint32_t page_index)
+{
+#ifdef E_EEPROM_XMC4_FLASH_READ_ENABLED
+    E_EEPROM_XMC4_DATA_t *const data_ptr = handle->data_ptr;
+    const uint32_t *page_ptr;
+    uint32_t slot;
+
+    if (data_ptr->sector_info.page_addr[page_index] != E_EEPROM_XMC4_EMPTY)
+    {
+        page_ptr = (const uint32_t*)data_ptr->sector_info.page_addr[page_index];
+    }
+    else
+    {
+        page_ptr = e_eeprom_xmc4_zero_page;
+    }
+
+    for (slot = 0U; slot < E_EEPROM_XMC4_STAGING_PAGES; slot++)
+    {
+        if (data_ptr->data_buffer.staged_page[slot] == page_index)
+        {
+            page_ptr = data_ptr->data_buffer.staging[slot];
+        }
+    }
+
+    return (page_ptr);
+#else
+    return (handle->ram_ptr + (page_index * E_EEPROM_XMC4_MIN_WORDS_PER_PAGE));
+#endif
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC4_lGetDataAddr
+ ********************************************************************************
+ * Summary:
+ * Local function to get the address a byte of the data block is read from.
+ *
+ * Parameters:
+ * handle - e_eeprom handle
+ * offset_address - Offset of the byte in the data block
+ *
+ * Return:
+ * const uint8_t*
+ *
+ *******************************************************************************/
+static const uint8_t *E_EEPROM_XMC4_lGetDataAddr(E_EEPROM_XMC4_t *const handle, uint32_t offset_address)
+{
+#ifdef E_EEPROM_XMC4_FLASH_READ_ENABLED
+    uint32_t byte_index;
+
+    byte_index = offset_address + E_EEPROM_XMC4_HEADER_SIZE;
+
+    return ((const uint8_t*)(const void*)E_EEPROM_XMC4_lGetPageData(handle, byte_index >> E_EEPROM_XMC4_PAGE_POSITION) +
+            (byte_index & (E_EEPROM_XMC4_PAGE_SIZE - 1U)));
+#else
+    return ((const uint8_t*)(const void*)handle->ram_ptr + E_EEPROM_XMC4_HEADER_SIZE + offset_address);
+#endif
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC4_lGetWritableAddr
+ ********************************************************************************
+ * Summary:
+ * Local function to get the address a byte of the data block is written to. If
+ * E_EEPROM_XMC4_FLASH_READ_ENABLED is defined, the page of the byte is staged
+ * first, the flash is never programmed. The snapshot of a commit in progress is
+ * kept.
+ *
+ * Parameters:
+ * handle - e_eeprom handle
+ * offset_address - Offset of the byte in the data block
+ *
+ * Return:
+ * uint8_t* - NULL if the page cannot be staged
+ *
+ *******************************************************************************/
+static uint8_t *E_EEPROM_XMC4_lGetWritableAddr(E_EEPROM_XMC4_t *const handle, uint32_t offset_address)
+{
+#ifdef E_EEPROM_XMC4_FLASH_READ_ENABLED
+    E_EEPROM_XMC4_DATA_t *const data_ptr = handle->data_ptr;
+    uint8_t *address_ptr;
+    uint32_t byte_index;
+    uint32_t page_index;
+    uint32_t slot;
+    uint32_t free_slot;
+
+    address_ptr = NULL;
+    byte_index = offset_address + E_EEPROM_XMC4_HEADER_SIZE;
+    page_index = byte_index >> E_EEPROM_XMC4_PAGE_POSITION;
+    free_slot = E_EEPROM_XMC4_STAGING_PAGES;
+
+    E_EEPROM_XMC4_lProtectPage(handle, page_index);
+
+    for (slot = 0U; slot < E_EEPROM_XMC4_STAGING_PAGES; slot++)
+    {
+        if (data_ptr->data_buffer.staged_page[slot] == page_index)
+        {
+            break;
+        }
+        if (data_ptr->data_buffer.staged_page[slot] == E_EEPROM_XMC4_MAX_PAGES)
+        {
+            free_slot = slot;
+        }
+    }
+
+    if (slot == E_EEPROM_XMC4_STAGING_PAGES)
+    {
+        /* The page is not staged yet, E_EEPROM_XMC4_lCanWritePages() checked that a staging page is free */
+        if (free_slot != E_EEPROM_XMC4_STAGING_PAGES)
+        {
+            (void)memcpy(data_ptr->data_buffer.staging[free_slot], E_EEPROM_XMC4_lGetPageData(handle, page_index),
+                    E_EEPROM_XMC4_PAGE_SIZE);
+            data_ptr->data_buffer.staged_page[free_slot] = page_index;
+        }
+        slot = free_slot;
+    }
+
+    if (slot != E_EEPROM_XMC4_STAGING_PAGES)
+    {
+        address_ptr = (uint8_t*)(void*)data_ptr->data_buffer.staging[slot] +
+                (byte_index & (E_EEPROM_XMC4_PAGE_SIZE - 1U));
+    }
+
+    return (address_ptr);
+#else
+    E_EEPROM_XMC4_lProtectPage(handle, (offset_address + E_EEPROM_XMC4_HEADER_SIZE) >> E_EEPROM_XMC4_PAGE_POSITION);
+
+    return ((uint8_t*)(void*)handle->ram_ptr + E_EEPROM_XMC4_HEADER_SIZE + offset_address);
+#endif
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC4_lCanWritePages
+ ********************************************************************************
+ * Summary:
+ * Local function to check if all pages holding a byte changed by a write can
+ * be written, hence the write is done completely without programming the
+ * flash. If E_EEPROM_XMC4_FLASH_READ_ENABLED is defined, no commit may be in
+ * progress and the pages not staged yet must fit into the free staging pages.
+ * Else the pages of a commit in progress not programmed yet must fit into the
+ * free shadow pages.
+ *
+ * Parameters:
+ * handle - e_eeprom handle
+ * offset_address - Offset of the first byte in the data block
+ * data - Data to write
+ * length - Number of bytes to write
+ *
+ * Return:
+ * bool
+ *
+ *******************************************************************************/
+static bool E_EEPROM_XMC4_lCanWritePages(E_EEPROM_XMC4_t *const handle, uint32_t offset_address,
+        const uint8_t *const data, uint32_t length)
+{
+    E_EEPROM_XMC4_DATA_t *const data_ptr = handle->data_ptr;
+    uint32_t page_bitmap;
+    uint32_t free_slots;
+    uint32_t slot;
+    uint32_t i;
+
+    /* Pages holding a changed byte */
+    page_bitmap = 0U;
+    for (i = 0U; i < length; i++)
+    {
+        if (*E_EEPROM_XMC4_lGetDataAddr(handle, offset_address + i) != *(data + i))
+        {
+            page_bitmap |= (uint32_t)1U << ((offset_address + i + E_EEPROM_XMC4_HEADER_SIZE) >>
+                    E_EEPROM_XMC4_PAGE_POSITION);
+        }
+    }
+
+    free_slots = 0U;
+#ifdef E_EEPROM_XMC4_FLASH_READ_ENABLED
+    /* The staging pages hold the snapshot of a commit in progress */
+    if ((data_ptr->commit_state.busy == (bool)true) && (page_bitmap != 0U))
+    {
+        return (false);
+    }
+
+    /* Pages already staged need no further staging page */
+    for (slot = 0U; slot < E_EEPROM_XMC4_STAGING_PAGES; slot++)
+    {
+        if (data_ptr->data_buffer.staged_page[slot] == E_EEPROM_XMC4_MAX_PAGES)
+        {
+            free_slots++;
+        }
+        else
+        {
+            page_bitmap &= ~((uint32_t)1U << data_ptr->data_buffer.staged_page[slot]);
+        }
+    }
+#else
+    /* Only pages of a commit in progress not programmed yet are saved, once */
+    page_bitmap &= data_ptr->commit_state.pending_pages;
+
+    for (slot = 0U; slot < E_EEPROM_XMC4_SHADOW_PAGES; slot++)
+    {
+        if (data_ptr->commit_state.shadow_page[slot] == E_EEPROM_XMC4_MAX_PAGES)
+        {
+            free_slots++;
+        }
+        else
+        {
+            page_bitmap &= ~((uint32_t)1U << data_ptr->commit_state.shadow_page[slot]);
+        }
+    }
+#endif
+
+    return (E_EEPROM_XMC4_lGetPageCount(page_bitmap) <= free_slots);
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC4_lClearDirtyPages
+ ********************************************************************************
+ * Summary:
+ * Local function to clear the dirty state once the flash holds the data block.
+ * If E_EEPROM_XMC4_FLASH_READ_ENABLED is defined, the staging pages are freed.
+ *
+ * Parameters:
+ * handle - e_eeprom handle
+ *
+ * Return:
+ * void
+ *
+ *******************************************************************************/
+static void E_EEPROM_XMC4_lClearDirtyPages(E_EEPROM_XMC4_t *const handle)
+{
+    E_EEPROM_XMC4_DATA_t *const data_ptr = handle->data_ptr;
+#ifdef E_EEPROM_XMC4_FLASH_READ_ENABLED
+    uint32_t slot;
+
+    for (slot = 0U; slot < E_EEPROM_XMC4_STAGING_PAGES; slot++)
+    {
+        data_ptr->data_buffer.staged_page[slot] = E_EEPROM_XMC4_MAX_PAGES;
+    }
+#endif
+    data_ptr->flush_state.dirty_pages = 0U;
+    data_ptr->flush_state.dirty_bytes = 0U;
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC4_lSealWarmState
+ ********************************************************************************
+ * Summary:
+ * Local function to seal the RAM buffer and sector info with a checksum, hence
+ * they can be used by the initialization after a warm reset. Only done if
+ * E_EEPROM_XMC4_WARM_RESET_ENABLED is defined.
+ *
+ * Parameters:
+ * handle - e_eeprom handle
+ *
+ * Return:
+ * void
+ *
+ *******************************************************************************/
+static void E_EEPROM_XMC4_lSealWarmState(E_EEPROM_XMC4_t *const handle)
+{
+#ifdef E_EEPROM_XMC4_WARM_RESET_ENABLED
+    E_EEPROM_XMC4_DATA_t *const data_ptr = handle->data_ptr;
+
+    /* A delta record does not hold the CRC of the complete RAM buffer */
+    data_ptr->data_buffer.crc = E_EEPROM_XMC4_lCalculateRamCRC(handle);
+    data_ptr->warm_seal.checksum = E_EEPROM_XMC4_lGetWarmChecksum(handle);
+#else
+    (void)handle;
+#endif
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC4_lUnsealWarmState
+ ********************************************************************************
+ * Summary:
+ * Local function to invalidate the seal before the flash gets modified.
+ * Incrementing the generation counter changes the checksum of the state. Only
+ * done if E_EEPROM_XMC4_WARM_RESET_ENABLED is defined.
+ *
+ * Parameters:
+ * handle - e_eeprom handle
+ *
+ * Return:
+ * void
+ *
+ *******************************************************************************/
+static void E_EEPROM_XMC4_lUnsealWarmState(E_EEPROM_XMC4_t *const handle)
+{
+#ifdef E_EEPROM_XMC4_WARM_RESET_ENABLED
+    handle->data_ptr->warm_seal.generation++;
+#else
+    (void)handle;
+#endif
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC4_lIsWarmSealed
+ ********************************************************************************
+ * Summary:
+ * Local function to check the seal of the sector info. Always false if
+ * E_EEPROM_XMC4_WARM_RESET_ENABLED is not defined.
+ *
+ * Parameters:
+ * handle - e_eeprom handle
+ *
+ * Return:
+ * bool - true if the seal is valid
+ *
+ *******************************************************************************/
+static bool E_EEPROM_XMC4_lIsWarmSealed(E_EEPROM_XMC4_t *const handle)
+{
+    bool sealed;
+
+    sealed = false;
+#ifdef E_EEPROM_XMC4_WARM_RESET_ENABLED
+    if (handle->data_ptr->warm_seal.checksum == E_EEPROM_XMC4_lGetWarmChecksum(handle))
+    {
+        sealed = true;
+    }
+#else
+    (void)handle;
+#endif
+    return (sealed);
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC4_lResealSectorInfo
+ ********************************************************************************
+ * Summary:
+ * Local function to renew the seal after a change of the sector info, keeping
+ * the CRC of the RAM buffer of the last seal. Only done if
+ * E_EEPROM_XMC4_WARM_RESET_ENABLED is defined.
+ *
+ * Parameters:
+ * handle - e_eeprom handle
+ *
+ * Return:
  * void
  *
+ *******************************************************************************/
+static void E_EEPROM_XMC4_lResealSectorInfo(E_EEPROM_XMC4_t *const handle)
+{
+#ifdef E_EEPROM_XMC4_WARM_RESET_ENABLED
+    handle->data_ptr->warm_seal.checksum = E_EEPROM_XMC4_lGetWarmChecksum(handle);
+#else
+    (void)handle;
+#endif
+}
+
+#ifdef E_EEPROM_XMC4_WARM_RESET_ENABLED
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC4_lIsWarmStateValid
+ ********************************************************************************
+ * Summary:
+ * Local function to check if the RAM buffer kept over a warm reset is sealed,
+ * has the requested size and matches its CRC. Changes of the RAM buffer which
+ * were not programmed into the flash before the reset fail the CRC check.
+ *
+ * Parameters:
+ * handle - e_eeprom handle
+ * len - Size of e_eeprom
+ *
+ * Return:
+ * bool - true if the RAM buffer can be used
+ *
+ *******************************************************************************/
+static bool E_EEPROM_XMC4_lIsWarmStateValid(E_EEPROM_XMC4_t *const handle, uint32_t len)
+{
+    E_EEPROM_XMC4_DATA_t *const data_ptr = handle->data_ptr;
+    bool valid;
+
+    valid = false;
+    if ((data_ptr->data_buffer.len == len) &&
+            (data_ptr->warm_seal.checksum == E_EEPROM_XMC4_lGetWarmChecksum(handle)))
+    {
+        if (E_EEPROM_XMC4_lCalculateRamCRC(handle) == data_ptr->data_buffer.crc)
+        {
+            valid = true;
+        }
+    }
+    return (valid);
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC4_lGetWarmChecksum
+ ********************************************************************************
+ * Summary:
+ * Local function to calculate the checksum of the sector info, the size and
+ * CRC of the RAM buffer and the generation counter.
+ *
+ * Parameters:
+ * handle - e_eeprom handle
+ *
+ * Return:
+ * uint32_t
+ *
+ *******************************************************************************/
+static uint32_t E_EEPROM_XMC4_lGetWarmChecksum(E_EEPROM_XMC4_t *const handle)
+{
+    E_EEPROM_XMC4_DATA_t *const data_ptr = handle->data_ptr;
+    uint32_t indx;
+    uint32_t checksum;
+    uint32_t state_words[4];
+    const uint32_t *sector_info_ptr;
+
+    state_words[0] = E_EEPROM_XMC4_WARM_MAGIC;
+    state_words[1] = data_ptr->warm_seal.generation;
+    state_words[2] = data_ptr->data_buffer.len;
+    state_words[3] = data_ptr->data_buffer.crc;
+
+    checksum = 0U;
+    for (indx = 0U; indx < 4U; indx++)
+    {
+        checksum = ((checksum << 1U) | (checksum >> 31U)) + state_words[indx];
+    }
+
+    /* The sector info includes the flash addresses of the pages */
+    sector_info_ptr = (const uint32_t*)(const void*)&data_ptr->sector_info;
+    for (indx = 0U; indx < (sizeof(data_ptr->sector_info) >> 2U); indx++)
+    {
+        checksum = ((checksum << 1U) | (checksum >> 31U)) + sector_info_ptr[indx];
+    }
+
+    return (~checksum);
+}
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC4_lCalculateRamCRC
+ ********************************************************************************
+ * Summary:
+ * Local function to calculate the CRC of the RAM buffer as it is placed in
+ * flash, from the block cycle count to the last page of the RAM copy.
+ *
+ * Parameters:
+ * handle - e_eeprom handle
+ *
+ * Return:
+ * uint32_t
+ *
+ *******************************************************************************/
+static uint32_t E_EEPROM_XMC4_lCalculateRamCRC(E_EEPROM_XMC4_t *const handle)
+{
+    E_EEPROM_XMC4_DATA_t *const data_ptr = handle->data_ptr;
+    uint32_t result;
+
+    /* The block cycle count is kept in the state data structure, the data in the RAM copy of the handle */
+    XMC_FCE_InitializeSeedValue(&e_eeprom_xmc4_fce, 0U);
+    (void)XMC_FCE_CalculateCRC32(&e_eeprom_xmc4_fce, &data_ptr->data_buffer.block_cycle_count, (uint32_t)4U, &result);
+    (void)XMC_FCE_CalculateCRC32(&e_eeprom_xmc4_fce, handle->ram_ptr + E_EEPROM_XMC4_DATA_OFFSET,
+            E_EEPROM_XMC4_FLASH_SLOT_SIZE - E_EEPROM_XMC4_HEADER_SIZE, &result);
+
+    return (result);
+}
+#endif
+
+/*******************************************************************************
+ * Function Name: E_EEPROM_XMC4_lCopyFlashToRam
+ ********************************************************************************
+ * Summary:
+ * Local function to copy data blocks from FLASH to RAM. Each page is copied
+ * from its latest copy, the full data block or a delta record. If
+ * E_EEPROM_XMC4_FLASH_READ_ENABLED is defined, only the header is copied.
+ *
+ * Parameters:
+ * handle - e_eeprom handle
+ *
  * Return:
  * void
  *
  *******************************************************************************/
-static void E_EEPROM_XMC4_lCopyFlashToRam(void)
+static void E_EEPROM_XMC4_lCopyFlashToRam(E_EEPROM_XMC4_t *const handle)
 {
+    E_EEPROM_XMC4_DATA_t *const data_ptr = handle->data_ptr;
     uint32_t *flash_addr_ptr;
+#ifndef E_EEPROM_XMC4_FLASH_READ_ENABLED
     uint32_t *ram_addr_ptr;
     uint32_t byte_index;
+    uint32_t page_index;
+    uint32_t page_count;
+
+    ram_addr_ptr = handle->ram_ptr;
 
-    flash_addr_ptr = (uint32_t*)e_eeprom_xmc4_sector_info.flash_data_addr;
-    ram_addr_ptr = (uint32_t*)(void*)&e_eeprom_xmc4_data_buffer;
+    /* A record written with a larger size is cut to the RAM copy */
+    page_count = data_ptr->sector_info.page_count;
+    if (page_count > (E_EEPROM_XMC4_FLASH_SLOT_SIZE >> E_EEPROM_XMC4_PAGE_POSITION))
+    {
+        page_count = E_EEPROM_XMC4_FLASH_SLOT_SIZE >> E_EEPROM_XMC4_PAGE_POSITION;
+    }
 
-    for(byte_index = 0U ; byte_index < E_EEPROM_XMC4_MAX_WORDS; byte_index++)
+    for (page_index = 0U; page_index < page_count; page_index++)
     {
-        *(ram_addr_ptr + byte_index) = *(flash_addr_ptr + byte_index);
+        flash_addr_ptr = (uint32_t*)data_ptr->sector_info.page_addr[page_index];
+
+        for(byte_index = 0U ; byte_index < E_EEPROM_XMC4_MIN_WORDS_PER_PAGE; byte_index++)
+        {
+            *(ram_addr_ptr + byte_index) = *(flash_addr_ptr + byte_index);
+        }
+        ram_addr_ptr += E_EEPROM_XMC4_MIN_WORDS_PER_PAGE;
     }
+
+    /* Data beyond a smaller block reads as erased flash */
+    (void)memset(ram_addr_ptr, 0, E_EEPROM_XMC4_FLASH_SLOT_SIZE - (page_count << E_EEPROM_XMC4_PAGE_POSITION));
+#endif
+
+    /* The header of the first page may be older than the latest record */
+    flash_addr_ptr = (uint32_t*)data_ptr->sector_info.flash_data_addr;
+    data_ptr->data_buffer.crc = *flash_addr_ptr;
+    data_ptr->data_buffer.block_cycle_count = *(flash_addr_ptr + E_EEPROM_XMC4_BCC_OFFSET);
 }
 #endif
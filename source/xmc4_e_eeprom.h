@@ -55,6 +55,29 @@
 *
 * 2022-03-02:
 *     - Adapted for use with mtb-xmc-emeeprom asset
+*
+* 2026-10-16:
+*     - Added E_EEPROM_XMC4_WARM_RESET_ENABLED option to reuse the RAM copy
+*     kept in no-init RAM after a warm reset
+*     - Size of the data blocks on flash derived from the size of the emulated
+*     EEPROM instead of fixed 8 KBytes
+*     - E_EEPROM_XMC4_UpdateFlashContents() writes delta records holding only
+*     the changed pages
+*     - Added dirty page tracking, flush policies, E_EEPROM_XMC4_Tick() and
+*     E_EEPROM_XMC4_GetFlushInfo()
+*     - Sectors holding old records are erased by E_EEPROM_XMC4_EraseStep()
+*     in idle time instead of during the initialization and the update
+*     - Flash sectors used for the emulation configurable by E_EEPROM_XMC4_SECTORS
+*     - Added E_EEPROM_XMC4_FLASH_READ_ENABLED option to read the data from flash
+*     without the RAM copy of the data block
+*     - Added E_EEPROM_XMC4_CommitBegin() and E_EEPROM_XMC4_CommitPoll() to
+*     program a snapshot of the data block one page per call
+*     - The initialization verifies the CRC of the newest records only, added
+*     E_EEPROM_XMC4_GetInitInfo()
+*     - The state is kept in E_EEPROM_XMC4_DATA_t per instance and all APIs
+*     take the handle, the flash sectors are configurable per handle
+*     - The RAM copy of the data block is supplied per handle and sized by
+*     E_EEPROM_XMC4_RAM_WORDS()
 *****************************************************************************/
 
 #ifndef E_EEPROM_XMC4_H
@@ -90,15 +113,15 @@
 *
 * It should be noted that the non-volatile memory required to store the EEPROM
 * Data is mapped to Internal Flash. In the XMC 4xxx emulated EEPROM Middleware
-* the Flash region required for EEPROM Middleware is 64 KBytes of flash and is
-* reserved from offset of 0x10000 from the Base of Flash. This is FIXED and
-* cannot be changed. When adding this Middleware asset to a application, users
-* are required to update/modify the application linker script to exclude this
-* flash region from the memory used for application code/initialized data.
-* So the FIRST 64 KBytes of Flash and flash beyond 128 KBytes of Flash can be
-* used for code and initialized data in application. Examples of how to modify
-* the Linker script create the memory hole of 64 KBytes starting at 64 KBytes
-* from start of flash is provided in this documentation.
+* the Flash sectors used by an instance are given by its handle, or by the
+* E_EEPROM_XMC4_SECTORS table when the handle gives none. By default this table
+* lists the four 16 KBytes sectors 4 to 7, i.e. 64 KBytes of flash from offset
+* 0x10000 from the Base of Flash. When adding this Middleware asset to a
+* application, users are required to update/modify the application linker
+* script to exclude the used flash sectors from the memory used for application
+* code/initialized data. Examples of how to modify the Linker script create the
+* memory hole of the default 64 KBytes starting at 64 KBytes from start of
+* flash is provided in this documentation.
 *
 *
 ********************************************************************************
@@ -106,14 +129,15 @@
 ********************************************************************************
 *
 * It should be noted that the non-volatile memory required to store the EEPROM
-* Data is mapped to Internal Flash. In the XMC 4xxx emulated EEPROM Middleware
-* the 64 KBytes of Flash region required for EEPROM is allocated from 0x10000
-* from start of Flash till 0x20000 from start of Flash. The amount of Flash
-* space reserved (64 KBytes) is fixed and its location CANNOT be changed.
+* Data is mapped to Internal Flash. Each instance uses 2 to 32 physical flash
+* sectors, given by the sector_ptr and sector_count of its handle. A handle
+* with a NULL sector_ptr uses the E_EEPROM_XMC4_SECTORS table, which can be
+* overridden at compile time and by default lists the four 16 KBytes sectors
+* from 0x10000 from start of Flash till 0x20000 from start of Flash.
 * It is advisable for user(s) of emulated EEPROM to update their Linker file
-* (script) to Not use the Flash space reserved for EEPROM for code/initialized
+* (script) to Not use the Flash sectors of any instance for code/initialized
 * data of application. A properly updated Linker script will remove
-* the Flash region reserved for EEPROM from being used by linker for code
+* the Flash sectors reserved for EEPROM from being used by linker for code
 * or initialized data.
 *
 * For the Kit/XMC device you are using, please select the proper Linker script.
@@ -126,10 +150,11 @@
 *
 * Examples of how the linker scripts be modified is provided below.
 *
-* Note: EEPROM Middleware reserves 64 KBytes of Flash from offset 0x10000
-* to 0x20000 from start of Flash memory. So a memory region hole has to be
-* created in Linker script memory map, so that memory will Not be used
-* by linker for code or initialized data..
+* Note: With the default E_EEPROM_XMC4_SECTORS, EEPROM Middleware reserves
+* 64 KBytes of Flash from offset 0x10000 to 0x20000 from start of Flash memory.
+* So a memory region hole has to be created in Linker script memory map, so
+* that memory will Not be used by linker for code or initialized data. Other
+* sectors need a hole of their own in the same way.
 *
 * Note: The Vector table has to be mapped at start of Flash memory as the Reset
 * Vector is the first entry in the Vector table.
@@ -407,18 +432,21 @@
 * 
 * The XMC4 Emulated EEPROM asset can used to store non-volatile data
 * in Flash with improved resiliency. In XMC4 emulated eeprom asset the
-* Flash used for mapping the user data to flash is fixed and cannot
-* be changed. It is mapped from offset of 64 KBytes (0x10000) for
-* length of 64 KBytes. Before using emulated EEPROM asset, the
-* Flash in the region Device Flash Base + 0x10000 to
-* Device Flash Base + 0x20000 should be erased and have No data
-* present in it. Since EEPROM retains data between subsequent
-* power-cycles/reboots and re-programming of application. This region
-* should not be erased unless it is explicitly desired to get rid
-* of previously stored data.
+* Flash used for mapping the user data to flash are the sectors at
+* sector_ptr of the handle, 2 to 32 entries of {start address, size}
+* in the order they are written. A NULL sector_ptr selects the
+* E_EEPROM_XMC4_SECTORS table, by default the four 16 KBytes sectors
+* from Device Flash Base + 0x10000 to Device Flash Base + 0x20000.
+* Before using emulated EEPROM asset, these sectors should be erased
+* and have No data present in them. Since EEPROM retains data between
+* subsequent power-cycles/reboots and re-programming of application.
+* These sectors should not be erased unless it is explicitly desired
+* to get rid of previously stored data.
 * 
-* The XMC4 EEPROM configuration data is just the "len" of EEPROM
-* which is passed to the initialization API.
+* The XMC4 EEPROM configuration data is the "len" of EEPROM, which is
+* passed to the initialization API, and the sectors, the state data
+* structure and the RAM copy of E_EEPROM_XMC4_RAM_WORDS(len) words at
+* ram_ptr, which are given by the handle.
 * 
 * The typical application programming sequence for using the eeprom
 * asset is to initially call the API:
@@ -426,8 +454,37 @@
 * E_EEPROM_XMC4_STATUS_t E_EEPROM_XMC4_Init(E_EEPROM_XMC4_t *const handle, uint32_t len);
 * 
 * Passing in the "E_EEPROM_XMC4_t *const handle" data structure which
-* has only a Boolean variable. This is typically "false" when passed
-* to this Initialization function.
+* has a Boolean variable, the flush policy, the pointer to the state data
+* structure, the flash sectors and the RAM copy of the instance. The RAM copy
+* is an array of E_EEPROM_XMC4_RAM_WORDS(len) words, hence each instance
+* takes only the RAM of its own size. The Boolean variable is
+* typically "false" when passed to this Initialization function. All other
+* APIs take the same handle.
+*
+* Several independent instances can be used, each with its own handle, its
+* own E_EEPROM_XMC4_DATA_t state data structure and its own flash sectors,
+* e.g. a small, often updated block for counters beside a large calibration
+* block. The instances must not share flash sectors. A handle with a NULL
+* sector pointer uses the sectors of E_EEPROM_XMC4_SECTORS, the application
+* must give all other instances their own sectors.
+*
+* \code
+*
+* static E_EEPROM_XMC4_DATA_t counter_data;
+* static uint32_t counter_ram[E_EEPROM_XMC4_RAM_WORDS(64U)];
+* static const E_EEPROM_XMC4_SECTOR_t counter_sectors[] =
+* {
+*   {XMC_FLASH_UNCACHED_BASE + 0x10000U, 0x4000U},
+*   {XMC_FLASH_UNCACHED_BASE + 0x14000U, 0x4000U}
+* };
+* static E_EEPROM_XMC4_t counter_handle =
+* {
+*   .data_ptr = &counter_data, .sector_ptr = counter_sectors, .sector_count = 2U, .ram_ptr = counter_ram
+* };
+*
+* status = E_EEPROM_XMC4_Init(&counter_handle, 64U);
+*
+* \endcode
 * 
 * After that the XMC4 provided APIs for Read/Write APIs
 * (Byte or Array APIs) can be called. When it is desired to store
@@ -437,6 +494,35 @@
 * E_EEPROM_XMC4_UpdateFlashContents() is only stored in RAM and not
 * written to flash (non-volatile).
 *
+* The Write APIs mark the 256 byte pages they change as dirty. The flush
+* policy of the handle selects when the dirty pages are programmed:
+* * E_EEPROM_XMC4_FLUSH_EXPLICIT - only by E_EEPROM_XMC4_UpdateFlashContents()
+*   (default of a zero initialized handle)
+* * E_EEPROM_XMC4_FLUSH_IMMEDIATE - by each Write API changing data
+* * E_EEPROM_XMC4_FLUSH_DIRTY_BYTES - by the Write API which makes the number
+*   of changed bytes reach \a flush_dirty_bytes
+* * E_EEPROM_XMC4_FLUSH_QUIESCENCE - by E_EEPROM_XMC4_Tick() once no data was
+*   changed for \a flush_quiet_time milliseconds
+*
+* E_EEPROM_XMC4_UpdateFlashContents() returns without programming the flash
+* if no page is dirty. E_EEPROM_XMC4_GetFlushInfo() reports the dirty pages
+* and the block cycle count of the last update.
+*
+* Once the records are written to a new sector, the other sectors hold only
+* old records. Calling E_EEPROM_XMC4_EraseStep() in idle time while
+* E_EEPROM_XMC4_IsErasePending() returns true erases them ahead, so that
+* E_EEPROM_XMC4_UpdateFlashContents() does not wait for a sector erase.
+*
+* E_EEPROM_XMC4_UpdateFlashContents() blocks until all pages are programmed.
+* Alternatively E_EEPROM_XMC4_CommitBegin() takes a snapshot of the data
+* block and E_EEPROM_XMC4_CommitPoll() programs one page of it per call until
+* it returns E_EEPROM_XMC4_STATUS_OK. The application keeps reading and
+* writing meanwhile, the writes are programmed by the next commit. A write
+* which would change more pages not programmed yet than shadow pages are left
+* returns false without changing any byte, with
+* E_EEPROM_XMC4_FLASH_READ_ENABLED no write is accepted until the commit is
+* completed. The Write APIs never continue the commit themselves.
+*
 *
 ********************************************************************************
 *
@@ -461,6 +547,57 @@
 /****************************************************************************
  * MACROS
 ****************************************************************************/
+/**
+ * Places the E_EEPROM_XMC4_DATA_t state data structure of an instance into RAM not initialized by the startup code,
+ * used with E_EEPROM_XMC4_WARM_RESET_ENABLED. The section must be a NOLOAD section of the linker script.
+ */
+#ifndef E_EEPROM_XMC4_NOINIT
+#define E_EEPROM_XMC4_NOINIT __attribute__((section(".no_init")))
+#endif
+
+/**
+ * Flash sectors used for the emulation as {start address, size} pairs, in the order they are written. Each entry must
+ * be a physical sector erased by XMC_FLASH_EraseSector(). 2 to 32 sectors of at least 16 KBytes can be listed, e.g.
+ * the 64 KBytes or 128 KBytes sectors of the device. The default is the four 16 KBytes sectors 4 to 7.
+ */
+#ifndef E_EEPROM_XMC4_SECTORS
+#define E_EEPROM_XMC4_SECTORS \
+        {XMC_FLASH_UNCACHED_BASE + 0x10000U, 0x4000U}, \
+        {XMC_FLASH_UNCACHED_BASE + 0x14000U, 0x4000U}, \
+        {XMC_FLASH_UNCACHED_BASE + 0x18000U, 0x4000U}, \
+        {XMC_FLASH_UNCACHED_BASE + 0x1C000U, 0x4000U}
+#endif
+
+/**
+ * Number of 256 byte pages staged in RAM for the Write APIs, used with E_EEPROM_XMC4_FLASH_READ_ENABLED. A write
+ * which would change a further page is rejected until E_EEPROM_XMC4_UpdateFlashContents() programmed the staged pages.
+ */
+#ifndef E_EEPROM_XMC4_STAGING_PAGES
+#define E_EEPROM_XMC4_STAGING_PAGES 2U
+#endif
+
+/**
+ * Number of 256 byte pages of the RAM copy saved by the Write APIs while E_EEPROM_XMC4_CommitPoll() has not yet
+ * programmed them. A write which would change a further such page is rejected until the page is programmed.
+ */
+#ifndef E_EEPROM_XMC4_SHADOW_PAGES
+#define E_EEPROM_XMC4_SHADOW_PAGES 2U
+#endif
+
+/* Sizes of the state data structure of an instance */
+#define E_EEPROM_XMC4_MIN_WORDS_PER_PAGE      ((uint32_t)64U)
+#define E_EEPROM_XMC4_ACTUAL_FLASH_BLOCK_SIZE (8192)
+
+/** Maximum size of the emulated EEPROM of an instance */
+#define E_EEPROM_XMC4_WORKING_BUFFER_SIZE     (E_EEPROM_XMC4_ACTUAL_FLASH_BLOCK_SIZE - (uint32_t)(8U))
+#define E_EEPROM_XMC4_MAX_PAGES               (E_EEPROM_XMC4_ACTUAL_FLASH_BLOCK_SIZE >> (uint32_t)(8U))
+
+/**
+ * Number of 32 bit words of the RAM copy of an emulated EEPROM of \a len bytes, see ram_ptr of the handle. The copy
+ * holds the data block as it is placed in flash, an 8 byte header and the data rounded up to full 256 byte pages.
+ */
+#define E_EEPROM_XMC4_RAM_WORDS(len)          (((((uint32_t)(len)) + 8U + 255U) >> 8U) * \
+                                               E_EEPROM_XMC4_MIN_WORDS_PER_PAGE)
 
 /****************************************************************************
 * ENUMS
@@ -480,9 +617,23 @@ typedef enum E_EEPROM_XMC4_STATUS
   E_EEPROM_XMC4_STATUS_READ_ERROR         = 2U, /**< Initialization failed due to read error */
   E_EEPROM_XMC4_STATUS_WRITE_ERROR        = 3U, /**< Initialization failed due to write error */
   E_EEPROM_XMC4_STATUS_ERASE_ERROR        = 4U, /**< Initialization failed due to erase error */
-  E_EEPROM_XMC4_STATUS_ERROR_PARAM        = 5
+  E_EEPROM_XMC4_STATUS_ERROR_PARAM        = 5,
+  E_EEPROM_XMC4_STATUS_BUSY               = 6U  /**< A commit started by E_EEPROM_XMC4_CommitBegin() is in progress */
 } E_EEPROM_XMC4_STATUS_t;
 
+/** Defines when the RAM copy is programmed into the flash. Use @ref E_EEPROM_XMC4_FLUSH_POLICY_t type for accessing
+ *  the member. */
+
+typedef enum E_EEPROM_XMC4_FLUSH_POLICY
+{
+  E_EEPROM_XMC4_FLUSH_EXPLICIT            = 0U, /**< Only by E_EEPROM_XMC4_UpdateFlashContents() */
+  E_EEPROM_XMC4_FLUSH_IMMEDIATE           = 1U, /**< By each write changing data */
+  E_EEPROM_XMC4_FLUSH_DIRTY_BYTES         = 2U, /**< By the write which makes the changed bytes reach
+                                                     flush_dirty_bytes */
+  E_EEPROM_XMC4_FLUSH_QUIESCENCE          = 3U  /**< By E_EEPROM_XMC4_Tick() once no data was changed for
+                                                     flush_quiet_time ms */
+} E_EEPROM_XMC4_FLUSH_POLICY_t;
+
 /**
  *@}
  */
@@ -494,6 +645,130 @@ typedef enum E_EEPROM_XMC4_STATUS
 /****************************************************************************
 * DATA STRUCTURES
 ****************************************************************************/
+/**
+* @brief Flash sector used for the emulation
+*/
+
+typedef struct E_EEPROM_XMC4_SECTOR
+{
+  uint32_t start_addr;                        /**< Start address of the sector */
+  uint32_t size;                              /**< Size of the sector in bytes */
+} E_EEPROM_XMC4_SECTOR_t;
+
+/**
+* @brief Diagnostic information of the flush state
+*/
+
+typedef struct E_EEPROM_XMC4_FLUSH_INFO
+{
+  uint32_t dirty_pages;                       /**< One bit per 256 byte page of the data block changed since the
+                                                   last update. Page 0 holds the first 248 bytes of data. */
+  uint32_t dirty_bytes;                       /**< Number of byte changes since the last update */
+  uint32_t cycle_count;                       /**< Block cycle count of the last update, 0 if the flash is empty */
+  E_EEPROM_XMC4_STATUS_t last_status;         /**< Status of the last update */
+} E_EEPROM_XMC4_FLUSH_INFO_t;
+
+/**
+* @brief Diagnostic information of the search for the latest record by the initialization
+*/
+
+typedef struct E_EEPROM_XMC4_INIT_INFO
+{
+  uint32_t headers_read;                      /**< Number of record headers read to find the records */
+  uint32_t records_checked;                   /**< Number of records verified by their CRC */
+  uint32_t bytes_checked;                     /**< Number of bytes covered by the CRC checks */
+} E_EEPROM_XMC4_INIT_INFO_t;
+
+/** Data structure to hold the complete state data information of sector */
+typedef struct E_EEPROM_XMC4_SECTOR_INFO
+{
+  uint32_t next_free_start_addr;              /**< Flash address the next record is written to */
+  uint32_t flash_data_addr;                   /**< Flash address of the latest record */
+  uint32_t current_sector;                    /**< Sector of the latest record */
+  uint32_t erase_state;                       /**< One bit per sector to be erased before it is written */
+  uint32_t base_addr;                         /**< Full data block the delta records refer to */
+  uint32_t delta_count;                       /**< Delta records written since the full data block */
+  uint32_t page_count;                        /**< Number of pages of the full data block */
+  uint32_t page_addr[E_EEPROM_XMC4_MAX_PAGES];  /**< Flash address of the latest copy of each page */
+} E_EEPROM_XMC4_SECTOR_INFO_t;
+
+#ifdef E_EEPROM_XMC4_FLASH_READ_ENABLED
+/** Data structure to hold the header of the latest record and the staged pages, the data is read from flash */
+typedef struct E_EEPROM_XMC4_RAM_BUFFER
+{
+  uint32_t crc;                               /**< CRC of the latest record */
+  uint32_t block_cycle_count;                 /**< Block cycle count of the latest record */
+  uint32_t staged_page[E_EEPROM_XMC4_STAGING_PAGES];  /**< Page held by each staging page, MAX_PAGES if unused */
+  uint32_t staging[E_EEPROM_XMC4_STAGING_PAGES][E_EEPROM_XMC4_MIN_WORDS_PER_PAGE];  /**< Staged pages */
+  uint32_t len;                               /**< Size of the emulated EEPROM */
+} E_EEPROM_XMC4_RAM_BUFFER_t;
+#else
+/** Data structure to hold the header of the User Data block (BCC + CRC), the data is at ram_ptr of the handle */
+typedef struct E_EEPROM_XMC4_RAM_BUFFER
+{
+  uint32_t crc;                               /**< CRC of the data block */
+  uint32_t block_cycle_count;                 /**< Block cycle count of the data block */
+  uint32_t len;                               /**< Size of the emulated EEPROM */
+} E_EEPROM_XMC4_RAM_BUFFER_t;
+#endif
+
+/** Data structure to hold the flush policy and the pages changed since the last update */
+typedef struct E_EEPROM_XMC4_FLUSH_STATE
+{
+  E_EEPROM_XMC4_FLUSH_POLICY_t policy;        /**< Flush policy copied from the handle */
+  uint32_t dirty_bytes_limit;                 /**< Changed bytes starting an update */
+  uint32_t quiet_time;                        /**< Time in ms without changes starting an update */
+  uint32_t quiet_elapsed;                     /**< Time in ms since the last change */
+  uint32_t dirty_pages;                       /**< One bit per page changed since the last update */
+  uint32_t dirty_bytes;                       /**< Number of byte changes since the last update */
+  E_EEPROM_XMC4_STATUS_t last_status;         /**< Status of the last update */
+} E_EEPROM_XMC4_FLUSH_STATE_t;
+
+/** Data structure to hold the state of a commit started by E_EEPROM_XMC4_CommitBegin() */
+typedef struct E_EEPROM_XMC4_COMMIT_STATE
+{
+  bool     busy;                              /**< A commit is in progress */
+  bool     header_pending;                    /**< The page buffer is not programmed yet */
+  uint32_t record_addr;                       /**< Flash address of the record */
+  uint32_t record_pages;                      /**< Pages of the data block held by the record */
+  uint32_t pending_pages;                     /**< Pages of the record not programmed yet */
+  uint32_t flash_addr;                        /**< Flash address the next page is programmed to */
+  uint32_t dirty_bytes;                       /**< Byte changes held by the record */
+#ifndef E_EEPROM_XMC4_FLASH_READ_ENABLED
+  uint32_t shadow_page[E_EEPROM_XMC4_SHADOW_PAGES];  /**< Page saved by each shadow page, MAX_PAGES if unused */
+  uint32_t shadow[E_EEPROM_XMC4_SHADOW_PAGES][E_EEPROM_XMC4_MIN_WORDS_PER_PAGE];  /**< Saved pages */
+#endif
+} E_EEPROM_XMC4_COMMIT_STATE_t;
+
+#ifdef E_EEPROM_XMC4_WARM_RESET_ENABLED
+/** Seal of the RAM buffer and sector info kept over a warm reset */
+typedef struct E_EEPROM_XMC4_WARM_SEAL
+{
+  uint32_t generation;                        /**< Number of the seal */
+  uint32_t checksum;                          /**< Checksum of the sealed state */
+} E_EEPROM_XMC4_WARM_SEAL_t;
+#endif
+
+/**
+* @brief Run time state of an E_EEPROM_XMC4 instance, one per instance. With E_EEPROM_XMC4_WARM_RESET_ENABLED it must
+* be placed into RAM not initialized by the startup code, see E_EEPROM_XMC4_NOINIT.
+*/
+
+typedef struct E_EEPROM_XMC4_DATA
+{
+  E_EEPROM_XMC4_RAM_BUFFER_t data_buffer;     /**< RAM copy of the data block */
+  E_EEPROM_XMC4_SECTOR_INFO_t sector_info;    /**< Location of the records on flash */
+  E_EEPROM_XMC4_FLUSH_STATE_t flush_state;    /**< Flush policy and dirty pages */
+  E_EEPROM_XMC4_COMMIT_STATE_t commit_state;  /**< Commit in progress */
+  E_EEPROM_XMC4_INIT_INFO_t init_info;        /**< Cost of the last initialization */
+  const E_EEPROM_XMC4_SECTOR_t *sector_ptr;   /**< Flash sectors in use, from the handle or E_EEPROM_XMC4_SECTORS */
+  uint32_t sector_count;                      /**< Number of flash sectors in use */
+  uint32_t page_buffer[E_EEPROM_XMC4_MIN_WORDS_PER_PAGE];  /**< Page programmed next into the flash */
+#ifdef E_EEPROM_XMC4_WARM_RESET_ENABLED
+  E_EEPROM_XMC4_WARM_SEAL_t warm_seal;        /**< Seal of the state kept over a warm reset */
+#endif
+} E_EEPROM_XMC4_DATA_t;
+
 /**
 * @brief Initialization data structure of E_EEPROM_XMC4 APP
 */
@@ -501,6 +776,18 @@ typedef enum E_EEPROM_XMC4_STATUS
 typedef struct E_EEPROM_XMC4
 {
   bool initialized;                           /**< Initialization status */
+  E_EEPROM_XMC4_FLUSH_POLICY_t flush_policy;  /**< When the RAM copy is programmed into the flash */
+  uint32_t flush_dirty_bytes;                 /**< Changed bytes starting an update, with
+                                                   E_EEPROM_XMC4_FLUSH_DIRTY_BYTES */
+  uint32_t flush_quiet_time;                  /**< Time in ms without changes starting an update, with
+                                                   E_EEPROM_XMC4_FLUSH_QUIESCENCE */
+  E_EEPROM_XMC4_DATA_t *data_ptr;             /**< Pointer to the state data structure of the instance */
+  const E_EEPROM_XMC4_SECTOR_t *sector_ptr;   /**< Flash sectors of the instance in the order they are written,
+                                                   NULL selects E_EEPROM_XMC4_SECTORS */
+  uint32_t sector_count;                      /**< Number of sectors at sector_ptr, 2 to 32 */
+  uint32_t *ram_ptr;                          /**< RAM copy of the emulated EEPROM of the instance,
+                                                   E_EEPROM_XMC4_RAM_WORDS(len) words. Not used with
+                                                   E_EEPROM_XMC4_FLASH_READ_ENABLED */
 } E_EEPROM_XMC4_t;
 
 /**
@@ -521,25 +808,55 @@ extern "C"  {
 
 /**
  * @brief Initializes flash emulated EEPROM to start read and write operations.
- * @param handle  Handle for XMC EEProm block with status of Initialization
+ * @param handle  Handle for XMC EEProm block with status of Initialization, state data structure and sectors
  * @param len     Size of emulated EEPROM
  *
  * @return E_EEPROM_XMC4_STATUS_OK, if Initialization succeeds, Else\n
  *         E_EEPROM_XMC4_STATUS_WRITE_ERROR, if initialization failed due to write error.
- *         E_EEPROM_XMC4_STATUS_ERASE_ERROR, if erase failed during initialization process.
  *         E_EEPROM_XMC4_STATUS_ERROR_OLD_DATA, if initialization succeeded with old data block. Latest has been found
  *                                              corrupted or half programmed in previous power down cycle write.
+ *         E_EEPROM_XMC4_STATUS_ERROR_PARAM, if \a len is too large or the RAM copy is missing.
  *
  * \par<b>Description:</b><br>
  * Initializes Flash Emulated EEPROM application.\n
- * It checks for the latest written block starting from logical SECTOR 7 to SECTOR 4. If a latest block is identified
- * among any 4 sectors, the block gets copied to RAM. Hence it can be read any time from RAM. If no blocks identified,
- * SECTOR 4 is considered as current active sector for future writes. \n If more than one SECTOR has data blocks, all
- * sectors apart from the sector having the latest data block are erased. In this process, any flash errors results in
- * "E_EEPROM_XMC4_STATUS_ERASE_ERROR" state.\n  If the sector having the latest block doesn't have any free space, the Init
+ * It checks for the latest written block in the sectors of E_EEPROM_XMC4_SECTORS. If a latest block is identified
+ * among the sectors, the block gets copied to RAM. Hence it can be read any time from RAM. If no blocks identified,
+ * the first sector of E_EEPROM_XMC4_SECTORS is considered as current active sector for future writes. \n If more than one SECTOR has data blocks, all
+ * sectors apart from the sector having the latest data block are marked for erase, see E_EEPROM_XMC4_EraseStep().
+ * \n  If the sector having the latest block doesn't have any free space, the Init
  * process will copy the latest block into new free sector and erase the old sector. If the copy process results in
  * flash write errors or when all sectors filled up, it returns the status \a E_EEPROM_XMC4_STATUS_WRITE_ERROR.
  *
+ * A data block on flash holds the CRC, the block cycle count and \a len bytes of data rounded up to full 256 byte
+ * pages, hence a 16 KBytes sector holds up to 64 data blocks. The number of pages is recorded in the upper byte of
+ * the block cycle count. Data blocks of another size, written before \a len was changed or by a previous version
+ * with fixed 8 KBytes blocks, are read and replaced by a full data block of the new size on the next update.
+ * The latest data is rebuilt from the last full data block of the sector and the delta records written after it,
+ * see E_EEPROM_XMC4_UpdateFlashContents().
+ * Only the block cycle counts of the records are read to find the newest record, the CRC is verified for the newest
+ * records down to the first valid one, see E_EEPROM_XMC4_GetInitInfo().
+ *
+ * If E_EEPROM_XMC4_WARM_RESET_ENABLED is defined via Makefile, the RAM copy and the sector information are kept in
+ * no-init RAM and sealed with a generation counter and a checksum after each successful initialization and
+ * E_EEPROM_XMC4_UpdateFlashContents(). After a watchdog or software reset the initialization checks the seal and the
+ * CRC of the RAM copy and returns without reading the flash. Changes of the RAM copy not programmed into the flash
+ * before the reset, a changed \a len or an interrupted flash update lead to the usual initialization. The option must
+ * not be used if the emulated area is modified by other means without a power on reset.
+ *
+ * If E_EEPROM_XMC4_FLASH_READ_ENABLED is defined via Makefile, no RAM copy of the data block is kept. The
+ * initialization only locates the latest copy of each page on flash and the Read APIs read from there. The Write APIs
+ * copy the page of a changed byte into one of E_EEPROM_XMC4_STAGING_PAGES staging pages in RAM, which are programmed
+ * by the next E_EEPROM_XMC4_UpdateFlashContents(). A write which would change more pages than staging pages are left
+ * is rejected without changing any byte, the Write APIs never program the flash for staging. The option cannot be
+ * combined with E_EEPROM_XMC4_WARM_RESET_ENABLED.
+ *
+ * The instance keeps its state in the structure at \a data_ptr of the handle and writes its records into the
+ * \a sector_count sectors at \a sector_ptr. If \a sector_ptr is NULL, the sectors of E_EEPROM_XMC4_SECTORS are used,
+ * the handle is not changed. Instances must not share sectors, only one of them may use E_EEPROM_XMC4_SECTORS.
+ * The data is copied into the array at \a ram_ptr of the handle, which holds E_EEPROM_XMC4_RAM_WORDS(len) words.
+ * With E_EEPROM_XMC4_WARM_RESET_ENABLED the state data structure and this array must be placed with
+ * E_EEPROM_XMC4_NOINIT.
+ *
  * \par<b>Related APIs:</b><BR>
  * None \n
  *
@@ -548,6 +865,7 @@ extern "C"  {
 
 /**
  * @brief Update a particular byte in the RAM copy of data block.
+ * @param handle         Pointer to the handle of the instance
  * @param offset_address RAM Offset address, where the data shall be written.
  * @param value          8bit data to be written into the RAM buffer.
  *
@@ -556,14 +874,20 @@ extern "C"  {
  * \par<b>Description:</b><br>
  * Write a particular byte into the RAM buffer. Sets up the internal RAM buffer with data elements
  * which are targeted to be written into emulated flash area.\n
+ * A changed byte marks its page as dirty. With the E_EEPROM_XMC4_FLUSH_IMMEDIATE or E_EEPROM_XMC4_FLUSH_DIRTY_BYTES
+ * policy the API may program the flash, see E_EEPROM_XMC4_GetFlushInfo() for the status.\n
+ * With E_EEPROM_XMC4_FLASH_READ_ENABLED the API returns false without writing if no staging page is left for the
+ * page of the byte. During a commit started by E_EEPROM_XMC4_CommitBegin() it returns false without writing if the
+ * page is not programmed yet and no shadow page is left, with E_EEPROM_XMC4_FLASH_READ_ENABLED in any case.\n
  *
  *<b>Related APIs : </b><BR>  None\n\n
  *
  */
- bool E_EEPROM_XMC4_WriteByte(const uint16_t offset_address, const uint8_t value);
+ bool E_EEPROM_XMC4_WriteByte(E_EEPROM_XMC4_t *const handle, const uint16_t offset_address, const uint8_t value);
 
 /**
  * @brief Update a set of bytes in the RAM copy of data block.
+ * @param handle         Pointer to the handle of the instance
  * @param offset_address RAM Offset address from where the data write shall be started.
  * @param data           Constant pointer to array of 8bit data.
  * @param length         Length of the data array (specify the number bytes to be written).
@@ -572,14 +896,23 @@ extern "C"  {
  *
  * \par<b>Description:</b><br>
  * Write an array of data elements into the RAM buffer.\n
+ * The changed bytes mark their pages as dirty. With the E_EEPROM_XMC4_FLUSH_IMMEDIATE or
+ * E_EEPROM_XMC4_FLUSH_DIRTY_BYTES policy the API may program the flash, see E_EEPROM_XMC4_GetFlushInfo() for the
+ * status.\n
+ * With E_EEPROM_XMC4_FLASH_READ_ENABLED the API returns false without writing any byte if the changed bytes are in
+ * more pages than staging pages are left, the array is then to be split or E_EEPROM_XMC4_UpdateFlashContents()
+ * called first. During a commit started by E_EEPROM_XMC4_CommitBegin() it returns false without writing any byte if
+ * the pages not programmed yet exceed the shadow pages left, with E_EEPROM_XMC4_FLASH_READ_ENABLED in any case.\n
  *
  *<b>Related APIs : </b><BR>  None\n\n
  *
  */
- bool E_EEPROM_XMC4_WriteArray(const uint16_t offset_address, const uint8_t *const data, const uint16_t length);
+ bool E_EEPROM_XMC4_WriteArray(E_EEPROM_XMC4_t *const handle, const uint16_t offset_address,
+                               const uint8_t *const data, const uint16_t length);
 
 /**
  * @brief Reads a particular byte from the RAM copy of data block.
+ * @param handle         Pointer to the handle of the instance
  * @param offset_address RAM Offset address from where the data read shall be started.
  * @param value          Constant pointer to 8bit data variable (address of variable).
  *
@@ -592,10 +925,11 @@ extern "C"  {
  *<b>Related APIs : </b><BR>  None\n\n
  *
  */
- void E_EEPROM_XMC4_ReadByte(const uint16_t offset_address, uint8_t *const value);
+ void E_EEPROM_XMC4_ReadByte(E_EEPROM_XMC4_t *const handle, const uint16_t offset_address, uint8_t *const value);
 
 /**
  * @brief Reads a set of bytes from the RAM copy of data block.
+ * @param handle         Pointer to the handle of the instance
  * @param offset_address RAM Offset address from where the data read shall be started.
  * @param data           Constant pointer to array of 8bit data variable.
  * @param length         Length of the data array (specify the number bytes to be read).
@@ -609,30 +943,41 @@ extern "C"  {
  * None\n
  *
  */
- void E_EEPROM_XMC4_ReadArray(const uint16_t offset_address, uint8_t *const data, const uint16_t length);
+ void E_EEPROM_XMC4_ReadArray(E_EEPROM_XMC4_t *const handle, const uint16_t offset_address,
+                              uint8_t *const data, const uint16_t length);
 
 /**
  * @brief Programs the flash with the latest data block available in RAM.
- * @param :
+ * @param handle Pointer to the handle of the instance
  *
  * @return E_EEPROM_XMC4_STATUS_OK, if flash programming succeeds, Else\n
  *         E_EEPROM_XMC4_STATUS_WRITE_ERROR, fails due to flash write error or \n
- *         E_EEPROM_XMC4_STATUS_ERASE_ERROR, fails due to flash erase operation when all sectors are filled up.
+ *         E_EEPROM_XMC4_STATUS_ERASE_ERROR, fails due to flash erase operation of the next sector.
  *
  * \par<b>Description:</b><br>
  * Programs the RAM buffer into emulated area of the FLASH. On successful completion of this API, the data block
  * gets saved in the flash. Hence data retention is possible over reset cycles. Call this API only in the POWER
  * DOWN cycle to ensure the flash endurance.
  *
+ * Only the 256 byte pages of the RAM buffer which differ from the data in flash are programmed, as a delta record of
+ * one header page followed by the changed pages. A full data block is written instead if the delta record is not
+ * smaller, after 16 delta records, when a new sector is started or when \a len was changed. Nothing is programmed if
+ * no page is dirty or the dirty pages equal the data in flash.
+ *
+ * A record starting a sector which still holds old records erases the sector first. Use E_EEPROM_XMC4_EraseStep() to
+ * erase it before.
+ *
+ * A commit started by E_EEPROM_XMC4_CommitBegin() is completed first.
+ *
  * \par<b>Related APIs:</b><BR>
- * None\n
+ * E_EEPROM_XMC4_CommitBegin()\n
  *
  */
- E_EEPROM_XMC4_STATUS_t E_EEPROM_XMC4_UpdateFlashContents(void);
+ E_EEPROM_XMC4_STATUS_t E_EEPROM_XMC4_UpdateFlashContents(E_EEPROM_XMC4_t *const handle);
 
 /**
  * @brief Check at least one data block is available in the flash emulated EEPROM.
- * @param :
+ * @param handle Pointer to the handle of the instance
  *
  * @return  <BR>
  *        true, if the flash is empty
@@ -645,7 +990,140 @@ extern "C"  {
  *  None\n
  *
  */
- bool E_EEPROM_XMC4_IsFlashEmpty(void);
+ bool E_EEPROM_XMC4_IsFlashEmpty(E_EEPROM_XMC4_t *const handle);
+
+/**
+ * @brief Advances the time of the E_EEPROM_XMC4_FLUSH_QUIESCENCE flush policy.
+ * @param handle     Pointer to the handle of the instance
+ * @param elapsed_ms Time in ms since the last call.
+ *
+ * @return E_EEPROM_XMC4_STATUS_OK, if no update was due or the update succeeded, Else\n
+ *         the status of E_EEPROM_XMC4_UpdateFlashContents().
+ *
+ * \par<b>Description:</b><br>
+ * Call this API periodically, e.g. from the main loop. With the E_EEPROM_XMC4_FLUSH_QUIESCENCE policy it programs the
+ * dirty pages once no data was changed for \a flush_quiet_time ms. A failed update is retried after another
+ * \a flush_quiet_time ms. With other policies the API does nothing.
+ *
+ * \par<b>Related APIs:</b><BR>
+ * E_EEPROM_XMC4_UpdateFlashContents()\n
+ *
+ */
+ E_EEPROM_XMC4_STATUS_t E_EEPROM_XMC4_Tick(E_EEPROM_XMC4_t *const handle, uint32_t elapsed_ms);
+
+/**
+ * @brief Reads the dirty state and the block cycle count of the last update.
+ * @param handle Pointer to the handle of the instance
+ * @param info Pointer to the structure receiving the information.
+ *
+ * @return None
+ *
+ * \par<b>Description:</b><br>
+ * Intended for diagnostics. The block cycle count increments with each update programming the flash.
+ *
+ * \par<b>Related APIs:</b><BR>
+ * None\n
+ *
+ */
+ void E_EEPROM_XMC4_GetFlushInfo(E_EEPROM_XMC4_t *const handle, E_EEPROM_XMC4_FLUSH_INFO_t *const info);
+
+/**
+ * @brief Reads the cost of the search for the latest record by the last initialization.
+ * @param handle Pointer to the handle of the instance
+ * @param info Pointer to the structure receiving the information.
+ *
+ * @return None
+ *
+ * \par<b>Description:</b><br>
+ * Intended for measuring the boot time. The initialization reads the record headers to order the records by their
+ * block cycle count and verifies the CRC of the newest records only, down to the first valid one. A delta record is
+ * verified together with its full data block and the delta records in between. All values are 0 if the RAM copy was
+ * kept over a warm reset.
+ *
+ * \par<b>Related APIs:</b><BR>
+ * E_EEPROM_XMC4_Init()\n
+ *
+ */
+ void E_EEPROM_XMC4_GetInitInfo(E_EEPROM_XMC4_t *const handle, E_EEPROM_XMC4_INIT_INFO_t *const info);
+
+/**
+ * @brief Erases one sector holding only old records.
+ * @param handle Pointer to the handle of the instance
+ *
+ * @return E_EEPROM_XMC4_STATUS_OK, if the erase succeeded or no sector is waiting for its erase, Else\n
+ *         E_EEPROM_XMC4_STATUS_BUSY, if a commit is in progress or \n
+ *         E_EEPROM_XMC4_STATUS_ERASE_ERROR, fails due to flash erase error.
+ *
+ * \par<b>Description:</b><br>
+ * Erases the sector the next records are written to first, then the remaining sectors apart from the one having the
+ * latest data block. Each call takes the time of one sector erase, call it in idle time. The sectors waiting for their
+ * erase are found again by the initialization after a reset.
+ * Nothing is erased while a commit started by E_EEPROM_XMC4_CommitBegin() is in progress.
+ *
+ * \par<b>Related APIs:</b><BR>
+ * E_EEPROM_XMC4_IsErasePending()\n
+ *
+ */
+ E_EEPROM_XMC4_STATUS_t E_EEPROM_XMC4_EraseStep(E_EEPROM_XMC4_t *const handle);
+
+/**
+ * @brief Check if a sector holding only old records is waiting for its erase.
+ * @param handle Pointer to the handle of the instance
+ *
+ * @return  <BR>
+ *        true, if E_EEPROM_XMC4_EraseStep() has a sector to erase
+ *        else returns false.
+ *
+ * \par<b>Related APIs:</b><BR>
+ * E_EEPROM_XMC4_EraseStep()\n
+ *
+ */
+ bool E_EEPROM_XMC4_IsErasePending(E_EEPROM_XMC4_t *const handle);
+
+/**
+ * @brief Starts programming a snapshot of the data block into the flash.
+ * @param handle Pointer to the handle of the instance
+ *
+ * @return E_EEPROM_XMC4_STATUS_OK, if the commit started or nothing has to be programmed, Else\n
+ *         E_EEPROM_XMC4_STATUS_BUSY, if a commit is already in progress or \n
+ *         E_EEPROM_XMC4_STATUS_ERASE_ERROR, fails due to flash erase operation of the next sector.
+ *
+ * \par<b>Description:</b><br>
+ * Selects the record as E_EEPROM_XMC4_UpdateFlashContents() does and calculates its CRC over the data block as it is
+ * at the time of the call. The pages are programmed by E_EEPROM_XMC4_CommitPoll(). A page changed by the Write APIs
+ * before it is programmed is saved in one of E_EEPROM_XMC4_SHADOW_PAGES shadow pages first, hence the record holds
+ * the snapshot. The changes are programmed by the next commit. A write which finds no free shadow page returns false
+ * without changing any byte.
+ *
+ * The record becomes valid with its last page, a reset during the commit keeps the previous data block. With
+ * E_EEPROM_XMC4_FLASH_READ_ENABLED a Write API called during the commit returns false without writing.
+ *
+ * A record starting a sector which still holds old records erases the sector first.
+ *
+ * \par<b>Related APIs:</b><BR>
+ * E_EEPROM_XMC4_CommitPoll()\n
+ *
+ */
+ E_EEPROM_XMC4_STATUS_t E_EEPROM_XMC4_CommitBegin(E_EEPROM_XMC4_t *const handle);
+
+/**
+ * @brief Programs the next page of the commit started by E_EEPROM_XMC4_CommitBegin().
+ * @param handle Pointer to the handle of the instance
+ *
+ * @return E_EEPROM_XMC4_STATUS_BUSY, if pages are left to program, Else\n
+ *         E_EEPROM_XMC4_STATUS_OK, if the commit completed or no commit is in progress or \n
+ *         E_EEPROM_XMC4_STATUS_WRITE_ERROR, fails due to flash write error.
+ *
+ * \par<b>Description:</b><br>
+ * Each call takes the time of one page program. Once the last page is programmed the flash holds the snapshot. If
+ * the commit fails, the pages of the snapshot stay dirty for the next commit. The status of the completed commit is
+ * reported by E_EEPROM_XMC4_GetFlushInfo().
+ *
+ * \par<b>Related APIs:</b><BR>
+ * E_EEPROM_XMC4_CommitBegin()\n
+ *
+ */
+ E_EEPROM_XMC4_STATUS_t E_EEPROM_XMC4_CommitPoll(E_EEPROM_XMC4_t *const handle);
 
 /**
  *@}